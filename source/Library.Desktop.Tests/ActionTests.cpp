@@ -101,6 +101,13 @@ namespace LibraryDesktopTests
 			Assert::AreEqual(0, monster.Health);
 			monster.Update(gameState);
 			Assert::AreEqual(10, monster.Health);
+
+			// SetTarget resolves the new name straight away.
+			monster.AppendAuxiliaryAttribute("Mana"s).PushBack(0);
+			actionIncrement->SetTarget("Mana"s);
+			monster.Update(gameState);
+			Assert::AreEqual(10, monster.Health);
+			Assert::AreEqual(10, monster.Find("Mana"s)->Get<int32_t>());
 		}
 
 		TEST_METHOD(ActionExpression)
@@ -0,0 +1,201 @@
+#include "pch.h"
+#include "CppUnitTest.h"
+#include "ArenaAllocator.h"
+#include "Vector.h"
+#include "GameObject.h"
+#include "JsonParseCoordinator.h"
+#include "TableParseHelper.h"
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+using namespace FieaGameEngine;
+using namespace std;
+
+namespace LibraryDesktopTests
+{
+	TEST_CLASS(ArenaAllocatorTests)
+	{
+	public:
+		TEST_METHOD_INITIALIZE(Initialize)
+		{
+#if defined(DEBUG) || defined(_DEBUG)
+			_CrtSetDbgFlag(_CRTDBG_ALLOC_MEM_DF);
+			_CrtMemCheckpoint(&_startMemState);
+#endif
+		}
+
+		TEST_METHOD_CLEANUP(Cleanup)
+		{
+#if defined(DEBUG) || defined(_DEBUG)
+			_CrtMemState endMemState, diffMemState;
+			_CrtMemCheckpoint(&endMemState);
+			if (_CrtMemDifference(&diffMemState, &_startMemState, &endMemState))
+			{
+				_CrtMemDumpStatistics(&diffMemState);
+				Assert::Fail(L"Memory Leaks!");
+			}
+#endif
+		}
+
+		TEST_METHOD(Allocate)
+		{
+			ArenaAllocator arena{ 1024 };
+			Assert::IsNull(arena.Allocate(0));
+			Assert::AreEqual(size_t(0), arena.ChunkCount());
+
+			std::byte* a = reinterpret_cast<std::byte*>(arena.Allocate(10));
+			std::byte* b = reinterpret_cast<std::byte*>(arena.Allocate(20));
+			Assert::AreEqual(size_t(0), reinterpret_cast<uintptr_t>(a) % IAllocator::Alignment);
+			Assert::IsTrue(a + IAllocator::Alignment == b);
+			Assert::AreEqual(size_t(48), arena.BytesInUse());
+			Assert::AreEqual(size_t(1), arena.ChunkCount());
+
+			// Only the newest block is reclaimed.
+			arena.Deallocate(a, 10);
+			Assert::AreEqual(size_t(48), arena.BytesInUse());
+			arena.Deallocate(b, 20);
+			Assert::AreEqual(size_t(16), arena.BytesInUse());
+			Assert::IsTrue(b == arena.Allocate(32));
+
+			void* large = arena.Allocate(4096);
+			Assert::IsNotNull(large);
+			Assert::AreEqual(size_t(2), arena.ChunkCount());
+		}
+
+		TEST_METHOD(Reallocate)
+		{
+			ArenaAllocator arena{ 4096 };
+
+			int32_t* block = reinterpret_cast<int32_t*>(arena.Reallocate(nullptr, 0, sizeof(int32_t) * 4));
+			for (int32_t i = 0; i < 4; ++i)
+				block[i] = i;
+
+			// The newest block grows in place.
+			Assert::IsTrue(block == arena.Reallocate(block, sizeof(int32_t) * 4, sizeof(int32_t) * 64));
+
+			arena.Allocate(16);
+			int32_t* moved = reinterpret_cast<int32_t*>(arena.Reallocate(block, sizeof(int32_t) * 64, sizeof(int32_t) * 128));
+			Assert::IsTrue(moved != block);
+			for (int32_t i = 0; i < 4; ++i)
+				Assert::AreEqual(i, moved[i]);
+
+			// Vectors built up one element at a time stay in place while nothing else is allocated.
+			Vector<int32_t> vector{ arena };
+			vector.PushBack(0);
+			const int32_t* front = &vector.Front();
+			for (int32_t i = 1; i < 100; ++i)
+				vector.PushBack(i);
+			Assert::IsTrue(front == &vector.Front());
+		}
+
+		TEST_METHOD(Reset)
+		{
+			ArenaAllocator arena{ 1024 };
+			void* first = arena.Allocate(64);
+			for (size_t i = 0; i < 100; ++i)
+				arena.Allocate(64);
+			size_t chunkCount = arena.ChunkCount();
+			Assert::IsTrue(chunkCount > 1);
+
+			arena.Reset();
+			Assert::AreEqual(size_t(0), arena.BytesInUse());
+			Assert::AreEqual(chunkCount, arena.ChunkCount());
+			Assert::IsTrue(first == arena.Allocate(64));
+
+			// Reset keeps the chunks; Release gives them back.
+			for (size_t i = 0; i < 100; ++i)
+				arena.Allocate(64);
+			Assert::AreEqual(chunkCount, arena.ChunkCount());
+
+			arena.Release();
+			Assert::AreEqual(size_t(0), arena.ChunkCount());
+			Assert::AreEqual(size_t(0), arena.BytesInUse());
+		}
+
+		TEST_METHOD(ExplicitAllocator)
+		{
+			GameObjectFactory gameObjectFactory;
+			ArenaAllocator arena;
+
+			// Factories hand the allocator to the constructor, so the object's storage comes from where the object itself was placed.
+			Scope* gameObject = Factory<Scope>::Create("GameObject"s, arena);
+			Assert::IsTrue(&gameObject->GetAllocator() == &arena);
+			Assert::IsTrue(&gameObject->AppendScope("Child"s).GetAllocator() == &arena);
+			delete gameObject;
+
+			// Placing a Scope without constructing it leaves nothing behind for the next Scope built on this thread.
+			void* block = Scope::operator new(sizeof(Scope), arena);
+			Scope::operator delete(block, arena);
+			Scope scope;
+			Assert::IsTrue(&scope.GetAllocator() == &IAllocator::Default());
+		}
+
+		TEST_METHOD(LoadDocument)
+		{
+			GameObjectFactory gameObjectFactory;
+			ArenaAllocator arena;
+
+			const string document = R"({
+				"type": "table",
+				"class": "GameObject",
+				"value": {
+					"Name": { "type": "string", "value": "Level" },
+					"Children": {
+						"type": "table",
+						"class": "GameObject",
+						"value": [
+							{ "Name": { "type": "string", "value": "Child1" } },
+							{ "Name": { "type": "string", "value": "Child2" } }
+						]
+					},
+					"Settings": {
+						"type": "table",
+						"value": { "Difficulty": { "type": "integer", "value": [ 1, 2, 3 ] } }
+					}
+				}
+			})";
+
+			for (size_t load = 0; load < 2; ++load)
+			{
+				shared_ptr<JsonParseCoordinator::Wrapper> wrapper = make_shared<TableParseHelper::TableWrapper>();
+				{
+					JsonParseCoordinator parser{ wrapper, arena };
+					parser.AddHelper(make_shared<TableParseHelper>());
+					parser.DeserializeObject(document);
+				}
+
+				TableParseHelper::TableWrapper* rawWrapper = static_cast<TableParseHelper::TableWrapper*>(wrapper.get());
+				Scope& root = *rawWrapper->Data;
+				Assert::IsTrue(&root.GetAllocator() == &arena);
+
+				GameObject* level = root[0][0].As<GameObject>();
+				Assert::IsNotNull(level);
+				Assert::AreEqual("Level"s, level->Name);
+				Assert::IsTrue(&level->GetAllocator() == &arena);
+
+				Datum& children = level->GetChildren();
+				Assert::AreEqual(size_t(2), children.Size());
+				Assert::IsTrue(&children.GetAllocator() == &arena);
+				Assert::AreEqual("Child2"s, children[1].As<GameObject>()->Name);
+				Assert::IsTrue(&children[1].GetAllocator() == &arena);
+
+				Scope& settings = *level->Find("Settings"sv)->Get<Scope*>();
+				Assert::IsTrue(&settings.GetAllocator() == &arena);
+				Datum& difficulty = *settings.Find("Difficulty"sv);
+				Assert::AreEqual(size_t(3), difficulty.Size());
+				Assert::IsTrue(&difficulty.GetAllocator() == &arena);
+
+				size_t chunkCount = arena.ChunkCount();
+				Assert::IsTrue(arena.BytesInUse() > 0);
+
+				// Unloading the level still runs every destructor, but the frees they make are no-ops; the arena is then recycled for the next load.
+				rawWrapper->Data.reset();
+				arena.Reset();
+				Assert::AreEqual(size_t(0), arena.BytesInUse());
+				Assert::AreEqual(chunkCount, arena.ChunkCount());
+			}
+		}
+
+	private:
+		inline static _CrtMemState _startMemState;
+	};
+}
@@ -9,7 +9,12 @@ namespace UnitTests
 	RTTI_DEFINITIONS(AttributedBar);
 
 	AttributedBar::AttributedBar()
-		: AttributedFoo(AttributedBar::TypeIdClass())
+		: AttributedBar(IAllocator::Default())
+	{
+	}
+
+	AttributedBar::AttributedBar(IAllocator& allocator)
+		: AttributedFoo(AttributedBar::TypeIdClass(), allocator)
 	{
 
 	}
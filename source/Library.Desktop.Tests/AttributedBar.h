@@ -13,6 +13,12 @@ namespace UnitTests
 		static const std::size_t ArraySize = 5;
 
 		AttributedBar();
+
+		/// <summary>
+		/// Constructor for AttributedBar that takes its storage from the given allocator, as factories do when creating it in one.
+		/// </summary>
+		/// <param name="allocator"> The allocator the AttributedBar takes its storage from. </param>
+		explicit AttributedBar(FieaGameEngine::IAllocator& allocator);
 		AttributedBar(const AttributedBar&) = default;
 		AttributedBar(AttributedBar&&) noexcept = default;
 		AttributedBar& operator =(const AttributedBar&) = default;
@@ -30,5 +36,5 @@ namespace UnitTests
 		static FieaGameEngine::Vector<FieaGameEngine::Signature> Signatures();
 	};
 
-	ConcreteFactory(AttributedBar, Scope);
+	ConcreteScopeFactory(AttributedBar);
 }
\ No newline at end of file
@@ -9,13 +9,18 @@ namespace UnitTests
 	RTTI_DEFINITIONS(AttributedFoo);
 
 	AttributedFoo::AttributedFoo()
-		: Attributed(AttributedFoo::TypeIdClass())
+		: AttributedFoo(IAllocator::Default())
+	{
+	}
+
+	AttributedFoo::AttributedFoo(IAllocator& allocator)
+		: Attributed(AttributedFoo::TypeIdClass(), allocator)
 	{
 
 	}
 
-	AttributedFoo::AttributedFoo(IdType typeID)
-		: Attributed(typeID)
+	AttributedFoo::AttributedFoo(IdType typeID, IAllocator& allocator)
+		: Attributed(typeID, allocator)
 	{
 
 	}
@@ -13,6 +13,12 @@ namespace UnitTests
 		static const std::size_t ArraySize = 5;
 
 		AttributedFoo();
+
+		/// <summary>
+		/// Constructor for AttributedFoo that takes its storage from the given allocator, as factories do when creating it in one.
+		/// </summary>
+		/// <param name="allocator"> The allocator the AttributedFoo takes its storage from. </param>
+		explicit AttributedFoo(FieaGameEngine::IAllocator& allocator);
 		AttributedFoo(const AttributedFoo&) = default;
 		AttributedFoo(AttributedFoo&&) noexcept = default;
 		AttributedFoo& operator =(const AttributedFoo&) = default;
@@ -38,8 +44,8 @@ namespace UnitTests
 		static FieaGameEngine::Vector<FieaGameEngine::Signature> Signatures();
 
 	protected:
-		AttributedFoo(RTTI::IdType typeID);
+		AttributedFoo(RTTI::IdType typeID, FieaGameEngine::IAllocator& allocator = FieaGameEngine::IAllocator::Default());
 	};
 
-	ConcreteFactory(AttributedFoo, Scope);
+	ConcreteScopeFactory(AttributedFoo);
 }
\ No newline at end of file
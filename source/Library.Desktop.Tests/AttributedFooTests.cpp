@@ -160,20 +160,42 @@ namespace UnitTestLibraryDesktop
 
 			//All attributes
 			{
-				const Vector<string>& attributes = abFoo.Attributes();
+				Attributed::AttributeView attributes = abFoo.Attributes();
 				Assert::AreEqual(size_t(14), attributes.Size());
+				Assert::AreEqual("this"s, attributes[0]);
+				Assert::AreEqual("Auxiliary"s, attributes[13]);
+				Assert::ExpectException<out_of_range>([&attributes]() { attributes[14]; });
 			}
 
 			//Prescribed attributes
 			{
-				const Vector<string>& attributes = abFoo.PrescribedAttributes();
+				Attributed::AttributeView attributes = abFoo.PrescribedAttributes();
 				Assert::AreEqual(size_t(12), attributes.Size());
+
+				size_t count = 0;
+				for (const string& name : attributes)
+				{
+					Assert::IsTrue(abFoo.IsPrescribedAttribute(name));
+					Assert::IsTrue(abFoo.Find(name) != nullptr);
+					++count;
+				}
+				Assert::AreEqual(size_t(12), count);
 			}
 
-			//All attributes
+			//Auxiliary attributes
 			{
-				const Vector<string>& attributes = abFoo.AuxiliaryAttributes();
+				Attributed::AttributeView attributes = abFoo.AuxiliaryAttributes();
 				Assert::AreEqual(size_t(1), attributes.Size());
+				Assert::IsFalse(attributes.IsEmpty());
+				Assert::AreEqual("Auxiliary"s, *attributes.begin());
+				Assert::IsTrue(++attributes.begin() == attributes.end());
+			}
+
+			//Views do not copy the names
+			{
+				AttributedFoo otherFoo;
+				Assert::IsTrue(otherFoo.AuxiliaryAttributes().IsEmpty());
+				Assert::IsTrue(&abFoo.Attributes()[1] == &abFoo.PrescribedAttributes()[0]);
 			}
 		}
 
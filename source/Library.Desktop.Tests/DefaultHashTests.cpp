@@ -1,6 +1,9 @@
 #include "pch.h"
 #include "CppUnitTest.h"
 #include "DefaultHash.h"
+#include "HashMap.h"
+#include <chrono>
+#include <sstream>
 #include "Foo.h"
 #include "ToStringSpecializations.h"
 
@@ -51,12 +54,109 @@ namespace LibraryDesktopTests
 		{
 			DefaultHash<char*> hashFunc{};
 			char* a = "abc";
-			char* b = "cba";
-			char* c = "abcd";
+			char* b = "abc";
+			char* c = "cba";
+			char* d = "abcd";
 
-			Assert::AreNotSame(a, b);
+			Assert::AreNotSame(a, c);
 			Assert::AreEqual(hashFunc(a), hashFunc(b));
 			Assert::AreNotEqual(hashFunc(a), hashFunc(c));
+			Assert::AreNotEqual(hashFunc(a), hashFunc(d));
+			Assert::AreEqual(DefaultHash<string>{}("abc"s), hashFunc(a));
+		}
+
+		TEST_METHOD(PermutedStringHash)
+		{
+			DefaultHash<string> hashFunc{};
+			Assert::AreNotEqual(hashFunc("Position"s), hashFunc("Positino"s));
+			Assert::AreNotEqual(hashFunc("Enemy12"s), hashFunc("Enemy21"s));
+			Assert::AreNotEqual(hashFunc(""s), hashFunc(string(1, '\0')));
+		}
+
+		TEST_METHOD(LongStringHash)
+		{
+			DefaultHash<string> hashFunc{};
+			string a(1000, 'x');
+			string b = a;
+			string c = a;
+			c[500] = 'y';
+			string d = a;
+			d.back() = 'y';
+
+			Assert::AreEqual(hashFunc(a), hashFunc(b));
+			Assert::AreNotEqual(hashFunc(a), hashFunc(c));
+			Assert::AreNotEqual(hashFunc(a), hashFunc(d));
+			Assert::AreNotEqual(hashFunc(a), hashFunc(a.substr(1)));
+		}
+
+		TEST_METHOD(AttributeNameBenchmark)
+		{
+			const char* attributeNames[] = { "this", "Name", "Position", "Rotation", "Scale", "Children", "Actions", "Health", "Target", "Step",
+				"Condition", "Cases", "Subtype", "Delay", "Expression", "Velocity", "Acceleration", "Mass", "Damage", "Armor" };
+
+			Vector<string> keys;
+			for (const char* name : attributeNames)
+			{
+				keys.PushBack(name);
+				for (int32_t i = 0; i < 500; ++i)
+					keys.PushBack(name + to_string(i));
+			}
+			for (int32_t i = 0; i < 10000; ++i)
+				keys.PushBack("Enemy"s + to_string(i));
+
+			DefaultHash<string> hashFunc{};
+			Vector<size_t> hashes;
+			hashes.Reserve(keys.Size());
+			size_t keyBytes = 0;
+			auto start = chrono::high_resolution_clock::now();
+			for (const string& key : keys)
+			{
+				hashes.PushBack(hashFunc(key));
+				keyBytes += key.size();
+			}
+			auto keyTime = chrono::duration_cast<chrono::nanoseconds>(chrono::high_resolution_clock::now() - start);
+
+			const string longKey(1 << 16, 'x');
+			size_t longBytes = 0;
+			size_t sink = 0;
+			start = chrono::high_resolution_clock::now();
+			for (size_t i = 0; i < 64; ++i)
+			{
+				sink += hashFunc(longKey);
+				longBytes += longKey.size();
+			}
+			auto longTime = chrono::duration_cast<chrono::nanoseconds>(chrono::high_resolution_clock::now() - start);
+
+			const size_t bucketCount = 4096;
+			Vector<size_t> buckets;
+			buckets.Reserve(bucketCount);
+			for (size_t i = 0; i < bucketCount; ++i)
+				buckets.PushBack(0);
+
+			HashMap<size_t, size_t> uniqueHashes{ keys.Size() };
+			size_t fullCollisions = 0;
+			for (size_t hash : hashes)
+			{
+				if (!uniqueHashes.Insert(make_pair(hash, hash)).second)
+					++fullCollisions;
+				++buckets[hash % bucketCount];
+			}
+
+			size_t bucketCollisions = 0;
+			for (size_t count : buckets)
+			{
+				if (count > 1)
+					bucketCollisions += count - 1;
+			}
+
+			wstringstream message;
+			message << keys.Size() << L" keys, " << fullCollisions << L" full collisions, " << bucketCollisions << L" bucket collisions in " << bucketCount << L" buckets, "
+				<< double(keyBytes) / std::max<long long>(keyTime.count(), 1) << L" bytes/ns on keys, " << double(longBytes) / std::max<long long>(longTime.count(), 1) << L" bytes/ns on 64KB keys (" << sink << L")";
+			Logger::WriteMessage(message.str().c_str());
+
+			Assert::AreEqual(size_t(0), fullCollisions);
+			const double expectedBucketCollisions = keys.Size() - bucketCount * (1.0 - pow(1.0 - 1.0 / bucketCount, double(keys.Size())));
+			Assert::IsTrue(bucketCollisions < expectedBucketCollisions * 1.1);
 		}
 
 		TEST_METHOD(IntegerHash)
@@ -1,10 +1,16 @@
 #include "pch.h"
 #include "CppUnitTest.h"
 #include "Event.h"
+#include "EventPool.h"
 #include "FooSubscriber.h"
 #include "EventQueue.h"
 #include "GameClock.h"
 #include "Foo.h"
+#include "GameObject.h"
+#include "ActionEvent.h"
+#include "JobSystem.h"
+#include <atomic>
+#include <thread>
 
 using namespace Microsoft::VisualStudio::CppUnitTestFramework;
 using namespace FieaGameEngine;
@@ -13,6 +19,21 @@ using namespace std;
 
 namespace LibraryDesktopTests
 {
+	/// <summary>
+	/// Records the "Id" argument of every ReactionMessageAttributed event it is notified of, in delivery order.
+	/// </summary>
+	struct DeliveryRecorder final : public IEventSubscriber
+	{
+		void Notify(IEventPublisher* eventPublisher) override
+		{
+			assert(eventPublisher->Is(Event<ReactionMessageAttributed>::TypeIdClass()));
+			Event<ReactionMessageAttributed>* reactionEvent = static_cast<Event<ReactionMessageAttributed>*>(eventPublisher);
+			Delivered.PushBack(reactionEvent->Message().Find("Id"s)->Get<int32_t>());
+		}
+
+		Vector<int32_t> Delivered;
+	};
+
 	TEST_CLASS(EventTests)
 	{
 	public:
@@ -53,6 +74,55 @@ namespace LibraryDesktopTests
 			Assert::AreEqual(15, fooSubscriber.Count);
 		}
 
+		TEST_METHOD(Channels)
+		{
+			FooSubscriber everyFoo;
+			FooSubscriber channelFoo;
+			Event<Foo>::Subscribe(&everyFoo);
+			Event<Foo>::Subscribe(&channelFoo, 3);
+			Event<Foo>::Subscribe(&channelFoo, 3);
+
+			// Subscribers are kept per message type.
+			Assert::AreEqual(size_t(0), Event<int>::SubscriberCount());
+			Assert::AreEqual(size_t(1), Event<Foo>::SubscriberCount());
+			Assert::AreEqual(size_t(2), Event<Foo>::SubscriberCount(3));
+			Assert::AreEqual(size_t(1), Event<Foo>::SubscriberCount(4));
+
+			int value = 4;
+			Event<int> intEvent{ value };
+			intEvent.Deliver();
+			Assert::AreEqual(0, everyFoo.Count);
+			Assert::AreEqual(0, channelFoo.Count);
+
+			Foo foo{ 5 };
+			Event<Foo> unchanneled{ foo };
+			unchanneled.Deliver();
+			Assert::AreEqual(5, everyFoo.Count);
+			Assert::AreEqual(0, channelFoo.Count);
+
+			Event<Foo> otherChannel{ foo, 4 };
+			otherChannel.Deliver();
+			Assert::AreEqual(10, everyFoo.Count);
+			Assert::AreEqual(0, channelFoo.Count);
+
+			Event<Foo> channeled{ foo, 3 };
+			channeled.Deliver();
+			Assert::AreEqual(15, everyFoo.Count);
+			Assert::AreEqual(5, channelFoo.Count);
+
+			Event<Foo>::Unsubscribe(&channelFoo, 4);
+			Event<Foo>::Unsubscribe(&channelFoo, 3);
+			Assert::AreEqual(size_t(1), Event<Foo>::SubscriberCount(3));
+			channeled.Deliver();
+			Assert::AreEqual(20, everyFoo.Count);
+			Assert::AreEqual(5, channelFoo.Count);
+
+			Event<Foo>::Subscribe(&channelFoo, 3);
+			Event<Foo>::UnsubscribeAll();
+			Assert::AreEqual(size_t(0), Event<Foo>::SubscriberCount(3));
+			Assert::ExpectException<runtime_error>([]() { Event<Foo>::Subscribe(nullptr, 3); });
+		}
+
 		TEST_METHOD(EventQueueUpdate)
 		{
 			GameClock gameClock;
@@ -85,7 +155,407 @@ namespace LibraryDesktopTests
 			Event<Foo>::Unsubscribe(&fooSubscriber);
 		}
 
+		TEST_METHOD(ScheduleAndCancel)
+		{
+			GameTime gameTime;
+			FooSubscriber fooSubscriber;
+			Event<Foo>::Subscribe(&fooSubscriber);
+			EventQueue eventQueue;
+			const auto start = gameTime.CurrentTime();
+
+			Foo foo1{ 1 };
+			Foo foo2{ 2 };
+			Foo foo3{ 3 };
+			Foo foo4{ 4 };
+			EventQueue::Handle handle3 = eventQueue.Enqueue(make_shared<Event<Foo>>(foo3), gameTime, 300ms);
+			EventQueue::Handle handle1 = eventQueue.Enqueue(make_shared<Event<Foo>>(foo1), gameTime, 100ms);
+			EventQueue::Handle handle2 = eventQueue.Enqueue(make_shared<Event<Foo>>(foo2), gameTime, 200ms);
+			eventQueue.Enqueue(make_shared<Event<Foo>>(foo4), gameTime, 400ms);
+			Assert::IsTrue(handle1.IsValid());
+			Assert::IsFalse(EventQueue::Handle{}.IsValid());
+			Assert::IsFalse(handle1 == handle3);
+			Assert::IsFalse(eventQueue.Cancel(EventQueue::Handle{}));
+
+			// Events can be cancelled before and after they are merged.
+			Assert::IsTrue(eventQueue.Cancel(handle2));
+			Assert::IsFalse(eventQueue.Cancel(handle2));
+			Assert::AreEqual(size_t(3), eventQueue.Size());
+
+			gameTime.SetCurrentTime(start + 50ms);
+			eventQueue.Update(gameTime);
+			Assert::IsTrue(fooSubscriber.Received.IsEmpty());
+
+			gameTime.SetCurrentTime(start + 350ms);
+			eventQueue.Update(gameTime);
+			Assert::AreEqual(size_t(2), fooSubscriber.Received.Size());
+			Assert::AreEqual(1, fooSubscriber.Received[0]);
+			Assert::AreEqual(3, fooSubscriber.Received[1]);
+			Assert::IsFalse(eventQueue.Cancel(handle1));
+			Assert::IsFalse(eventQueue.Cancel(handle3));
+			Assert::AreEqual(size_t(1), eventQueue.Size());
+
+			// An event that is still referenced is requeued each time it is published, until it is cancelled.
+			Foo foo10{ 10 };
+			shared_ptr<Event<Foo>> periodicEvent = make_shared<Event<Foo>>(foo10);
+			EventQueue::Handle periodicHandle = eventQueue.Enqueue(periodicEvent, gameTime, 100ms);
+			gameTime.SetCurrentTime(start + 450ms);
+			eventQueue.Update(gameTime);
+			Assert::AreEqual(size_t(4), fooSubscriber.Received.Size());
+			Assert::AreEqual(4, fooSubscriber.Received[2]);
+			Assert::AreEqual(10, fooSubscriber.Received[3]);
+			Assert::AreEqual(size_t(1), eventQueue.Size());
+
+			gameTime.SetCurrentTime(start + 550ms);
+			eventQueue.Update(gameTime);
+			Assert::AreEqual(size_t(5), fooSubscriber.Received.Size());
+			Assert::IsTrue(eventQueue.Cancel(periodicHandle));
+			Assert::IsTrue(eventQueue.IsEmpty());
+			gameTime.SetCurrentTime(start + 1000ms);
+			eventQueue.Update(gameTime);
+			Assert::AreEqual(size_t(5), fooSubscriber.Received.Size());
+
+			// Published late, a repeating event is next due one delay after that Update, unless the queue is deterministic.
+			for (bool isDeterministic : { false, true })
+			{
+				eventQueue.SetDeterministic(isDeterministic);
+				gameTime.SetCurrentTime(start + 1000ms);
+				periodicHandle = eventQueue.Enqueue(periodicEvent, gameTime, 100ms);
+				gameTime.SetCurrentTime(start + 1180ms);
+				eventQueue.Update(gameTime);
+				const size_t received = fooSubscriber.Received.Size();
+				gameTime.SetCurrentTime(start + 1250ms);
+				eventQueue.Update(gameTime);
+				Assert::AreEqual(isDeterministic ? received + 1 : received, fooSubscriber.Received.Size());
+				gameTime.SetCurrentTime(start + 1280ms);
+				eventQueue.Update(gameTime);
+				Assert::AreEqual(received + 1, fooSubscriber.Received.Size());
+				Assert::IsTrue(eventQueue.Cancel(periodicHandle));
+			}
+			eventQueue.SetDeterministic(false);
+			periodicEvent.reset();
+
+			// However they were enqueued, events that come due together are published in deadline order.
+			fooSubscriber.Received.Clear();
+			Vector<EventQueue::Handle> handles;
+			uint32_t seed = 12345;
+			for (int32_t i = 0; i < 1000; ++i)
+			{
+				seed = seed * 1664525u + 1013904223u;
+				Foo foo{ int32_t(seed % 500) };
+				handles.PushBack(eventQueue.Enqueue(make_shared<Event<Foo>>(foo), gameTime, chrono::milliseconds{ foo.Data() }));
+			}
+			for (size_t i = 0; i < handles.Size(); i += 3)
+				Assert::IsTrue(eventQueue.Cancel(handles[i]));
+			Assert::AreEqual(size_t(666), eventQueue.Size());
+
+			gameTime.SetCurrentTime(start + 2000ms);
+			eventQueue.Update(gameTime);
+			Assert::IsTrue(eventQueue.IsEmpty());
+			Assert::AreEqual(size_t(666), fooSubscriber.Received.Size());
+			for (size_t i = 1; i < fooSubscriber.Received.Size(); ++i)
+				Assert::IsTrue(fooSubscriber.Received[i - 1] <= fooSubscriber.Received[i]);
+
+			Event<Foo>::Unsubscribe(&fooSubscriber);
+		}
+
+		TEST_METHOD(ConcurrentEnqueue)
+		{
+#if defined(DEBUG) || defined(_DEBUG)
+			const size_t eventsPerThread = 500;
+#else
+			const size_t eventsPerThread = 5000;
+#endif
+			const size_t threadCount = 8;
+			const size_t eventCount = threadCount * eventsPerThread;
+
+			GameTime gameTime;
+			FooSubscriber fooSubscriber;
+			Event<Foo>::Subscribe(&fooSubscriber);
+			EventQueue eventQueue;
+
+			// Even threads enqueue directly and odd threads merge a Batch every few events, all racing each other.
+			{
+				atomic<bool> start{ false };
+				Vector<thread> threads;
+				for (size_t t = 0; t < threadCount; ++t)
+				{
+					threads.EmplaceBack([&eventQueue, &gameTime, &start, t, eventsPerThread]()
+					{
+						while (!start)
+							this_thread::yield();
+
+						EventQueue::Batch batch;
+						for (size_t i = 0; i < eventsPerThread; ++i)
+						{
+							Foo foo{ int32_t(t * eventsPerThread + i) };
+							if (t % 2 == 0)
+								eventQueue.Enqueue(make_shared<Event<Foo>>(foo), gameTime);
+							else
+							{
+								{
+									EventQueue::BatchScope batchScope{ eventQueue, batch };
+									eventQueue.Enqueue(make_shared<Event<Foo>>(foo), gameTime);
+								}
+								if (batch.Size() == 7 || i == eventsPerThread - 1)
+									eventQueue.Merge(batch);
+							}
+						}
+						Assert::IsTrue(batch.IsEmpty());
+					});
+				}
+				start = true;
+				for (thread& producer : threads)
+					producer.join();
+			}
+
+			Assert::AreEqual(eventCount, eventQueue.Size());
+			eventQueue.Update(gameTime);
+			Assert::IsTrue(eventQueue.IsEmpty());
+			Assert::AreEqual(eventCount, fooSubscriber.Received.Size());
+
+			// Nothing is lost or duplicated, and each thread's events arrive in the order it enqueued them.
+			Vector<size_t> nextPerThread(threadCount);
+			for (size_t t = 0; t < threadCount; ++t)
+				nextPerThread.PushBack(0);
+			for (int32_t value : fooSubscriber.Received)
+			{
+				const size_t t = size_t(value) / eventsPerThread;
+				Assert::AreEqual(nextPerThread[t], size_t(value) % eventsPerThread);
+				++nextPerThread[t];
+			}
+
+			// With a Batch per thread merged in a fixed order, delivery is the same as if one thread had enqueued everything.
+			fooSubscriber.Received.Clear();
+			{
+				Vector<EventQueue::Batch> batches{ threadCount };
+				for (size_t t = 0; t < threadCount; ++t)
+					batches.EmplaceBack();
+
+				Vector<thread> threads;
+				for (size_t t = 0; t < threadCount; ++t)
+				{
+					threads.EmplaceBack([&eventQueue, &gameTime, &batches, t, eventsPerThread]()
+					{
+						EventQueue::BatchScope batchScope{ eventQueue, batches[t] };
+						for (size_t i = 0; i < eventsPerThread; ++i)
+						{
+							Foo foo{ int32_t(t * eventsPerThread + i) };
+							eventQueue.Enqueue(make_shared<Event<Foo>>(foo), gameTime);
+						}
+					});
+				}
+				for (thread& producer : threads)
+					producer.join();
+
+				Assert::IsTrue(eventQueue.IsEmpty());
+				for (EventQueue::Batch& batch : batches)
+					eventQueue.Merge(batch);
+			}
+
+			eventQueue.Update(gameTime);
+			Assert::AreEqual(eventCount, fooSubscriber.Received.Size());
+			for (size_t i = 0; i < eventCount; ++i)
+				Assert::AreEqual(int32_t(i), fooSubscriber.Received[i]);
+
+			// Producers take pending nodes while the owning thread keeps updating and handing them back, so both ends of the free list race.
+			fooSubscriber.Received.Clear();
+			{
+				atomic<size_t> finished{ 0 };
+				Vector<thread> threads;
+				for (size_t t = 0; t < threadCount; ++t)
+				{
+					threads.EmplaceBack([&eventQueue, &gameTime, &finished, t, eventsPerThread]()
+					{
+						for (size_t i = 0; i < eventsPerThread; ++i)
+						{
+							Foo foo{ int32_t(t * eventsPerThread + i) };
+							eventQueue.Enqueue(make_shared<Event<Foo>>(foo), gameTime);
+						}
+						++finished;
+					});
+				}
+				while (finished < threadCount)
+					eventQueue.Update(gameTime);
+				for (thread& producer : threads)
+					producer.join();
+				eventQueue.Update(gameTime);
+			}
+
+			Assert::AreEqual(eventCount, fooSubscriber.Received.Size());
+			for (size_t t = 0; t < threadCount; ++t)
+				nextPerThread[t] = 0;
+			for (int32_t value : fooSubscriber.Received)
+			{
+				const size_t t = size_t(value) / eventsPerThread;
+				Assert::AreEqual(nextPerThread[t], size_t(value) % eventsPerThread);
+				++nextPerThread[t];
+			}
+
+			Event<Foo>::Unsubscribe(&fooSubscriber);
+		}
+
+		TEST_METHOD(Pooling)
+		{
+			FooSubscriber fooSubscriber;
+			Event<Foo>::Subscribe(&fooSubscriber, 2);
+
+			EventQueue eventQueue;
+			GameTime gameTime;
+			const auto start = gameTime.CurrentTime();
+			shared_ptr<EventPool<Foo>> eventPool = EventPool<Foo>::Create();
+			Assert::AreEqual(size_t(0), eventPool->CreatedCount());
+
+			// Each frame fires one event due now and one due two frames later, so from the third frame on the pool covers the four events in flight.
+			int32_t expected = 0;
+			for (int32_t frame = 0; frame < 10; ++frame)
+			{
+				gameTime.SetCurrentTime(start + chrono::milliseconds{ frame * 100 });
+				for (int32_t delay : { 0, 200 })
+				{
+					shared_ptr<Event<Foo>> fooEvent = eventPool->Acquire([]() { return Foo{}; }, 2);
+					fooEvent->Message().SetData(frame + 1);
+					eventQueue.Enqueue(std::move(fooEvent), gameTime, chrono::milliseconds{ delay });
+				}
+
+				eventQueue.Update(gameTime);
+				expected += frame + 1;
+				if (frame >= 2)
+					expected += frame - 1;
+				Assert::AreEqual(expected, fooSubscriber.Count);
+				Assert::AreEqual(frame < 2 ? size_t(frame + 2) : size_t(4), eventPool->CreatedCount());
+			}
+			Assert::AreEqual(size_t(2), eventPool->IdleCount());
+
+			// Events keep their pool alive, so it may be dropped while they are still queued.
+			shared_ptr<Event<Foo>> fooEvent = eventPool->Acquire([]() { return Foo{}; }, 2);
+			Assert::AreEqual(size_t(1), eventPool->IdleCount());
+			eventQueue.Enqueue(std::move(fooEvent), gameTime, 1000ms);
+			eventPool.reset();
+			gameTime.SetCurrentTime(start + 5000ms);
+			eventQueue.Update(gameTime);
+			Assert::IsTrue(eventQueue.IsEmpty());
+			Event<Foo>::Unsubscribe(&fooSubscriber, 2);
+
+			// ActionEvent recycles its events, refreshing the arguments of the messages it reuses.
+			DeliveryRecorder recorder;
+			Event<ReactionMessageAttributed>::Subscribe(&recorder);
+			GameState gameState{ eventQueue, gameTime };
+			ActionEvent actionEvent;
+			actionEvent.Find("Delay"s)->Set(0);
+			actionEvent.AppendAuxiliaryAttribute("Id"s).PushBack(0);
+			for (int32_t frame = 0; frame < 4; ++frame)
+			{
+				actionEvent.Find("Id"s)->Set(frame);
+				actionEvent.Update(gameState);
+				eventQueue.Update(gameTime);
+			}
+			Assert::IsTrue(recorder.Delivered == Vector<int32_t>{ 0, 1, 2, 3 });
+			Event<ReactionMessageAttributed>::Unsubscribe(&recorder);
+		}
+
+		TEST_METHOD(DeterministicReplay)
+		{
+			// Identical inputs must produce identical delivery orders, whether the world is updated serially or in parallel.
+			const Vector<int32_t> serial = Replay(0);
+			Assert::AreEqual(size_t(6 * 40), serial.Size());
+			Assert::IsTrue(serial == Replay(0));
+			for (size_t run = 0; run < 3; ++run)
+				Assert::IsTrue(serial == Replay(4));
+
+			// Events come out by deadline, and events sharing a deadline in the order they were enqueued: by frame, then by update order.
+			auto deadline = [](int32_t id) { return (id / 1000) * 50 + (id % 10) * 100; };
+			for (size_t i = 1; i < serial.Size(); ++i)
+			{
+				const int32_t previous = serial[i - 1];
+				const int32_t current = serial[i];
+				Assert::IsTrue(deadline(previous) < deadline(current) || (deadline(previous) == deadline(current) && previous < current));
+			}
+
+			EventQueue eventQueue;
+			Assert::IsFalse(eventQueue.IsDeterministic());
+			eventQueue.SetDeterministic(true);
+			Assert::IsTrue(eventQueue.IsDeterministic());
+
+			GameTime gameTime;
+			Foo foo{ 1 };
+			eventQueue.Enqueue(make_shared<Event<Foo>>(foo), gameTime);
+			thread producer{ [&eventQueue, &gameTime, &foo]()
+			{
+				Assert::ExpectException<runtime_error>([&eventQueue, &gameTime, &foo]() { eventQueue.Enqueue(make_shared<Event<Foo>>(foo), gameTime); });
+
+				EventQueue::Batch batch;
+				{
+					EventQueue::BatchScope batchScope{ eventQueue, batch };
+					eventQueue.Enqueue(make_shared<Event<Foo>>(foo), gameTime);
+				}
+				Assert::ExpectException<runtime_error>([&eventQueue, &batch]() { eventQueue.Merge(batch); });
+			} };
+			producer.join();
+			Assert::AreEqual(size_t(1), eventQueue.Size());
+		}
+
 	private:
+		/// <summary>
+		/// Runs six frames of a world of 40 GameObjects, each firing an event every frame with one of four delays, and records the delivery order.
+		/// Each event carries frame * 1000 + object * 10 + delay / 100 as its "Id", with objects numbered in update order.
+		/// </summary>
+		static Vector<int32_t> Replay(size_t workerCount)
+		{
+			EventQueue eventQueue;
+			eventQueue.SetDeterministic(true);
+			GameTime gameTime;
+			GameState gameState{ eventQueue, gameTime };
+			JobSystem jobSystem{ workerCount };
+			if (workerCount > 0)
+				gameState.SetJobSystem(&jobSystem);
+
+			DeliveryRecorder recorder;
+			Event<ReactionMessageAttributed>::Subscribe(&recorder);
+
+			// Numbered in the order they update in, which is children before their parent.
+			Vector<ActionEvent*> actionEvents;
+			auto createObject = [&actionEvents]()
+			{
+				GameObject* object = new GameObject{};
+				ActionEvent* actionEvent = new ActionEvent{};
+				actionEvent->Find("Delay"s)->Set(((int32_t(actionEvents.Size()) * 7) % 4) * 100);
+				actionEvent->AppendAuxiliaryAttribute("Id"s).PushBack(0);
+				object->Adopt(*actionEvent, "Actions"s);
+				actionEvents.PushBack(actionEvent);
+				return object;
+			};
+
+			GameObject world;
+			for (size_t i = 0; i < 8; ++i)
+			{
+				Vector<GameObject*> children;
+				for (size_t j = 0; j < 4; ++j)
+					children.PushBack(createObject());
+
+				GameObject* parent = createObject();
+				for (GameObject* child : children)
+					parent->Adopt(*child, "Children"s);
+				world.Adopt(*parent, "Children"s);
+			}
+
+			const auto start = gameTime.CurrentTime();
+			for (int32_t frame = 0; frame < 6; ++frame)
+			{
+				for (size_t i = 0; i < actionEvents.Size(); ++i)
+					actionEvents[i]->Find("Id"s)->Set(frame * 1000 + int32_t(i) * 10 + actionEvents[i]->Find("Delay"s)->Get<int32_t>() / 100);
+
+				gameTime.SetCurrentTime(start + chrono::milliseconds{ frame * 50 });
+				world.Update(gameState);
+				eventQueue.Update(gameTime);
+			}
+			gameTime.SetCurrentTime(start + 1000ms);
+			eventQueue.Update(gameTime);
+			Assert::IsTrue(eventQueue.IsEmpty());
+
+			Event<ReactionMessageAttributed>::Unsubscribe(&recorder);
+			return std::move(recorder.Delivered);
+		}
+
 		inline static _CrtMemState _startMemState;
 	};
 }
\ No newline at end of file
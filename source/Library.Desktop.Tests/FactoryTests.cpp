@@ -5,6 +5,8 @@
 #include "AttributedFoo.h"
 #include "AttributedBar.h"
 #include "TableParseHelper.h"
+#include "ArenaAllocator.h"
+#include "Foo.h"
 #include <memory>
 
 using namespace Microsoft::VisualStudio::CppUnitTestFramework;
@@ -14,6 +16,8 @@ using namespace FieaGameEngine;
 
 namespace LibraryDesktopTests
 {
+	ConcreteFactory(Foo, RTTI);
+
 	TEST_CLASS(FactoryTests)
 	{
 	public:
@@ -102,6 +106,25 @@ namespace LibraryDesktopTests
 			delete(concreteScope);
 		}
 
+		TEST_METHOD(CreateWithAllocator)
+		{
+			ArenaAllocator arena;
+			{
+				AttributedFooFactory attributedFooFactory;
+				Scope* scope = Factory<Scope>::Create("AttributedFoo"s, arena);
+				Assert::IsNotNull(scope);
+				Assert::IsTrue(&scope->GetAllocator() == &arena);
+				delete scope;
+			}
+
+			// A product that is not a Scope goes through the generic factory, which creates it as usual whatever the allocator.
+			FooFactory fooFactory;
+			RTTI* foo = Factory<RTTI>::Create("Foo"s, arena);
+			Assert::IsNotNull(foo);
+			Assert::IsTrue(foo->Is(Foo::TypeIdClass()));
+			delete foo;
+		}
+
 	private:
 		inline static _CrtMemState _startMemState;
 	};
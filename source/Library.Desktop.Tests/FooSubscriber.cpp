@@ -13,6 +13,7 @@ namespace UnitTests
 		{
 			Event<Foo>* event = static_cast<Event<Foo>*>(eventPublisher);
 			Count += event->Message().Data();
+			Received.PushBack(event->Message().Data());
 		}
 	}
 }
\ No newline at end of file
@@ -1,6 +1,7 @@
 #pragma once
 #include "IEventSubscriber.h"
 #include "IEventPublisher.h"
+#include "Vector.h"
 
 namespace UnitTests
 {
@@ -10,5 +11,6 @@ namespace UnitTests
 
 	public:
 		int Count{ 0 };
+		FieaGameEngine::Vector<std::int32_t> Received;
 	};
 }
\ No newline at end of file
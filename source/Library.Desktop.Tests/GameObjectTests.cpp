@@ -136,6 +136,205 @@ namespace LibraryDesktopTests
 			Assert::AreEqual("Random Name"s, gameObject.GetActions()[0].As<ActionIncrement>()->Name);
 		}
 
+		TEST_METHOD(TransformStorage)
+		{
+			GameObject root;
+			root.Transform.Position = glm::vec4{ 1.0f };
+			Monster* child = new Monster{};
+			child->Transform.Scale = glm::vec4{ 2.0f };
+			root.Adopt(*child, "Children");
+
+			{
+				TransformStore store;
+				store.Attach(root);
+				Assert::AreEqual(size_t(2), store.Size());
+				Assert::IsTrue(root.GetTransformStore() == &store);
+				Assert::IsTrue(child->GetTransformStore() == &store);
+				Assert::IsTrue(glm::vec4{ 1.0f } == store.Positions()[0]);
+				Assert::IsTrue(glm::vec4{ 2.0f } == store.Scales()[1]);
+
+				for (glm::vec4& position : store.Positions())
+					position.x += 10.0f;
+				Assert::AreEqual(11.0f, root["Position"s].Get<glm::vec4>().x);
+				Assert::AreEqual(10.0f, (*child)["Position"s].Get<glm::vec4>().x);
+				Assert::IsTrue(&root["Position"s].Get<glm::vec4>() == &root.GetPosition());
+
+				root["Rotation"s] = glm::vec4{ 3.0f };
+				Assert::IsTrue(glm::vec4{ 3.0f } == store.Rotations()[0]);
+
+				GameObject* clone = root.Clone();
+				Assert::AreEqual(size_t(4), store.Size());
+				Assert::IsTrue(glm::vec4{ 3.0f } == clone->GetRotation());
+				clone->GetRotation() = glm::vec4{ 4.0f };
+				Assert::IsTrue(glm::vec4{ 3.0f } == root.GetRotation());
+				delete clone;
+				Assert::AreEqual(size_t(2), store.Size());
+
+				store.Reserve(64);
+				Assert::IsTrue(&(*child)["Scale"s].Get<glm::vec4>() == &store.Scales()[1]);
+
+				GameObject moved{ std::move(root) };
+				Assert::AreEqual(size_t(2), store.Size());
+				Assert::IsTrue(store.Owners()[0] == &moved);
+				Assert::IsNull(root.GetTransformStore());
+				Assert::AreEqual(11.0f, moved["Position"s].Get<glm::vec4>().x);
+
+				store.Detach(*child);
+				Assert::AreEqual(size_t(1), store.Size());
+				Assert::AreEqual(10.0f, child->Transform.Position.x);
+				Assert::IsTrue(&(*child)["Position"s].Get<glm::vec4>() == &child->Transform.Position);
+
+				root = std::move(moved);
+			}
+
+			Assert::IsNull(root.GetTransformStore());
+			Assert::AreEqual(11.0f, root.Transform.Position.x);
+			Assert::IsTrue(glm::vec4{ 3.0f } == root["Rotation"s].Get<glm::vec4>());
+		}
+
+		TEST_METHOD(WorldTransform)
+		{
+			GameObject root;
+			root.SetScale(glm::vec4{ 2.0f, 2.0f, 2.0f, 0.0f });
+			Vector<GameObject*> chain;
+			for (int32_t i = 0; i < 12; ++i)
+			{
+				GameObject* gameObject = new GameObject{};
+				gameObject->SetScale(glm::vec4{ 1.0f, 1.0f, 1.0f, 0.0f });
+				gameObject->SetPosition(glm::vec4{ 1.0f, 0.0f, 0.0f, 0.0f });
+				chain.PushBack(gameObject);
+			}
+			// Built from the bottom up, so that each adopting GameObject has no parent yet.
+			for (size_t i = chain.Size() - 1; i > 0; --i)
+				chain[i - 1]->Adopt(*chain[i], "Children"s);
+			root.Adopt(*chain[0], "Children"s);
+			GameObject* sibling = new GameObject{};
+			sibling->SetScale(glm::vec4{ 1.0f });
+			root.Adopt(*sibling, "Children"s);
+
+			GameObject& leaf = *chain.Back();
+			Assert::IsTrue(glm::vec4{ 24.0f, 0.0f, 0.0f, 1.0f } == leaf.GetWorldTransform() * glm::vec4{ 0.0f, 0.0f, 0.0f, 1.0f });
+			Assert::IsTrue(leaf["WorldTransform"s].Get<glm::mat4>() == leaf.GetWorldTransform());
+			for (GameObject* gameObject : chain)
+				Assert::IsFalse(gameObject->IsTransformDirty());
+			Assert::IsTrue(sibling->IsTransformDirty());
+			sibling->GetWorldTransform();
+
+			// Only the subtree under the change goes dirty.
+			chain[5]->SetRotation(glm::vec4{ 0.0f, 90.0f, 0.0f, 0.0f });
+			Assert::IsFalse(chain[4]->IsTransformDirty());
+			Assert::IsFalse(sibling->IsTransformDirty());
+			Assert::IsTrue(chain[5]->IsTransformDirty());
+			Assert::IsTrue(leaf.IsTransformDirty());
+
+			const glm::vec4 leafPosition = leaf.GetWorldTransform() * glm::vec4{ 0.0f, 0.0f, 0.0f, 1.0f };
+			Assert::AreEqual(12.0f, leafPosition.x, 1e-4f);
+			Assert::AreEqual(0.0f, leafPosition.y, 1e-4f);
+			Assert::AreEqual(-12.0f, leafPosition.z, 1e-4f);
+			Assert::IsFalse(chain[5]->IsTransformDirty());
+
+			// Writes through the attributes are picked up without a mark.
+			root["Position"s] = glm::vec4{ 0.0f, 5.0f, 0.0f, 0.0f };
+			Assert::AreEqual(5.0f, (leaf.GetWorldTransform() * glm::vec4{ 0.0f, 0.0f, 0.0f, 1.0f }).y, 1e-4f);
+
+			// Moving a GameObject under another parent is picked up on its next request.
+			GameObject newRoot;
+			newRoot.SetScale(glm::vec4{ 1.0f });
+			newRoot.SetPosition(glm::vec4{ 0.0f, 0.0f, 100.0f, 0.0f });
+			newRoot.GetWorldTransform();
+			Assert::IsFalse(chain[0]->IsTransformDirty());
+			newRoot.Adopt(*chain[0], "Children"s);
+			Assert::IsTrue(glm::vec4{ 1.0f, 0.0f, 100.0f, 1.0f } == chain[0]->GetWorldTransform() * glm::vec4{ 0.0f, 0.0f, 0.0f, 1.0f });
+			Assert::IsTrue(chain[1]->IsTransformDirty());
+
+			EventQueue eventQueue;
+			GameTime gameTime;
+			GameState gameState{ eventQueue, gameTime };
+			chain[3]->SetPosition(glm::vec4{ 0.0f });
+			newRoot.Update(gameState);
+			Assert::IsFalse(leaf.IsTransformDirty());
+		}
+
+		TEST_METHOD(WorldTransformUnmarkedWrites)
+		{
+			GameObject root;
+			root.SetScale(glm::vec4{ 1.0f });
+			GameObject* child = new GameObject{};
+			child->SetScale(glm::vec4{ 1.0f });
+			child->SetPosition(glm::vec4{ 1.0f, 0.0f, 0.0f, 0.0f });
+			root.Adopt(*child, "Children"s);
+			Assert::IsTrue(glm::vec4{ 1.0f, 0.0f, 0.0f, 1.0f } == child->GetWorldTransform() * glm::vec4{ 0.0f, 0.0f, 0.0f, 1.0f });
+
+			// Datum::Set on the parent, then only the child is asked.
+			root["Position"s].Set(glm::vec4{ 0.0f, 0.0f, 3.0f, 0.0f });
+			Assert::IsTrue(glm::vec4{ 1.0f, 0.0f, 3.0f, 1.0f } == child->GetWorldTransform() * glm::vec4{ 0.0f, 0.0f, 0.0f, 1.0f });
+			Assert::IsTrue((*child)["WorldTransform"s].Get<glm::mat4>() == child->GetWorldTransform());
+
+			// Writing the TransformStore arrays in place, as a bulk kernel would, going through Update.
+			EventQueue eventQueue;
+			GameTime gameTime;
+			GameState gameState{ eventQueue, gameTime };
+			{
+				TransformStore store;
+				store.Attach(root);
+				for (glm::vec4& scale : store.Scales())
+					scale = glm::vec4{ 2.0f, 2.0f, 2.0f, 0.0f };
+				root.Update(gameState);
+				Assert::IsTrue(glm::vec4{ 2.0f, 0.0f, 3.0f, 1.0f } == child->GetWorldTransform() * glm::vec4{ 0.0f, 0.0f, 0.0f, 1.0f });
+				Assert::IsTrue((*child)["WorldTransform"s].Get<glm::mat4>() == child->GetWorldTransform());
+			}
+		}
+
+		TEST_METHOD(WorldTransformHandedDown)
+		{
+			const size_t depth = 64;
+			GameObject root;
+			root.SetScale(glm::vec4{ 1.0f });
+			Vector<GameObject*> chain;
+			for (size_t i = 0; i < depth; ++i)
+			{
+				GameObject* gameObject = new GameObject{};
+				gameObject->SetScale(glm::vec4{ 1.0f });
+				gameObject->SetPosition(glm::vec4{ 1.0f, 0.0f, 0.0f, 0.0f });
+				chain.PushBack(gameObject);
+			}
+			for (size_t i = chain.Size() - 1; i > 0; --i)
+				chain[i - 1]->Adopt(*chain[i], "Children"s);
+			root.Adopt(*chain[0], "Children"s);
+
+			EventQueue eventQueue;
+			GameTime gameTime;
+			GameState gameState{ eventQueue, gameTime };
+			auto totalChecks = [&root, &chain]()
+			{
+				size_t checks = root.WorldTransformCheckCount();
+				for (GameObject* gameObject : chain)
+					checks += gameObject->WorldTransformCheckCount();
+				return checks;
+			};
+
+			// One Update checks every GameObject once, rather than each walking up to the root.
+			root.Update(gameState);
+			Assert::AreEqual(depth + 1, totalChecks());
+			Assert::IsTrue(glm::vec4{ float(depth), 0.0f, 0.0f, 1.0f } == chain.Back()->GetWorldTransform() * glm::vec4{ 0.0f, 0.0f, 0.0f, 1.0f });
+
+			// A write part-way down, even one that bypasses the setters, still reaches the leaf within the same single pass.
+			(*chain[depth / 2])["Position"s] = glm::vec4{ 0.0f, 1.0f, 0.0f, 0.0f };
+			const size_t before = totalChecks();
+			root.Update(gameState);
+			Assert::AreEqual(depth + 1, totalChecks() - before);
+			const glm::vec4 leafPosition = chain.Back()->GetWorldTransform() * glm::vec4{ 0.0f, 0.0f, 0.0f, 1.0f };
+			Assert::AreEqual(float(depth - 1), leafPosition.x, 1e-4f);
+			Assert::AreEqual(1.0f, leafPosition.y, 1e-4f);
+
+			// Updating from part-way down still has to walk up once, for the ancestors nobody handed it.
+			chain[depth / 2]->SetPosition(glm::vec4{ 1.0f, 0.0f, 0.0f, 0.0f });
+			const size_t beforeSubtree = totalChecks();
+			chain[depth / 2]->Update(gameState);
+			Assert::AreEqual(depth + 1, totalChecks() - beforeSubtree);
+			Assert::IsTrue(glm::vec4{ float(depth), 0.0f, 0.0f, 1.0f } == chain.Back()->GetWorldTransform() * glm::vec4{ 0.0f, 0.0f, 0.0f, 1.0f });
+		}
+
 	private:
 		inline static _CrtMemState _startMemState;
 	};
@@ -77,7 +77,7 @@ namespace LibraryDesktopTests
 				HashMap<Foo, Foo> map;
 				Assert::AreEqual(size_t(11), map.Capacity());
 				Assert::AreEqual(size_t(0), map.Size());
-				Assert::AreEqual(size_t(0), map.LoadFactor());
+				Assert::AreEqual(0.0f, map.LoadFactor());
 			}
 
 			//Initializer list constructor
@@ -303,6 +303,55 @@ namespace LibraryDesktopTests
 			Assert::AreEqual(size_t(1), map.Size());
 		}
 
+		TEST_METHOD(RemoveWithCollisions)
+		{
+			Foo a{ 1 };
+			Foo b{ 11 };
+			Foo c{ 21 };
+			Foo d{ 2 };
+			Foo x{ 10 };
+			HashMap<Foo, Foo> map{ 10, FooHash{} };
+
+			map.Insert(make_pair(a, x));
+			map.Insert(make_pair(b, x));
+			map.Insert(make_pair(c, x));
+			map.Insert(make_pair(d, x));
+
+			Assert::IsTrue(map.Remove(b));
+			Assert::AreEqual(size_t(3), map.Size());
+			Assert::IsTrue(map.ContainsKey(a));
+			Assert::IsFalse(map.ContainsKey(b));
+			Assert::IsTrue(map.ContainsKey(c));
+			Assert::IsTrue(map.ContainsKey(d));
+			Assert::AreEqual(d, map.Find(d)->first);
+
+			Assert::IsTrue(map.Remove(a));
+			Assert::IsTrue(map.ContainsKey(c));
+			Assert::IsTrue(map.ContainsKey(d));
+
+			size_t count = 0;
+			for (const auto& pair : map)
+			{
+				Assert::IsTrue(pair.first == c || pair.first == d);
+				++count;
+			}
+			Assert::AreEqual(size_t(2), count);
+		}
+
+		TEST_METHOD(InsertBeyondCapacity)
+		{
+			HashMap<Foo, Foo> map{ 2, FooHash{} };
+
+			for (int32_t i = 0; i < 20; ++i)
+				Assert::IsTrue(map.Insert(make_pair(Foo{ i }, Foo{ i * 10 })).second);
+
+			Assert::AreEqual(size_t(20), map.Size());
+			Assert::IsTrue(map.Capacity() >= map.Size());
+			for (int32_t i = 0; i < 20; ++i)
+				Assert::AreEqual(Foo{ i * 10 }, map.At(Foo{ i }));
+			Assert::IsFalse(map.ContainsKey(Foo{ 20 }));
+		}
+
 		TEST_METHOD(Resize)
 		{
 			Foo a{ 1 };
@@ -315,19 +364,91 @@ namespace LibraryDesktopTests
 			map.Insert(make_pair(b, y));
 			size_t originalCapacity = map.Capacity();
 			size_t originalSize = map.Size();
-			size_t originalLoadFactor = map.LoadFactor();
+			float originalLoadFactor = map.LoadFactor();
+			Assert::AreEqual(float(originalSize) / float(originalCapacity), originalLoadFactor);
 
 			map.Resize(map.Capacity());
 			Assert::AreEqual(originalSize, map.Size());
 			Assert::AreEqual(originalCapacity, map.Capacity());
-			Assert::IsTrue(map.LoadFactor() <= originalLoadFactor);
+			Assert::AreEqual(originalLoadFactor, map.LoadFactor());
 
 			map.Resize(map.Capacity() + 10);
 			Assert::AreEqual(originalSize, map.Size());
-			Assert::IsTrue(map.LoadFactor() <= originalLoadFactor);
+			Assert::IsTrue(map.LoadFactor() < originalLoadFactor);
+			Assert::AreEqual(float(map.Size()) / float(map.Capacity()), map.LoadFactor());
 			Assert::IsTrue(map.Capacity() > originalCapacity);
 		}
 
+		TEST_METHOD(Reserve)
+		{
+			HashMap<Foo, Foo> map{ 2, FooHash{} };
+			map.Reserve(100);
+
+			size_t reservedCapacity = map.Capacity();
+			Assert::IsTrue(float(reservedCapacity) * map.MaxLoadFactor() >= 100.0f);
+
+			for (int32_t i = 0; i < 100; ++i)
+				map.Insert(make_pair(Foo{ i }, Foo{ i }));
+
+			Assert::AreEqual(size_t(100), map.Size());
+			Assert::AreEqual(reservedCapacity, map.Capacity());
+
+			map.Reserve(10);
+			Assert::AreEqual(reservedCapacity, map.Capacity());
+		}
+
+		TEST_METHOD(MaxLoadFactor)
+		{
+			HashMap<Foo, Foo> map{ 10, FooHash{} };
+			Assert::AreEqual(0.75f, map.MaxLoadFactor());
+
+			for (int32_t i = 0; i < 50; ++i)
+			{
+				map.Insert(make_pair(Foo{ i }, Foo{ i }));
+				Assert::IsTrue(float(map.Size()) <= float(map.Capacity()) * map.MaxLoadFactor());
+				Assert::IsTrue(map.LoadFactor() <= map.MaxLoadFactor());
+			}
+
+			map.SetMaxLoadFactor(0.25f);
+			Assert::IsTrue(map.Capacity() >= size_t(200));
+			Assert::IsTrue(map.LoadFactor() <= 0.25f);
+			for (int32_t i = 0; i < 50; ++i)
+				Assert::AreEqual(Foo{ i }, map.At(Foo{ i }));
+
+			Assert::ExpectException<std::runtime_error>([&map]() { map.SetMaxLoadFactor(0.0f); });
+			Assert::ExpectException<std::runtime_error>([&map]() { map.SetMaxLoadFactor(1.5f); });
+		}
+
+		TEST_METHOD(HeterogeneousLookup)
+		{
+			HashMap<string, int32_t> map{ 10 };
+			map.Insert(make_pair("Health"s, 10));
+			map.Insert(make_pair("Position"s, 20));
+
+			string_view health = "Health"sv;
+			HashMap<string, int32_t>::Iterator it = map.Find(health);
+			Assert::IsTrue(it != map.end());
+			Assert::AreEqual(10, it->second);
+			Assert::IsTrue(map.Find("Velocity"sv) == map.end());
+
+			Assert::IsTrue(map.ContainsKey("Position"sv));
+			Assert::IsFalse(map.ContainsKey("Velocity"sv));
+
+			map.At("Position"sv) = 30;
+			Assert::AreEqual(30, map.At("Position"s));
+			Assert::ExpectException<std::runtime_error>([&map]() { map.At("Velocity"sv); });
+
+			const HashMap<string, int32_t>& constMap = map;
+			Assert::IsTrue(constMap.Find("Health"sv) == constMap.Find("Health"s));
+			Assert::AreEqual(30, constMap.At("Position"sv));
+
+			Assert::IsFalse(map.Remove("Velocity"sv));
+			Assert::IsTrue(map.Remove(health));
+			Assert::IsFalse(map.ContainsKey("Health"s));
+			Assert::AreEqual(size_t(1), map.Size());
+			Assert::AreEqual(30, map.At("Position"sv));
+		}
+
 		TEST_METHOD(Clear)
 		{
 			const Foo a{ 1 };
@@ -344,7 +465,7 @@ namespace LibraryDesktopTests
 			map.Clear();
 			Assert::AreEqual(size_t(0), map.Size());
 			Assert::AreEqual(originalCapacity, map.Capacity());
-			Assert::AreEqual(size_t(0), map.LoadFactor());
+			Assert::AreEqual(0.0f, map.LoadFactor());
 
 		}
 
@@ -0,0 +1,146 @@
+#include "pch.h"
+#include "CppUnitTest.h"
+#include "IntrusiveList.h"
+#include <algorithm>
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+using namespace FieaGameEngine;
+using namespace std;
+
+namespace LibraryDesktopTests
+{
+	struct ActiveTag;
+	struct PriorityTag;
+
+	struct Subscriber final : public IntrusiveListHook<ActiveTag>, public IntrusiveListHook<PriorityTag>
+	{
+		explicit Subscriber(int id) : Id{ id } {}
+		int Id;
+	};
+
+	TEST_CLASS(IntrusiveListTests)
+	{
+	public:
+		TEST_METHOD_INITIALIZE(Initialize)
+		{
+#if defined(DEBUG) || defined(_DEBUG)
+			_CrtSetDbgFlag(_CRTDBG_ALLOC_MEM_DF);
+			_CrtMemCheckpoint(&_startMemState);
+#endif
+		}
+
+		TEST_METHOD_CLEANUP(Cleanup)
+		{
+#if defined(DEBUG) || defined(_DEBUG)
+			_CrtMemState endMemState, diffMemState;
+			_CrtMemCheckpoint(&endMemState);
+			if (_CrtMemDifference(&diffMemState, &_startMemState, &endMemState))
+			{
+				_CrtMemDumpStatistics(&diffMemState);
+				Assert::Fail(L"Memory Leaks!");
+			}
+#endif
+		}
+
+		TEST_METHOD(PushAndPop)
+		{
+			Subscriber a{ 1 }, b{ 2 }, c{ 3 };
+			IntrusiveList<Subscriber, ActiveTag> list;
+			Assert::IsTrue(list.IsEmpty());
+			Assert::ExpectException<runtime_error>([&list]() { list.PopFront(); });
+			Assert::ExpectException<runtime_error>([&list]() { auto& back = list.Back(); back; });
+
+			list.PushBack(b);
+			list.PushFront(a);
+			list.PushBack(c);
+			Assert::AreEqual(size_t(3), list.Size());
+			Assert::AreEqual(1, list.Front().Id);
+			Assert::AreEqual(3, list.Back().Id);
+
+			int expected = 1;
+			for (const Subscriber& subscriber : list)
+				Assert::AreEqual(expected++, subscriber.Id);
+
+			IntrusiveList<Subscriber, ActiveTag>::Iterator it = list.end();
+			Assert::AreEqual(3, (--it)->Id);
+
+			// end() points at the list's own hook, which is not part of any Subscriber.
+			Assert::ExpectException<runtime_error>([&list]() { auto& subscriber = *list.end(); subscriber; });
+			Assert::ExpectException<runtime_error>([&list]() { auto id = list.cend()->Id; id; });
+			Assert::ExpectException<runtime_error>([]() { auto& subscriber = *IntrusiveList<Subscriber, ActiveTag>::Iterator{}; subscriber; });
+
+			list.PopFront();
+			list.PopBack();
+			Assert::AreEqual(2, list.Front().Id);
+			Assert::IsFalse(static_cast<IntrusiveListHook<ActiveTag>&>(a).IsLinked());
+
+			list.Clear();
+			Assert::IsTrue(list.IsEmpty());
+			Assert::IsFalse(static_cast<IntrusiveListHook<ActiveTag>&>(b).IsLinked());
+		}
+
+		TEST_METHOD(InsertAndRemove)
+		{
+			Subscriber a{ 1 }, b{ 2 }, c{ 3 };
+			IntrusiveList<Subscriber, ActiveTag> list;
+			list.PushBack(a);
+			list.PushBack(c);
+
+			IntrusiveList<Subscriber, ActiveTag>::Iterator inserted = list.Insert(++list.cbegin(), b);
+			Assert::AreEqual(2, inserted->Id);
+			Assert::AreEqual(2, (++list.begin())->Id);
+
+			IntrusiveList<Subscriber, ActiveTag>::Iterator next = list.Remove(b);
+			Assert::AreEqual(3, next->Id);
+			Assert::AreEqual(size_t(2), list.Size());
+
+			Assert::IsTrue(list.Remove(c) == list.end());
+			Assert::AreEqual(1, list.Back().Id);
+		}
+
+		TEST_METHOD(SeveralHooks)
+		{
+			Subscriber a{ 1 }, b{ 2 };
+			IntrusiveList<Subscriber, ActiveTag> active;
+			IntrusiveList<Subscriber, PriorityTag> priority;
+			active.PushBack(a);
+			active.PushBack(b);
+			priority.PushBack(b);
+			priority.PushBack(a);
+
+			Assert::AreEqual(1, active.Front().Id);
+			Assert::AreEqual(2, priority.Front().Id);
+
+			// Linking an element that is already in a list moves it.
+			active.PushBack(a);
+			Assert::AreEqual(2, active.Front().Id);
+			Assert::AreEqual(size_t(2), active.Size());
+		}
+
+		TEST_METHOD(Lifetime)
+		{
+			IntrusiveList<Subscriber, ActiveTag> list;
+			Subscriber a{ 1 };
+			list.PushBack(a);
+			{
+				Subscriber b{ 2 };
+				list.PushBack(b);
+
+				// Copies never join their source's lists.
+				Subscriber copy{ b };
+				Assert::IsFalse(static_cast<IntrusiveListHook<ActiveTag>&>(copy).IsLinked());
+				Assert::AreEqual(size_t(2), list.Size());
+			}
+			Assert::AreEqual(size_t(1), list.Size());
+			Assert::AreEqual(1, list.Back().Id);
+
+			IntrusiveList<Subscriber, ActiveTag> moved{ std::move(list) };
+			Assert::IsTrue(list.IsEmpty());
+			Assert::AreEqual(1, moved.Front().Id);
+			Assert::IsTrue(std::find_if(moved.begin(), moved.end(), [](const Subscriber& s) { return s.Id == 1; }) == moved.begin());
+		}
+
+	private:
+		inline static _CrtMemState _startMemState;
+	};
+}
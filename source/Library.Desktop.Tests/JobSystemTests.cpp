@@ -0,0 +1,208 @@
+#include "pch.h"
+#include "CppUnitTest.h"
+#include <atomic>
+#include "JobSystem.h"
+#include "GameObject.h"
+#include "GameState.h"
+#include "EventQueue.h"
+#include "Monster.h"
+#include "Symbol.h"
+#include "ReactionAttributed.h"
+#include "ReactionMessage.h"
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+using namespace FieaGameEngine;
+using namespace std;
+using namespace UnitTests;
+
+namespace LibraryDesktopTests
+{
+	namespace
+	{
+		/// <summary>
+		/// Appends a key no one has interned before every time it is updated, and moves its reaction to another subtype.
+		/// </summary>
+		class KeyAppender final : public GameObject
+		{
+		public:
+			KeyAppender(size_t id, ReactionAttributed& reaction)
+				: _id{ id }, _reaction{ &reaction }
+			{
+			}
+
+			void Update(GameState& gameState) override
+			{
+				++_frame;
+				Append("ParallelKey_"s + to_string(_id) + "_"s + to_string(_frame)) = int32_t(_frame);
+				(*_reaction)["Subtype"s] = int32_t(_frame);
+				GameObject::Update(gameState);
+			}
+
+		private:
+			size_t _id;
+			size_t _frame{ 0 };
+			ReactionAttributed* _reaction;
+		};
+	}
+
+	TEST_CLASS(JobSystemTests)
+	{
+	public:
+		TEST_METHOD_INITIALIZE(Initialize)
+		{
+#if defined(DEBUG) || defined(_DEBUG)
+			_CrtSetDbgFlag(_CRTDBG_ALLOC_MEM_DF);
+			_CrtMemCheckpoint(&_startMemState);
+#endif
+		}
+
+		TEST_METHOD_CLEANUP(Cleanup)
+		{
+#if defined(DEBUG) || defined(_DEBUG)
+			_CrtMemState endMemState, diffMemState;
+			_CrtMemCheckpoint(&endMemState);
+			if (_CrtMemDifference(&diffMemState, &_startMemState, &endMemState))
+			{
+				_CrtMemDumpStatistics(&diffMemState);
+				Assert::Fail(L"Memory Leaks!");
+			}
+#endif
+		}
+
+		TEST_METHOD(ScheduleAndWait)
+		{
+			for (size_t workerCount : { size_t(0), size_t(1), size_t(4) })
+			{
+				JobSystem jobSystem{ workerCount };
+				Assert::AreEqual(workerCount, jobSystem.WorkerCount());
+
+				atomic<size_t> sum{ 0 };
+				JobSystem::Counter counter;
+				Assert::IsTrue(counter.IsDone());
+				for (size_t i = 1; i <= 100; ++i)
+				{
+					// Every job fans out again and joins its own children before finishing.
+					jobSystem.Schedule([&jobSystem, &sum, i]()
+						{
+							JobSystem::Counter inner;
+							for (size_t j = 0; j < 10; ++j)
+								jobSystem.Schedule([&sum, i]() { sum += i; }, inner);
+							jobSystem.Wait(inner);
+						}, counter);
+				}
+				jobSystem.Wait(counter);
+				Assert::IsTrue(counter.IsDone());
+				Assert::AreEqual(size_t(50500), sum.load());
+			}
+		}
+
+		TEST_METHOD(Exceptions)
+		{
+			JobSystem jobSystem{ 2 };
+			atomic<size_t> finished{ 0 };
+			JobSystem::Counter counter;
+			for (size_t i = 0; i < 16; ++i)
+			{
+				jobSystem.Schedule([&finished, i]()
+					{
+						if (i % 4 == 0)
+							throw runtime_error("Job failed.");
+						++finished;
+					}, counter);
+			}
+			Assert::ExpectException<runtime_error>([&jobSystem, &counter]() { jobSystem.Wait(counter); });
+			Assert::AreEqual(size_t(12), finished.load());
+
+			jobSystem.Schedule([&finished]() { ++finished; }, counter);
+			jobSystem.Wait(counter);
+			Assert::AreEqual(size_t(13), finished.load());
+		}
+
+		TEST_METHOD(ParallelUpdate)
+		{
+			EventQueue eventQueue;
+			GameTime gameTime;
+			GameState gameState{ eventQueue, gameTime };
+			JobSystem jobSystem{ 4 };
+			gameState.SetJobSystem(&jobSystem);
+			Assert::IsTrue(gameState.GetJobSystem() == &jobSystem);
+
+			GameObject world;
+			Vector<Monster*> monsters;
+			for (size_t i = 0; i < 16; ++i)
+			{
+				Monster* monster = new Monster{};
+				for (size_t j = 0; j < 8; ++j)
+				{
+					Monster* minion = new Monster{};
+					monster->Adopt(*minion, "Children"s);
+					monsters.PushBack(minion);
+				}
+				world.Adopt(*monster, "Children"s);
+				monsters.PushBack(monster);
+			}
+
+			for (size_t frame = 1; frame <= 3; ++frame)
+			{
+				world.Update(gameState);
+				for (Monster* monster : monsters)
+					Assert::AreEqual(frame, monster->UpdateCounter);
+			}
+
+			gameState.SetJobSystem(nullptr);
+			world.Update(gameState);
+			Assert::AreEqual(size_t(4), monsters.Back()->UpdateCounter);
+		}
+
+		TEST_METHOD(ParallelUpdateAppendsKeys)
+		{
+			EventQueue eventQueue;
+			GameTime gameTime;
+			GameState gameState{ eventQueue, gameTime };
+			JobSystem jobSystem{ 4 };
+			gameState.SetJobSystem(&jobSystem);
+
+			const size_t appenderCount = 32;
+			GameObject world;
+			Vector<KeyAppender*> appenders;
+			for (size_t i = 0; i < appenderCount; ++i)
+			{
+				ReactionAttributed* reaction = new ReactionAttributed{};
+				KeyAppender* appender = new KeyAppender{ i, *reaction };
+				appender->Adopt(*reaction, "Actions"s);
+				world.Adopt(*appender, "Children"s);
+				appenders.PushBack(appender);
+			}
+
+			const size_t symbolCount = Symbol::Count();
+			const size_t frameCount = 3;
+			for (size_t frame = 1; frame <= frameCount; ++frame)
+				world.Update(gameState);
+			Assert::AreEqual(symbolCount + appenderCount * frameCount, Symbol::Count());
+
+			for (size_t i = 0; i < appenderCount; ++i)
+			{
+				for (size_t frame = 1; frame <= frameCount; ++frame)
+				{
+					const string key = "ParallelKey_"s + to_string(i) + "_"s + to_string(frame);
+					Assert::IsTrue(Symbol::Lookup(key).IsValid());
+					Assert::AreEqual(key, string{ Symbol::Lookup(key).Name() });
+					Datum* datum = appenders[i]->Find(key);
+					Assert::IsNotNull(datum);
+					Assert::AreEqual(int32_t(frame), datum->Get<int32_t>());
+				}
+			}
+
+			// The reactions were retargeted from the jobs, but only the delivering thread moves their subscriptions.
+			const size_t channel = frameCount;
+			Assert::AreEqual(size_t(0), Event<ReactionMessage>::SubscriberCount(channel));
+			ReactionMessage message{ ReactionSubtypes(frameCount), gameState };
+			eventQueue.Enqueue(make_shared<Event<ReactionMessage>>(std::move(message), channel), gameTime);
+			eventQueue.Update(gameTime);
+			Assert::AreEqual(appenderCount, Event<ReactionMessage>::SubscriberCount(channel));
+		}
+
+	private:
+		inline static _CrtMemState _startMemState;
+	};
+}
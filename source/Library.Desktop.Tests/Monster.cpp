@@ -7,8 +7,13 @@ namespace UnitTests
 {
 	RTTI_DEFINITIONS(Monster);
 
-	Monster::Monster() 
-		: GameObject(Monster::TypeIdClass())
+	Monster::Monster()
+		: Monster(IAllocator::Default())
+	{
+	}
+
+	Monster::Monster(IAllocator& allocator)
+		: GameObject(Monster::TypeIdClass(), allocator)
 	{
 	}
 
@@ -10,6 +10,12 @@ namespace UnitTests
 
 	public:
 		Monster();
+
+		/// <summary>
+		/// Constructor for Monster that takes its storage from the given allocator, as factories do when creating it in one.
+		/// </summary>
+		/// <param name="allocator"> The allocator the Monster takes its storage from. </param>
+		explicit Monster(FieaGameEngine::IAllocator& allocator);
 		Monster(const Monster& other) = default;
 		Monster(Monster&& other) noexcept = default;
 		Monster& operator=(const Monster& rhs) = default;
@@ -22,10 +28,10 @@ namespace UnitTests
 
 		static FieaGameEngine::Vector<FieaGameEngine::Signature> Signatures();
 
-		size_t UpdateCounter;
+		size_t UpdateCounter{ 0 };
 
-		int32_t Health;
+		int32_t Health{ 0 };
 	};
 
-	ConcreteFactory(Monster, Scope);
+	ConcreteScopeFactory(Monster);
 }
\ No newline at end of file
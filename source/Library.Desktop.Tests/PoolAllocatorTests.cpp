@@ -0,0 +1,201 @@
+#include "pch.h"
+#include "CppUnitTest.h"
+#include "PoolAllocator.h"
+#include "Vector.h"
+#include "SList.h"
+#include "HashMap.h"
+#include "Scope.h"
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+using namespace FieaGameEngine;
+using namespace std;
+
+namespace LibraryDesktopTests
+{
+	TEST_CLASS(PoolAllocatorTests)
+	{
+	public:
+		TEST_METHOD_INITIALIZE(Initialize)
+		{
+#if defined(DEBUG) || defined(_DEBUG)
+			_CrtSetDbgFlag(_CRTDBG_ALLOC_MEM_DF);
+			_CrtMemCheckpoint(&_startMemState);
+#endif
+		}
+
+		TEST_METHOD_CLEANUP(Cleanup)
+		{
+#if defined(DEBUG) || defined(_DEBUG)
+			_CrtMemState endMemState, diffMemState;
+			_CrtMemCheckpoint(&endMemState);
+			if (_CrtMemDifference(&diffMemState, &_startMemState, &endMemState))
+			{
+				_CrtMemDumpStatistics(&diffMemState);
+				Assert::Fail(L"Memory Leaks!");
+			}
+#endif
+		}
+
+		TEST_METHOD(AllocateDeallocate)
+		{
+			PoolAllocator pool;
+			Assert::IsNull(pool.Allocate(0));
+			Assert::AreEqual(size_t(0), pool.ChunkCount());
+
+			void* a = pool.Allocate(24);
+			void* b = pool.Allocate(24);
+			Assert::IsNotNull(a);
+			Assert::IsTrue(a != b);
+			Assert::AreEqual(size_t(0), reinterpret_cast<uintptr_t>(a) % IAllocator::Alignment);
+			Assert::AreEqual(size_t(0), reinterpret_cast<uintptr_t>(b) % IAllocator::Alignment);
+			Assert::AreEqual(size_t(2), pool.ActiveAllocations());
+			Assert::AreEqual(size_t(1), pool.ChunkCount());
+
+			pool.Deallocate(a, 24);
+			Assert::AreEqual(size_t(1), pool.ActiveAllocations());
+			Assert::IsTrue(a == pool.Allocate(20));
+
+			void* large = pool.Allocate(PoolAllocator::MaxPooledSize + 1);
+			Assert::IsNotNull(large);
+			Assert::AreEqual(size_t(0), reinterpret_cast<uintptr_t>(large) % IAllocator::Alignment);
+			Assert::AreEqual(size_t(3), pool.ActiveAllocations());
+			Assert::AreEqual(size_t(1), pool.ChunkCount());
+
+			pool.Deallocate(large, PoolAllocator::MaxPooledSize + 1);
+			pool.Deallocate(a, 20);
+			pool.Deallocate(b, 24);
+			pool.Deallocate(nullptr, 24);
+			Assert::AreEqual(size_t(0), pool.ActiveAllocations());
+		}
+
+		TEST_METHOD(Reallocate)
+		{
+			PoolAllocator pool;
+
+			int32_t* block = reinterpret_cast<int32_t*>(pool.Reallocate(nullptr, 0, sizeof(int32_t) * 3));
+			block[0] = 1;
+			block[1] = 2;
+			block[2] = 3;
+
+			// Growing within the same size class keeps the block in place.
+			Assert::IsTrue(block == pool.Reallocate(block, sizeof(int32_t) * 3, sizeof(int32_t) * 4));
+
+			int32_t* grown = reinterpret_cast<int32_t*>(pool.Reallocate(block, sizeof(int32_t) * 4, sizeof(int32_t) * 200));
+			Assert::AreEqual(1, grown[0]);
+			Assert::AreEqual(2, grown[1]);
+			Assert::AreEqual(3, grown[2]);
+			Assert::AreEqual(size_t(1), pool.ActiveAllocations());
+
+			int32_t* shrunk = reinterpret_cast<int32_t*>(pool.Reallocate(grown, sizeof(int32_t) * 200, sizeof(int32_t) * 2));
+			Assert::AreEqual(1, shrunk[0]);
+			Assert::AreEqual(2, shrunk[1]);
+
+			Assert::IsNull(pool.Reallocate(shrunk, sizeof(int32_t) * 2, 0));
+			Assert::AreEqual(size_t(0), pool.ActiveAllocations());
+		}
+
+		TEST_METHOD(Release)
+		{
+			PoolAllocator pool{ 1024 };
+			for (size_t i = 0; i < 100; ++i)
+				pool.Allocate(64);
+			pool.Allocate(4096);
+
+			Assert::AreEqual(size_t(101), pool.ActiveAllocations());
+			Assert::IsTrue(pool.ChunkCount() > 1);
+
+			pool.Release();
+			Assert::AreEqual(size_t(0), pool.ActiveAllocations());
+			Assert::AreEqual(size_t(0), pool.ChunkCount());
+
+			Assert::IsNotNull(pool.Allocate(64));
+			Assert::AreEqual(size_t(1), pool.ChunkCount());
+		}
+
+		TEST_METHOD(Containers)
+		{
+			PoolAllocator pool;
+			{
+				Vector<int32_t> vector{ pool };
+				for (int32_t i = 0; i < 100; ++i)
+					vector.PushBack(i);
+				Assert::IsTrue(&vector.GetAllocator() == &pool);
+
+				SList<string> list{ pool };
+				list.PushBack("Hello"s);
+				list.PushFront("World"s);
+				Assert::IsTrue(&list.GetAllocator() == &pool);
+
+				HashMap<int32_t, int32_t> map{ 11, pool };
+				for (int32_t i = 0; i < 100; ++i)
+					map.Insert(make_pair(i, i * 2));
+				Assert::IsTrue(&map.GetAllocator() == &pool);
+				Assert::AreEqual(198, map.At(99));
+
+				Datum datum{ Datum::DatumTypes::String, pool };
+				datum.PushBack("Hello"s);
+				datum.PushBack("World"s);
+				datum.PushBack("!"s);
+				Assert::IsFalse(datum.IsInline());
+				Assert::IsTrue(&datum.GetAllocator() == &pool);
+				Assert::AreEqual(size_t(6), pool.ActiveAllocations());
+
+				// Copies take their storage from the default allocator; moves take the storage along with its allocator.
+				Vector<int32_t> copy{ vector };
+				Assert::IsTrue(&copy.GetAllocator() == &IAllocator::Default());
+				Assert::IsTrue(copy == vector);
+
+				Vector<int32_t> moved{ std::move(vector) };
+				Assert::IsTrue(&moved.GetAllocator() == &pool);
+
+				copy = std::move(moved);
+				Assert::IsTrue(&copy.GetAllocator() == &pool);
+				Assert::AreEqual(size_t(100), copy.Size());
+
+				Datum datumCopy{ datum };
+				Assert::IsTrue(&datumCopy.GetAllocator() == &IAllocator::Default());
+				Assert::AreEqual("World"s, datumCopy.Get<string>(1));
+			}
+			Assert::AreEqual(size_t(0), pool.ActiveAllocations());
+		}
+
+		TEST_METHOD(ScopeTree)
+		{
+			PoolAllocator pool;
+			{
+				Scope root{ pool };
+				Assert::IsTrue(&root.GetAllocator() == &pool);
+				root.Append("Health"sv) = 100;
+
+				Scope& child = root.AppendScope("Children"sv);
+				Assert::IsTrue(&child.GetAllocator() == &pool);
+				Assert::IsTrue(&root.Find("Health"sv)->GetAllocator() == &pool);
+
+				Scope& grandchild = child.AppendScope("Children"sv);
+				grandchild.Append("Name"sv) = "Grandchild"s;
+				Assert::IsTrue(&grandchild.GetAllocator() == &pool);
+				Assert::IsTrue(grandchild.GetParent() == &child);
+
+				size_t activeAllocations = pool.ActiveAllocations();
+				gsl::owner<Scope*> orphan = child.Orphan();
+				delete orphan;
+				Assert::IsTrue(pool.ActiveAllocations() < activeAllocations);
+
+				gsl::owner<Scope*> clone = new Scope{ root };
+				Assert::IsTrue(&clone->GetAllocator() == &IAllocator::Default());
+				Assert::AreEqual(100, clone->Find("Health"sv)->Get<int32_t>());
+				delete clone;
+			}
+			Assert::AreEqual(size_t(0), pool.ActiveAllocations());
+
+			gsl::owner<Scope*> pooled = new (pool) Scope{ pool };
+			pooled->AppendScope("Child"sv);
+			Assert::IsTrue(pool.ActiveAllocations() > 0);
+			delete pooled;
+			Assert::AreEqual(size_t(0), pool.ActiveAllocations());
+		}
+
+	private:
+		inline static _CrtMemState _startMemState;
+	};
+}
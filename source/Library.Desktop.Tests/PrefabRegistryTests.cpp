@@ -0,0 +1,136 @@
+#include "pch.h"
+#include "CppUnitTest.h"
+#include "PrefabRegistry.h"
+#include "Monster.h"
+#include "ActionIncrement.h"
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+using namespace FieaGameEngine;
+using namespace UnitTests;
+using namespace std;
+
+namespace LibraryDesktopTests
+{
+	TEST_CLASS(PrefabRegistryTests)
+	{
+	public:
+		TEST_METHOD_INITIALIZE(Initialize)
+		{
+#if defined(DEBUG) || defined(_DEBUG)
+			_CrtSetDbgFlag(_CRTDBG_ALLOC_MEM_DF);
+			_CrtMemCheckpoint(&_startMemState);
+#endif
+		}
+
+		TEST_METHOD_CLEANUP(Cleanup)
+		{
+#if defined(DEBUG) || defined(_DEBUG)
+			_CrtMemState endMemState, diffMemState;
+			_CrtMemCheckpoint(&endMemState);
+			if (_CrtMemDifference(&diffMemState, &_startMemState, &endMemState))
+			{
+				_CrtMemDumpStatistics(&diffMemState);
+				Assert::Fail(L"Memory Leaks!");
+			}
+#endif
+		}
+
+		TEST_METHOD(Register)
+		{
+			PrefabRegistry registry;
+			Assert::AreEqual(size_t(0), registry.Size());
+
+			Monster prototype;
+			prototype.Name = "Grunt"s;
+			prototype.Health = 50;
+			Scope& stored = registry.Register("Grunt"sv, prototype);
+
+			Assert::AreEqual(size_t(1), registry.Size());
+			Assert::IsTrue(registry.IsRegistered("Grunt"sv));
+			Assert::IsFalse(registry.IsRegistered("Boss"sv));
+			Assert::IsTrue(&stored == &registry.Prototype("Grunt"sv));
+			Assert::IsTrue(&stored != &prototype);
+			Assert::AreEqual("Grunt"s, stored.As<Monster>()->Name);
+
+			prototype.Health = 75;
+			Assert::AreEqual(50, stored.As<Monster>()->Health);
+
+			Assert::ExpectException<runtime_error>([&registry, &prototype]() { registry.Register("Grunt"sv, prototype); });
+			Assert::ExpectException<runtime_error>([&registry]() { registry.Prototype("Boss"sv); });
+
+			Assert::IsTrue(registry.Unregister("Grunt"sv));
+			Assert::IsFalse(registry.Unregister("Grunt"sv));
+			Assert::AreEqual(size_t(0), registry.Size());
+		}
+
+		TEST_METHOD(Instantiate)
+		{
+			PrefabRegistry registry;
+			{
+				Monster prototype;
+				prototype.Name = "Grunt"s;
+				prototype.Health = 50;
+				prototype.UpdateCounter = 0;
+				ActionIncrement* action = new ActionIncrement{};
+				action->Target = "Health"s;
+				action->Step = 5;
+				prototype.Adopt(*action, "Actions"sv);
+				registry.Register("Grunt"sv, prototype);
+			}
+
+			Scope* instance = registry.Instantiate("Grunt"sv);
+			Monster* monster = instance->As<Monster>();
+			Assert::IsNotNull(monster);
+			Assert::IsNull(monster->GetParent());
+			Assert::AreEqual("Grunt"s, monster->Name);
+			Assert::AreEqual(50, monster->Health);
+
+			// External storage is rebound to the new object rather than the prototype.
+			Assert::IsTrue(&monster->Find("Health"sv)->Get<int32_t>() == &monster->Health);
+			Assert::IsTrue(monster->Find("this"sv)->Get<RTTI*>() == monster);
+
+			// Nested scopes are deep copied and parented to the new object.
+			Datum& actions = monster->GetActions();
+			Assert::AreEqual(size_t(1), actions.Size());
+			Assert::IsTrue(&actions[0] != &registry.Prototype("Grunt"sv).Find("Actions"sv)->operator[](0));
+			Assert::IsTrue(actions[0].GetParent() == monster);
+
+			monster->Health = 10;
+			Assert::AreEqual(50, registry.Prototype("Grunt"sv).As<Monster>()->Health);
+
+			delete instance;
+			Assert::ExpectException<runtime_error>([&registry]() { registry.Instantiate("Boss"sv); });
+		}
+
+		TEST_METHOD(InstantiateMany)
+		{
+			PrefabRegistry registry;
+			{
+				Monster prototype;
+				prototype.Health = 20;
+				registry.Register("Grunt"sv, prototype);
+			}
+
+			Scope wave;
+			registry.Instantiate("Grunt"sv, 100, wave, "Enemies"sv);
+			registry.Instantiate("Grunt"sv, 28, wave, "Enemies"sv);
+
+			Datum& enemies = *wave.Find("Enemies"sv);
+			Assert::AreEqual(size_t(128), enemies.Size());
+			for (size_t i = 0; i < enemies.Size(); ++i)
+			{
+				Monster* monster = enemies[i].As<Monster>();
+				Assert::IsNotNull(monster);
+				Assert::IsTrue(monster->GetParent() == &wave);
+				Assert::AreEqual(20, monster->Health);
+				Assert::IsTrue(&monster->Find("Health"sv)->Get<int32_t>() == &monster->Health);
+			}
+
+			wave.Append("Count"sv) = 5;
+			Assert::ExpectException<runtime_error>([&registry, &wave]() { registry.Instantiate("Grunt"sv, 1, wave, "Count"sv); });
+		}
+
+	private:
+		inline static _CrtMemState _startMemState;
+	};
+}
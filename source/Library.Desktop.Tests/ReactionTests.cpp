@@ -9,6 +9,7 @@
 #include "TableParseHelper.h"
 #include "Event.h"
 #include "ReactionMessageAttributed.h"
+#include "ReactionMessage.h"
 
 using namespace Microsoft::VisualStudio::CppUnitTestFramework;
 using namespace FieaGameEngine;
@@ -74,6 +75,171 @@ namespace LibraryDesktopTests
 			Assert::AreEqual(10, actionIncrement->Step);
 		}
 
+		TEST_METHOD(CompactPayload)
+		{
+			EventQueue queue;
+			GameTime gt;
+			GameState gameState{ queue, gt };
+
+			ReactionAttributed reaction;
+			reaction.AppendAuxiliaryAttribute("Health"s).PushBack(100);
+			ActionIncrement* actionIncrement = new ActionIncrement{};
+			actionIncrement->SetTarget("Health"s);
+			actionIncrement->Step = 1;
+			actionIncrement->AppendAuxiliaryAttribute("Scale"s).PushBack(1.0f);
+			reaction.Adopt(*actionIncrement, "Actions"s);
+
+			// Once opted into, single integers and floats travel in a ReactionMessage, keeping their types.
+			ActionEvent actionEvent;
+			Assert::IsFalse(actionEvent.IsPayloadCompact());
+			actionEvent.SetCompactPayload(true);
+			Assert::IsTrue(actionEvent.IsPayloadCompact());
+			actionEvent.AppendAuxiliaryAttribute("Step"s).PushBack(10);
+			actionEvent.AppendAuxiliaryAttribute("Scale"s).PushBack(2.5f);
+			actionEvent.Update(gameState);
+			queue.Update(gt);
+			Assert::AreEqual(10, actionIncrement->Step);
+			Assert::AreEqual(2.5f, actionIncrement->Find("Scale"s)->Get<float>());
+			Assert::AreEqual(110, reaction.Find("Health"s)->Get<int32_t>());
+
+			// Arguments appended after the first event are picked up by the next.
+			actionEvent.AppendAuxiliaryAttribute("Health"s).PushBack(50);
+			actionEvent.Update(gameState);
+			queue.Update(gt);
+			Assert::AreEqual(60, reaction.Find("Health"s)->Get<int32_t>());
+
+			// Arguments a ReactionMessage cannot carry fall back to the Attributed payload, which is also the default.
+			ActionEvent fallback;
+			fallback.SetCompactPayload(true);
+			fallback.AppendAuxiliaryAttribute("Step"s).PushBack(20);
+			fallback.AppendAuxiliaryAttribute("Label"s).PushBack("Hit"s);
+			fallback.Update(gameState);
+			queue.Update(gt);
+			Assert::AreEqual(20, actionIncrement->Step);
+			Assert::AreEqual(80, reaction.Find("Health"s)->Get<int32_t>());
+
+			ActionEvent attributed;
+			attributed.AppendAuxiliaryAttribute("Step"s).PushBack(-30);
+			attributed.Update(gameState);
+			queue.Update(gt);
+			Assert::AreEqual(-30, actionIncrement->Step);
+			Assert::AreEqual(50, reaction.Find("Health"s)->Get<int32_t>());
+
+			ReactionMessage message{ ReactionSubtypes::ItsNotLookingGoodBrev, gameState };
+			Assert::AreEqual(size_t(0), message.ArgumentCount());
+			Datum integer;
+			integer = 1;
+			Datum label;
+			label = "Hit"s;
+			Assert::IsTrue(ReactionMessage::CanCarry(integer));
+			Assert::IsFalse(ReactionMessage::CanCarry(label));
+			Assert::ExpectException<runtime_error>([&message, &label]() { message.AppendArgument(Symbol::Intern("Label"s), label); });
+			for (size_t i = 0; i < ReactionMessage::Capacity; ++i)
+				message.AppendArgument(Symbol::Intern("Step"s), integer);
+			Assert::ExpectException<runtime_error>([&message, &integer]() { message.AppendArgument(Symbol::Intern("Step"s), integer); });
+			Assert::ExpectException<out_of_range>([&message]() { message.GetArgument(ReactionMessage::Capacity); });
+			Assert::IsTrue(message.GetArgument(0).Name == Symbol::Intern("Step"s));
+			Assert::AreEqual(1, message.GetArgument(0).Integer);
+			message.ClearArguments();
+			Assert::AreEqual(size_t(0), message.ArgumentCount());
+		}
+
+		TEST_METHOD(CompactPayloadBinding)
+		{
+			EventQueue queue;
+			GameTime gt;
+			GameState gameState{ queue, gt };
+
+			ReactionAttributed reaction;
+			reaction.AppendAuxiliaryAttribute("Health"s).PushBack(100);
+			ActionIncrement* actionIncrement = new ActionIncrement{};
+			actionIncrement->SetTarget("Step"s);
+			actionIncrement->Step = 0;
+			reaction.Adopt(*actionIncrement, "Actions"s);
+
+			ActionEvent actionEvent;
+			actionEvent.SetCompactPayload(true);
+			actionEvent.AppendAuxiliaryAttribute("Health"s).PushBack(50);
+			actionEvent.Update(gameState);
+			queue.Update(gt);
+			Assert::AreEqual(50, reaction.Find("Health"s)->Get<int32_t>());
+
+			// Growing the reaction relocates its Datums, so the remembered target is found again.
+			for (int32_t i = 0; i < 64; ++i)
+				reaction.AppendAuxiliaryAttribute("Padding"s + to_string(i)).PushBack(i);
+			actionEvent.Find("Health"s)->Set(40);
+			actionEvent.Update(gameState);
+			queue.Update(gt);
+			Assert::AreEqual(40, reaction.Find("Health"s)->Get<int32_t>());
+
+			// So is a closer Datum of the same name appearing after the first delivery.
+			actionIncrement->AppendAuxiliaryAttribute("Health"s).PushBack(0);
+			actionEvent.Find("Health"s)->Set(30);
+			actionEvent.Update(gameState);
+			queue.Update(gt);
+			Assert::AreEqual(40, reaction.Find("Health"s)->Get<int32_t>());
+			Assert::AreEqual(30, actionIncrement->Find("Health"s)->Get<int32_t>());
+
+			// Nothing along the Search chain has changed since, so the remembered target is used as is, however other Scopes grow.
+			const uint64_t reactionGeneration = reaction.LayoutGeneration();
+			const uint64_t actionGeneration = actionIncrement->LayoutGeneration();
+			Scope unrelated;
+			for (int32_t i = 0; i < 64; ++i)
+				unrelated.Append("Unrelated"s + to_string(i));
+			actionEvent.Find("Health"s)->Set(20);
+			actionEvent.Update(gameState);
+			queue.Update(gt);
+			Assert::AreEqual(reactionGeneration, reaction.LayoutGeneration());
+			Assert::AreEqual(actionGeneration, actionIncrement->LayoutGeneration());
+			Assert::AreEqual(20, actionIncrement->Find("Health"s)->Get<int32_t>());
+
+			// Moving the Action under another reaction is caught through its own generation.
+			ReactionAttributed otherReaction;
+			otherReaction.Adopt(*actionIncrement, "Actions"s);
+			Assert::AreNotEqual(actionGeneration, actionIncrement->LayoutGeneration());
+		}
+
+		TEST_METHOD(ChannelRouting)
+		{
+			EventQueue queue;
+			GameTime gt;
+			GameState gameState{ queue, gt };
+
+			ReactionAttributed reaction;
+			reaction.AppendAuxiliaryAttribute("Health"s).PushBack(100);
+			ActionIncrement* actionIncrement = new ActionIncrement{};
+			actionIncrement->SetTarget("Health"s);
+			actionIncrement->Step = 1;
+			reaction.Adopt(*actionIncrement, "Actions"s);
+
+			// Events published without a channel are routed by the subtype of their message.
+			ReactionMessageAttributed attributed{ ReactionSubtypes::ItsNotLookingGoodBrev, gameState };
+			Event<ReactionMessageAttributed>{ attributed }.Deliver();
+			Assert::AreEqual(101, reaction.Find("Health"s)->Get<int32_t>());
+			ReactionMessage compact{ ReactionSubtypes::ItsNotLookingGoodBrev, gameState };
+			Event<ReactionMessage>{ compact }.Deliver();
+			Assert::AreEqual(102, reaction.Find("Health"s)->Get<int32_t>());
+
+			// A subtype written through the Datum is honoured by the next EventQueue update, without an Update of the reaction in between.
+			const ReactionSubtypes otherSubtype = ReactionSubtypes(7);
+			reaction["Subtype"s] = int32_t(otherSubtype);
+			attributed.SetSubtype(otherSubtype);
+			queue.Enqueue(make_shared<Event<ReactionMessageAttributed>>(attributed), gt);
+			queue.Update(gt);
+			Assert::AreEqual(103, reaction.Find("Health"s)->Get<int32_t>());
+			compact.SetSubtype(otherSubtype);
+			Event<ReactionMessage>{ compact }.Deliver();
+			Assert::AreEqual(104, reaction.Find("Health"s)->Get<int32_t>());
+			Assert::AreEqual(size_t(1), Event<ReactionMessage>::SubscriberCount(size_t(otherSubtype)));
+			Assert::AreEqual(size_t(0), Event<ReactionMessage>::SubscriberCount(size_t(ReactionSubtypes::ItsNotLookingGoodBrev)));
+
+			// SetSubtype is honoured by the very next delivery, queued or not.
+			reaction.SetSubtype(ReactionSubtypes::ItsNotLookingGoodBrev);
+			compact.SetSubtype(ReactionSubtypes::ItsNotLookingGoodBrev);
+			Event<ReactionMessage>{ compact }.Deliver();
+			Assert::AreEqual(105, reaction.Find("Health"s)->Get<int32_t>());
+		}
+
 	private:
 		inline static _CrtMemState _startMemState;
 	};
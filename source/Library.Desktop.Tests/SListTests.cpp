@@ -4,6 +4,7 @@
 #include "ToStringSpecializations.h"
 #include "Foo.h"
 #include "DefaultEquality.h"
+#include "PoolAllocator.h"
 
 using namespace Microsoft::VisualStudio::CppUnitTestFramework;
 using namespace FieaGameEngine;
@@ -570,6 +571,43 @@ namespace LibraryDesktopTests
 			Assert::AreEqual(size_t(3), list.Size());
 		}
 
+		TEST_METHOD(NodeRecycling)
+		{
+			PoolAllocator pool;
+			{
+				SList<Foo> list{ pool };
+				for (int32_t i = 0; i < 8; ++i)
+					list.PushBack(Foo{ i });
+				Assert::AreEqual(size_t(8), pool.ActiveAllocations());
+
+				// Popped nodes are reused, so a list cycling below its high-water mark never allocates.
+				for (int32_t round = 0; round < 10; ++round)
+				{
+					list.PopFront();
+					list.PopBack();
+					list.PushFront(Foo{ round });
+					list.EmplaceBack(Foo{ round });
+				}
+				Assert::AreEqual(size_t(8), pool.ActiveAllocations());
+				Assert::AreEqual(Foo{ 9 }, list.Front());
+				Assert::AreEqual(Foo{ 9 }, list.Back());
+
+				list.Clear();
+				Assert::AreEqual(size_t(8), pool.ActiveAllocations());
+				list.PushBack(Foo{ 1 });
+				Assert::AreEqual(size_t(8), pool.ActiveAllocations());
+
+				list.ShrinkToFit();
+				Assert::AreEqual(size_t(1), pool.ActiveAllocations());
+
+				list.PushBack(Foo{ 2 });
+				list.PopFront();
+				SList<Foo> moved{ std::move(list) };
+				Assert::AreEqual(Foo{ 2 }, moved.Front());
+			}
+			Assert::AreEqual(size_t(0), pool.ActiveAllocations());
+		}
+
 		private:
 			inline static _CrtMemState _startMemState;
 	};
@@ -9,6 +9,18 @@ using namespace std;
 
 namespace LibraryDesktopTests
 {
+	/// <summary>
+	/// Scope whose clones always fail, to check that copying a tree cleans up after a child that cannot be copied.
+	/// </summary>
+	struct UncopyableScope final : public Scope
+	{
+	protected:
+		Scope* Clone() const override
+		{
+			throw runtime_error("Clone failed.");
+		}
+	};
+
 	TEST_CLASS(ScopeTests)
 	{
 	public:
@@ -71,6 +83,28 @@ namespace LibraryDesktopTests
 			}
 		}
 
+		TEST_METHOD(CopyWithThrowingClone)
+		{
+			Scope source;
+			source.AppendScope("first"s).Append("int datum"s).PushBack(1);
+			UncopyableScope* uncopyable = new UncopyableScope{};
+			source.Adopt(*uncopyable, "second"s);
+			source.AppendScope("second"s);
+			source.AppendScope("third"s);
+
+			// The clones made before the failure are deleted, and the target does not keep any of the source's children.
+			Scope target;
+			target.AppendScope("old"s);
+			Assert::ExpectException<runtime_error>([&target, &source]() { target = source; });
+			Assert::AreEqual(size_t(0), target.Size());
+			Assert::ExpectException<runtime_error>([&source]() { Scope copy{ source }; });
+
+			Assert::AreEqual(size_t(3), source.Size());
+			Assert::IsTrue(&source["second"s][0] == uncopyable);
+			Assert::IsTrue(uncopyable->GetParent() == &source);
+			Assert::AreEqual(1, source["first"s][0]["int datum"s].Get<int32_t>());
+		}
+
 		TEST_METHOD(MoveSemantics)
 		{
 			//Move constructor
@@ -137,6 +171,12 @@ namespace LibraryDesktopTests
 			const Scope constScope{ rootScope };
 			Assert::IsTrue(appendedDatum == *constScope.Find("hello"s));
 			Assert::IsTrue(nullptr == constScope.Find("bye"s));
+
+			string_view key = "hello"sv;
+			Assert::IsTrue(&appendedDatum == rootScope.Find(key));
+			Assert::IsTrue(&appendedDatum == rootScope.Find("hello"));
+			Assert::IsTrue(&appendedDatum == &rootScope.Append(key));
+			Assert::AreEqual(size_t(1), rootScope.Size());
 		}
 
 		TEST_METHOD(Search)
@@ -0,0 +1,171 @@
+#include "pch.h"
+#include "CppUnitTest.h"
+#include "SmallVector.h"
+#include "PoolAllocator.h"
+#include "Datum.h"
+#include "Scope.h"
+#include "Foo.h"
+#include "ToStringSpecializations.h"
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+using namespace FieaGameEngine;
+using namespace std;
+using namespace UnitTests;
+
+namespace LibraryDesktopTests
+{
+	TEST_CLASS(SmallVectorTests)
+	{
+	public:
+		TEST_METHOD_INITIALIZE(Initialize)
+		{
+#if defined(DEBUG) || defined(_DEBUG)
+			_CrtSetDbgFlag(_CRTDBG_ALLOC_MEM_DF);
+			_CrtMemCheckpoint(&_startMemState);
+#endif
+		}
+
+		TEST_METHOD_CLEANUP(Cleanup)
+		{
+#if defined(DEBUG) || defined(_DEBUG)
+			_CrtMemState endMemState, diffMemState;
+			_CrtMemCheckpoint(&endMemState);
+			if (_CrtMemDifference(&diffMemState, &_startMemState, &endMemState))
+			{
+				_CrtMemDumpStatistics(&diffMemState);
+				Assert::Fail(L"Memory Leaks!");
+			}
+#endif
+		}
+
+		TEST_METHOD(InlineStorage)
+		{
+			PoolAllocator pool;
+			{
+				SmallVector<Foo, 4> vector{ pool };
+				Assert::IsTrue(vector.IsInline());
+				Assert::AreEqual(size_t(4), vector.Capacity());
+				Assert::ExpectException<runtime_error>([&vector]() { auto& front = vector.Front(); front; });
+
+				for (int32_t i = 0; i < 4; ++i)
+					vector.EmplaceBack(i);
+				Assert::IsTrue(vector.IsInline());
+				Assert::AreEqual(size_t(0), pool.ActiveAllocations());
+
+				vector.PushBack(Foo{ 4 });
+				Assert::IsFalse(vector.IsInline());
+				Assert::AreEqual(size_t(1), pool.ActiveAllocations());
+				for (int32_t i = 0; i < 5; ++i)
+					Assert::AreEqual(Foo{ i }, vector[i]);
+
+				vector.PopBack();
+				vector.ShrinkToFit();
+				Assert::IsTrue(vector.IsInline());
+				Assert::AreEqual(size_t(0), pool.ActiveAllocations());
+				Assert::AreEqual(Foo{ 3 }, vector.Back());
+				Assert::ExpectException<out_of_range>([&vector]() { auto& element = vector[4]; element; });
+			}
+			Assert::AreEqual(size_t(0), pool.ActiveAllocations());
+		}
+
+		TEST_METHOD(CopyAndMove)
+		{
+			//Inline
+			{
+				SmallVector<string, 2> vector{ "Hello"s, "World"s };
+				SmallVector<string, 2> copy{ vector };
+				Assert::IsTrue(copy.IsInline());
+				Assert::AreEqual("World"s, copy[1]);
+
+				SmallVector<string, 2> moved{ std::move(vector) };
+				Assert::IsTrue(vector.IsEmpty());
+				Assert::IsTrue(moved.IsInline());
+				Assert::AreEqual("Hello"s, moved.Front());
+
+				copy = std::move(moved);
+				Assert::AreEqual(size_t(2), copy.Size());
+				Assert::IsTrue(moved.IsEmpty());
+			}
+
+			//Spilled
+			{
+				SmallVector<string, 2> vector{ "A"s, "B"s, "C"s };
+				Assert::IsFalse(vector.IsInline());
+				const string* data = vector.Data();
+
+				SmallVector<string, 2> moved{ std::move(vector) };
+				Assert::IsTrue(moved.Data() == data);
+				Assert::IsTrue(vector.IsInline());
+				Assert::AreEqual(size_t(2), vector.Capacity());
+
+				SmallVector<string, 2> copy;
+				copy = moved;
+				Assert::AreEqual("C"s, copy.Back());
+				Assert::IsTrue(copy.Data() != moved.Data());
+			}
+		}
+
+		TEST_METHOD(Remove)
+		{
+			SmallVector<Foo, 2> vector{ Foo{ 1 }, Foo{ 2 }, Foo{ 3 }, Foo{ 4 } };
+			Assert::IsTrue(vector.Find(Foo{ 3 }) == vector.begin() + 2);
+			Assert::IsTrue(vector.Find(Foo{ 5 }) == vector.end());
+
+			Assert::IsTrue(vector.Remove(Foo{ 2 }));
+			Assert::IsFalse(vector.Remove(Foo{ 2 }));
+			Assert::AreEqual(size_t(3), vector.Size());
+			Assert::AreEqual(Foo{ 3 }, vector[1]);
+
+			Assert::IsFalse(vector.Remove(vector.cend(), vector.cbegin()));
+			Assert::IsTrue(vector.Remove(vector.cbegin(), vector.cbegin() + 2));
+			Assert::AreEqual(Foo{ 4 }, vector.Front());
+
+			vector.Clear();
+			Assert::IsTrue(vector.IsEmpty());
+		}
+
+		TEST_METHOD(SmallObjectsStayInline)
+		{
+			PoolAllocator pool;
+			{
+				Datum position{ Datum::DatumTypes::Vector, pool };
+				position.PushBack(glm::vec4{ 1.0f, 2.0f, 3.0f, 1.0f });
+				Assert::IsTrue(position.IsInline());
+
+				Datum flags{ Datum::DatumTypes::Integer, pool };
+				flags.PushBack(1);
+				flags.PushBack(2);
+				flags.PushBack(3);
+				Assert::IsTrue(flags.IsInline());
+
+				Datum transform{ Datum::DatumTypes::Matrix, pool };
+				transform.PushBack(glm::mat4{ 1.0f });
+				Assert::IsFalse(transform.IsInline());
+				Assert::AreEqual(size_t(1), pool.ActiveAllocations());
+
+				Datum moved{ std::move(flags) };
+				Assert::IsTrue(moved.IsInline());
+				Assert::AreEqual(3, moved.Get<int32_t>(2));
+				Assert::AreEqual(size_t(0), flags.Size());
+
+				moved.Resize(32);
+				Assert::IsFalse(moved.IsInline());
+				Assert::AreEqual(2, moved.Get<int32_t>(1));
+				moved.Resize(2);
+				Assert::IsTrue(moved.IsInline());
+				Assert::AreEqual(2, moved.Get<int32_t>(1));
+				Assert::AreEqual(size_t(1), pool.ActiveAllocations());
+
+				Scope scope{ pool };
+				scope.Append("A"s) = 1;
+				scope.Append("B"s) = 2.0f;
+				Assert::AreEqual(size_t(2), scope.Size());
+				Assert::IsTrue(scope.Find("A"s)->IsInline());
+			}
+			Assert::AreEqual(size_t(0), pool.ActiveAllocations());
+		}
+
+	private:
+		inline static _CrtMemState _startMemState;
+	};
+}
@@ -0,0 +1,114 @@
+#include "pch.h"
+#include "CppUnitTest.h"
+#include "Stack.h"
+#include "FixedStack.h"
+#include "SmallVector.h"
+#include "Foo.h"
+#include "ToStringSpecializations.h"
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+using namespace FieaGameEngine;
+using namespace std;
+using namespace UnitTests;
+
+namespace LibraryDesktopTests
+{
+	TEST_CLASS(StackTests)
+	{
+	public:
+		TEST_METHOD_INITIALIZE(Initialize)
+		{
+#if defined(DEBUG) || defined(_DEBUG)
+			_CrtSetDbgFlag(_CRTDBG_ALLOC_MEM_DF);
+			_CrtMemCheckpoint(&_startMemState);
+#endif
+		}
+
+		TEST_METHOD_CLEANUP(Cleanup)
+		{
+#if defined(DEBUG) || defined(_DEBUG)
+			_CrtMemState endMemState, diffMemState;
+			_CrtMemCheckpoint(&endMemState);
+			if (_CrtMemDifference(&diffMemState, &_startMemState, &endMemState))
+			{
+				_CrtMemDumpStatistics(&diffMemState);
+				Assert::Fail(L"Memory Leaks!");
+			}
+#endif
+		}
+
+		TEST_METHOD(PushPop)
+		{
+			Stack<Foo> stack;
+			Assert::IsTrue(stack.IsEmpty());
+			Assert::ExpectException<runtime_error>([&stack]() { stack.Pop(); });
+			Assert::ExpectException<runtime_error>([&stack]() { auto& top = stack.Top(); top; });
+
+			stack.Reserve(4);
+			const Foo a{ 1 };
+			stack.Push(a);
+			stack.Push(Foo{ 2 });
+			stack.Emplace(3);
+			Assert::AreEqual(size_t(3), stack.Size());
+			Assert::AreEqual(Foo{ 3 }, stack.Top());
+
+			stack.Pop();
+			Assert::AreEqual(Foo{ 2 }, stack.Top());
+			const Stack<Foo>& constStack = stack;
+			Assert::AreEqual(Foo{ 2 }, constStack.Top());
+
+			stack.Clear();
+			Assert::IsTrue(stack.IsEmpty());
+		}
+
+		TEST_METHOD(InlineContainer)
+		{
+			Stack<string, SmallVector<string, 4>> stack;
+			for (int i = 0; i < 6; ++i)
+				stack.Push(to_string(i));
+			Assert::AreEqual("5"s, stack.Top());
+			for (int i = 0; i < 5; ++i)
+				stack.Pop();
+			Assert::AreEqual("0"s, stack.Top());
+		}
+
+		TEST_METHOD(Fixed)
+		{
+			FixedStack<Foo, 3> stack;
+			Assert::AreEqual(size_t(3), stack.Capacity());
+			Assert::ExpectException<runtime_error>([&stack]() { stack.Pop(); });
+			Assert::ExpectException<runtime_error>([&stack]() { auto& top = stack.Top(); top; });
+
+			stack.Push(Foo{ 1 });
+			stack.Emplace(2);
+			const Foo c{ 3 };
+			stack.Push(c);
+			Assert::IsTrue(stack.IsFull());
+			Assert::ExpectException<overflow_error>([&stack]() { stack.Emplace(4); });
+			Assert::AreEqual(Foo{ 3 }, stack.Top());
+
+			FixedStack<Foo, 3> copy{ stack };
+			Assert::AreEqual(size_t(3), copy.Size());
+			copy.Pop();
+			Assert::AreEqual(Foo{ 2 }, copy.Top());
+
+			FixedStack<Foo, 3> moved{ std::move(stack) };
+			Assert::IsTrue(stack.IsEmpty());
+			Assert::AreEqual(Foo{ 3 }, moved.Top());
+
+			stack = moved;
+			Assert::AreEqual(size_t(3), stack.Size());
+			copy = std::move(moved);
+			Assert::AreEqual(Foo{ 3 }, copy.Top());
+			Assert::IsTrue(moved.IsEmpty());
+
+			const FixedStack<Foo, 3>& constStack = copy;
+			Assert::AreEqual(Foo{ 3 }, constStack.Top());
+			copy.Clear();
+			Assert::IsTrue(copy.IsEmpty());
+		}
+
+	private:
+		inline static _CrtMemState _startMemState;
+	};
+}
@@ -0,0 +1,147 @@
+#include "pch.h"
+#include "CppUnitTest.h"
+#include <thread>
+#include "Symbol.h"
+#include "Scope.h"
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+using namespace FieaGameEngine;
+using namespace std;
+
+namespace LibraryDesktopTests
+{
+	TEST_CLASS(SymbolTests)
+	{
+	public:
+		TEST_METHOD_INITIALIZE(Initialize)
+		{
+#if defined(DEBUG) || defined(_DEBUG)
+			_CrtSetDbgFlag(_CRTDBG_ALLOC_MEM_DF);
+			_CrtMemCheckpoint(&_startMemState);
+#endif
+		}
+
+		TEST_METHOD_CLEANUP(Cleanup)
+		{
+#if defined(DEBUG) || defined(_DEBUG)
+			_CrtMemState endMemState, diffMemState;
+			_CrtMemCheckpoint(&endMemState);
+			if (_CrtMemDifference(&diffMemState, &_startMemState, &endMemState))
+			{
+				_CrtMemDumpStatistics(&diffMemState);
+				Assert::Fail(L"Memory Leaks!");
+			}
+#endif
+		}
+
+		TEST_METHOD(Constructor)
+		{
+			Symbol symbol;
+			Assert::IsFalse(symbol.IsValid());
+			Assert::IsTrue(symbol.Name().empty());
+		}
+
+		TEST_METHOD(Intern)
+		{
+			Symbol health = Symbol::Intern("SymbolTests.Health"sv);
+			Assert::IsTrue(health.IsValid());
+			Assert::IsTrue(health.Name() == "SymbolTests.Health"sv);
+
+			size_t count = Symbol::Count();
+			string name = "SymbolTests.Health"s;
+			Assert::IsTrue(health == Symbol::Intern(name));
+			Assert::AreEqual(count, Symbol::Count());
+
+			Symbol mana = Symbol::Intern("SymbolTests.Mana"sv);
+			Assert::IsTrue(health != mana);
+			Assert::AreEqual(count + 1, Symbol::Count());
+			Assert::AreEqual(health.Id() + 1, mana.Id());
+		}
+
+		TEST_METHOD(Lookup)
+		{
+			Assert::IsFalse(Symbol::Lookup("SymbolTests.NeverInterned"sv).IsValid());
+
+			Symbol position = Symbol::Intern("SymbolTests.Position"sv);
+			Assert::IsTrue(position == Symbol::Lookup("SymbolTests.Position"sv));
+		}
+
+		TEST_METHOD(NamesOutliveGrowth)
+		{
+			Symbol first = Symbol::Intern("SymbolTests.First"sv);
+			string_view firstName = first.Name();
+
+			for (int32_t i = 0; i < 200; ++i)
+				Symbol::Intern("SymbolTests.Growth" + to_string(i));
+
+			Assert::IsTrue(firstName.data() == first.Name().data());
+			Assert::IsTrue(first == Symbol::Lookup("SymbolTests.First"sv));
+			for (int32_t i = 0; i < 200; ++i)
+				Assert::IsTrue(Symbol::Lookup("SymbolTests.Growth" + to_string(i)).Name() == "SymbolTests.Growth" + to_string(i));
+		}
+
+		TEST_METHOD(NamesWhileInterning)
+		{
+			Vector<Symbol> symbols;
+			for (int32_t i = 0; i < 100; ++i)
+				symbols.PushBack(Symbol::Intern("SymbolTests.Existing" + to_string(i)));
+
+			// Names are read, and keys appended by Symbol, while another thread grows the table.
+			thread interner{ []()
+			{
+				for (int32_t i = 0; i < 2000; ++i)
+					Symbol::Intern("SymbolTests.Concurrent" + to_string(i));
+			} };
+			Scope scope;
+			for (int32_t pass = 0; pass < 20; ++pass)
+			{
+				for (int32_t i = 0; i < 100; ++i)
+				{
+					Assert::IsTrue(symbols[i].Name() == "SymbolTests.Existing" + to_string(i));
+					scope.Append(symbols[i]);
+				}
+			}
+			interner.join();
+
+			Assert::AreEqual(size_t(100), scope.Size());
+			Assert::IsNotNull(scope.Find("SymbolTests.Existing99"sv));
+			Assert::IsTrue(Symbol::Lookup("SymbolTests.Concurrent1999"sv).Name() == "SymbolTests.Concurrent1999"sv);
+		}
+
+		TEST_METHOD(ScopeLookup)
+		{
+			Scope rootScope;
+			rootScope.Append("SymbolTests.ScopeHealth"sv);
+			Scope& childScope = rootScope.AppendScope("SymbolTests.Child"sv);
+			Datum& armor = childScope.Append("SymbolTests.ScopeArmor"sv);
+			Datum& health = *rootScope.Find("SymbolTests.ScopeHealth"sv);
+
+			Symbol healthSymbol = Symbol::Lookup("SymbolTests.ScopeHealth"sv);
+			Symbol armorSymbol = Symbol::Lookup("SymbolTests.ScopeArmor"sv);
+			Assert::IsTrue(healthSymbol.IsValid());
+			Assert::IsTrue(armorSymbol.IsValid());
+
+			Assert::IsTrue(&health == rootScope.Find(healthSymbol));
+			Assert::IsNull(rootScope.Find(armorSymbol));
+			Assert::IsNull(rootScope.Find(Symbol{}));
+			Assert::IsTrue(&armor == childScope.Find(armorSymbol));
+			Assert::IsNull(childScope.Find(healthSymbol));
+			Assert::IsTrue(&health == childScope.Search(healthSymbol));
+
+			Scope copy{ rootScope };
+			Assert::IsTrue(copy.Find(healthSymbol) == copy.Find("SymbolTests.ScopeHealth"sv));
+
+			const Scope& constChild = childScope;
+			Assert::IsTrue(&health == constChild.Search(healthSymbol));
+			Assert::IsTrue(&armor == constChild.Find(armorSymbol));
+
+			for (int32_t i = 0; i < 100; ++i)
+				rootScope.Append("SymbolTests.Filler" + to_string(i));
+			Assert::IsTrue(rootScope.Find(healthSymbol) == rootScope.Find("SymbolTests.ScopeHealth"sv));
+			Assert::IsTrue(rootScope.Find(Symbol::Lookup("SymbolTests.Filler99"sv)) == &rootScope[rootScope.Size() - 1]);
+		}
+
+	private:
+		inline static _CrtMemState _startMemState;
+	};
+}
@@ -0,0 +1,123 @@
+#include "pch.h"
+#include "CppUnitTest.h"
+#include <chrono>
+#include <sstream>
+#include "TransformKernels.h"
+#include "TransformStore.h"
+#include "GameObject.h"
+#include "ActionIncrement.h"
+#include "GameState.h"
+#include "EventQueue.h"
+#include "ToStringSpecializations.h"
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+using namespace FieaGameEngine;
+using namespace std;
+using namespace UnitTests;
+
+namespace LibraryDesktopTests
+{
+	TEST_CLASS(TransformKernelsTests)
+	{
+	public:
+		TEST_METHOD_INITIALIZE(Initialize)
+		{
+#if defined(DEBUG) || defined(_DEBUG)
+			_CrtSetDbgFlag(_CRTDBG_ALLOC_MEM_DF);
+			_CrtMemCheckpoint(&_startMemState);
+#endif
+		}
+
+		TEST_METHOD_CLEANUP(Cleanup)
+		{
+#if defined(DEBUG) || defined(_DEBUG)
+			_CrtMemState endMemState, diffMemState;
+			_CrtMemCheckpoint(&endMemState);
+			if (_CrtMemDifference(&diffMemState, &_startMemState, &endMemState))
+			{
+				_CrtMemDumpStatistics(&diffMemState);
+				Assert::Fail(L"Memory Leaks!");
+			}
+#endif
+		}
+
+		TEST_METHOD(Kernels)
+		{
+			// An odd count exercises the tail that is too short for the widest path.
+			Vector<glm::vec4> values;
+			Vector<glm::vec4> rates;
+			for (int32_t i = 0; i < 7; ++i)
+			{
+				values.PushBack(glm::vec4{ float(i), float(-i), 1.0f, 0.0f });
+				rates.PushBack(glm::vec4{ 2.0f, 0.0f, float(i), 4.0f });
+			}
+
+			TransformKernels::Translate(values, glm::vec4{ 1.0f, 2.0f, 3.0f, 0.0f });
+			TransformKernels::Scale(values, glm::vec4{ 2.0f, 1.0f, 0.5f, 1.0f });
+			TransformKernels::Integrate(values, rates, 0.5f);
+			for (int32_t i = 0; i < 7; ++i)
+			{
+				const glm::vec4 expected = glm::vec4{ float(i) + 1.0f, float(-i) + 2.0f, 4.0f, 0.0f } * glm::vec4{ 2.0f, 1.0f, 0.5f, 1.0f } + rates[i] * 0.5f;
+				Assert::IsTrue(expected == values[i]);
+			}
+
+			TransformKernels::Translate(span<glm::vec4>{}, glm::vec4{ 1.0f });
+			rates.PopBack();
+			Assert::ExpectException<runtime_error>([&values, &rates]() { TransformKernels::Integrate(values, rates, 1.0f); });
+		}
+
+		TEST_METHOD(Benchmark)
+		{
+#if defined(DEBUG) || defined(_DEBUG)
+			const size_t objectCount = 10000;
+#else
+			const size_t objectCount = 100000;
+#endif
+			const size_t frameCount = 10;
+
+			EventQueue eventQueue;
+			GameTime gameTime;
+			GameState gameState{ eventQueue, gameTime };
+			TransformStore store;
+			store.Reserve(objectCount);
+
+			GameObject world;
+			for (size_t i = 0; i < objectCount; ++i)
+			{
+				GameObject* gameObject = new GameObject{};
+				gameObject->AppendAuxiliaryAttribute("Counter"s) = 0;
+				ActionIncrement* action = new ActionIncrement{};
+				action->Target = "Counter"s;
+				action->Step = 1;
+				gameObject->Adopt(*action, "Actions"s);
+				world.Adopt(*gameObject, "Children"s);
+			}
+			store.Attach(world);
+			Vector<glm::vec4> velocities(store.Size());
+			for (size_t i = 0; i < store.Size(); ++i)
+				velocities.PushBack(glm::vec4{ 1.0f, 0.0f, 0.0f, 0.0f });
+
+			auto start = chrono::high_resolution_clock::now();
+			for (size_t frame = 0; frame < frameCount; ++frame)
+				world.Update(gameState);
+			auto actionTime = chrono::duration_cast<chrono::nanoseconds>(chrono::high_resolution_clock::now() - start);
+
+			start = chrono::high_resolution_clock::now();
+			for (size_t frame = 0; frame < frameCount; ++frame)
+				TransformKernels::Integrate(store.Positions(), velocities, 1.0f);
+			auto kernelTime = chrono::duration_cast<chrono::nanoseconds>(chrono::high_resolution_clock::now() - start);
+
+			const double updates = double(objectCount * frameCount);
+			wstringstream message;
+			message << objectCount << L" objects, " << frameCount << L" frames: " << double(actionTime.count()) / updates << L" ns/object with an ActionIncrement each, "
+				<< double(kernelTime.count()) / updates << L" ns/object with " << wstring(TransformKernels::InstructionSet().begin(), TransformKernels::InstructionSet().end()) << L" Integrate";
+			Logger::WriteMessage(message.str().c_str());
+
+			Assert::AreEqual(int32_t(frameCount), world.GetChildren()[objectCount - 1]["Counter"s].Get<int32_t>());
+			Assert::AreEqual(float(frameCount), static_cast<GameObject&>(world.GetChildren()[objectCount - 1]).GetPosition().x);
+		}
+
+	private:
+		inline static _CrtMemState _startMemState;
+	};
+}
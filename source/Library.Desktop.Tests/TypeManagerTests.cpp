@@ -46,8 +46,38 @@ namespace UnitTestLibraryDesktop
 			TypeManager::GetInstance()->RegisterType<AttributedFoo, Attributed>(AttributedFoo::Signatures());
 			TypeManager::GetInstance()->RegisterType<AttributedBar, AttributedFoo>(AttributedBar::Signatures());
 
-			const Vector<Signature>& signatures = TypeManager::GetInstance()->_signatureMap.Find(AttributedBar::TypeIdClass())->second;
-			Assert::AreEqual(size_t(15), signatures.Size());
+			const SignatureTable& table = TypeManager::GetInstance()->GetSignatureTable(AttributedBar::TypeIdClass());
+			Assert::AreEqual(size_t(15), table.Signatures.Size());
+			Assert::AreEqual(size_t(15), table.Names.Size());
+			// AttributedBar re-declares three of AttributedFoo's attributes, so it only has twelve distinct names.
+			Assert::AreEqual(size_t(12), table.Indices.Size());
+
+			const SignatureTable& parentTable = TypeManager::GetInstance()->GetSignatureTable(AttributedFoo::TypeIdClass());
+			for (size_t i = 0; i < parentTable.Signatures.Size(); ++i)
+			{
+				Assert::IsTrue(parentTable.Signatures[i] == table.Signatures[i]);
+				Assert::IsTrue(parentTable.Names[i] == table.Names[i]);
+			}
+
+			for (size_t i = 0; i < table.Signatures.Size(); ++i)
+			{
+				Assert::IsTrue(table.Names[i].Name() == table.Signatures[i]._name);
+				Assert::IsTrue(table.Signatures[table.Indices.At(table.Names[i])]._name == table.Signatures[i]._name);
+			}
+		}
+
+		TEST_METHOD(SharedSignatureTable)
+		{
+			const SignatureTable& table = TypeManager::GetInstance()->GetSignatureTable(AttributedFoo::TypeIdClass());
+			TypeManager::GetInstance()->RegisterType<AttributedFoo, Attributed>(AttributedFoo::Signatures());
+			Assert::IsTrue(&table == &TypeManager::GetInstance()->GetSignatureTable(AttributedFoo::TypeIdClass()));
+
+			AttributedFoo foo;
+			AttributedFoo copy{ foo };
+			Assert::AreEqual(table.Signatures.Size(), foo.PrescribedAttributes().Size());
+			Assert::IsTrue(copy == foo);
+
+			Assert::ExpectException<runtime_error>([]() { TypeManager::GetInstance()->GetSignatureTable(Scope::TypeIdClass()); });
 		}
 
 	private:
@@ -4,6 +4,8 @@
 #include "Foo.h"
 #include "ToStringSpecializations.h"
 #include "DefaultEquality.h"
+#include <algorithm>
+#include <numeric>
 
 using namespace Microsoft::VisualStudio::CppUnitTestFramework;
 using namespace FieaGameEngine;
@@ -45,6 +47,30 @@ namespace Microsoft::VisualStudio::CppUnitTestFramework
 
 namespace LibraryDesktopTests
 {
+	/// <summary>
+	/// Element that keeps a pointer to itself, so it is only valid if the Vector moves it with its move constructor.
+	/// </summary>
+	struct SelfReferencing final
+	{
+		explicit SelfReferencing(int value) : Value{ value } {}
+		SelfReferencing(const SelfReferencing& other) : Value{ other.Value } {}
+		SelfReferencing(SelfReferencing&& other) noexcept : Value{ other.Value } {}
+		SelfReferencing& operator=(const SelfReferencing& rhs) { Value = rhs.Value; return *this; }
+		SelfReferencing& operator=(SelfReferencing&& rhs) noexcept { Value = rhs.Value; return *this; }
+		bool IsValid() const { return Self == this; }
+
+		int Value;
+		const SelfReferencing* Self{ this };
+	};
+
+	struct DoubleIncrement final
+	{
+		size_t operator()(size_t, size_t capacity) const
+		{
+			return std::max(capacity * 2, size_t(1));
+		}
+	};
+
 	TEST_CLASS(VectorTests)
 	{
 	public:
@@ -550,6 +576,123 @@ namespace LibraryDesktopTests
 			Assert::IsTrue(vector.begin() < vector.end());
 		}
 
+		TEST_METHOD(IteratorArithmeticOperators)
+		{
+			//Iterator
+			{
+				Foo a{ 1 };
+				Foo b{ 2 };
+				Foo c{ 3 };
+				Vector<Foo> vector{ a, b, c };
+
+				Vector<Foo>::Iterator it = vector.begin() + 2;
+				Assert::AreEqual(c, *it);
+				Assert::AreEqual(b, *--it);
+				Assert::AreEqual(b, *it--);
+				Assert::AreEqual(a, *it);
+				Assert::ExpectException<runtime_error>([&it]() {--it; });
+
+				Assert::AreEqual(vector.end(), 3 + vector.begin());
+				Assert::AreEqual(vector.begin(), vector.end() - 3);
+				Assert::AreEqual(ptrdiff_t(3), vector.end() - vector.begin());
+				Assert::AreEqual(c, vector.begin()[2]);
+				Assert::AreEqual(1, vector.begin()->Data());
+
+				it += 2;
+				Assert::AreEqual(c, *it);
+				it -= 1;
+				Assert::AreEqual(b, *it);
+				Assert::IsTrue(vector.begin() < it);
+				Assert::IsTrue(vector.end() > it);
+				Assert::IsTrue(it <= it);
+				Assert::IsTrue(it >= vector.begin());
+
+				Vector<Foo>::Iterator defaultIt;
+				Assert::ExpectException<runtime_error>([&defaultIt]() {--defaultIt; });
+			}
+
+			//ConstIterator
+			{
+				const Foo a{ 1 };
+				const Foo b{ 2 };
+				const Foo c{ 3 };
+				const Vector<Foo> vector{ a, b, c };
+
+				Vector<Foo>::ConstIterator it = vector.end() - 1;
+				Assert::AreEqual(c, *it);
+				Assert::AreEqual(c, *it--);
+				Assert::AreEqual(a, *--it);
+				Assert::ExpectException<runtime_error>([&it]() {it--; });
+
+				Assert::AreEqual(ptrdiff_t(3), vector.end() - vector.begin());
+				Assert::AreEqual(b, vector.begin()[1]);
+				Assert::AreEqual(3, (vector.begin() + 2)->Data());
+				Assert::IsTrue(vector.begin() <= vector.end());
+				Assert::IsFalse(vector.begin() >= vector.end());
+			}
+		}
+
+		TEST_METHOD(StandardAlgorithms)
+		{
+			Vector<int> vector;
+			for (int i = 0; i < 100; ++i)
+				vector.PushBack((i * 37) % 100);
+
+			std::sort(vector.begin(), vector.end());
+			Assert::IsTrue(std::is_sorted(vector.begin(), vector.end()));
+			Assert::AreEqual(0, vector.Front());
+			Assert::AreEqual(99, vector.Back());
+
+			const Vector<int>& constVector = vector;
+			Vector<int>::ConstIterator found = std::lower_bound(constVector.begin(), constVector.end(), 42);
+			Assert::AreEqual(ptrdiff_t(42), found - constVector.begin());
+			Assert::AreEqual(4950, std::accumulate(constVector.begin(), constVector.end(), 0));
+
+			Vector<int>::Iterator partitionPoint = std::partition(vector.begin(), vector.end(), [](int value) { return value % 2 == 0; });
+			Assert::AreEqual(ptrdiff_t(50), partitionPoint - vector.begin());
+			Assert::IsTrue(std::all_of(vector.begin(), partitionPoint, [](int value) { return value % 2 == 0; }));
+
+			std::reverse(vector.begin(), vector.end());
+			Assert::IsTrue(std::all_of(vector.begin(), vector.begin() + 50, [](int value) { return value % 2 != 0; }));
+		}
+
+		TEST_METHOD(DataAndSpan)
+		{
+			Vector<Foo> vector;
+			Assert::IsNull(vector.Data());
+
+			Foo a{ 1 };
+			Foo b{ 2 };
+			vector.PushBack(a);
+			vector.PushBack(b);
+			Assert::IsTrue(&vector.Front() == vector.Data());
+			Assert::IsTrue(&*vector.begin() == std::to_address(vector.begin()));
+
+			std::span<Foo> span = vector;
+			Assert::AreEqual(size_t(2), span.size());
+			Assert::AreEqual(b, span[1]);
+			span[0] = b;
+			Assert::AreEqual(b, vector.Front());
+
+			const Vector<Foo>& constVector = vector;
+			std::span<const Foo> constSpan = constVector;
+			Assert::IsTrue(constVector.Data() == constSpan.data());
+			Assert::AreEqual(vector.Size(), constSpan.size());
+
+			// The end iterator converts to an address without being dereferenced, as ranges of a contiguous iterator need.
+			Assert::IsTrue(vector.Data() + vector.Size() == std::to_address(vector.end()));
+			Assert::IsTrue(constVector.Data() + constVector.Size() == std::to_address(constVector.end()));
+			std::span<Foo> iteratorSpan{ vector.begin(), vector.end() };
+			Assert::AreEqual(vector.Size(), iteratorSpan.size());
+			Assert::ExpectException<std::runtime_error>([&vector]() { *vector.end(); });
+
+			Vector<int> empty;
+			std::span<int> emptySpan{ empty.begin(), empty.end() };
+			Assert::IsTrue(emptySpan.empty());
+			std::reverse(empty.begin(), empty.end());
+			Assert::IsTrue(empty.IsEmpty());
+		}
+
 		TEST_METHOD(Find)
 		{
 			//Non-const version
@@ -618,6 +761,80 @@ namespace LibraryDesktopTests
 			}
 		}
 
+		TEST_METHOD(Growth)
+		{
+			//Default policy grows geometrically
+			{
+				Vector<int> vector;
+				size_t reallocations = 0;
+				size_t capacity = vector.Capacity();
+				for (int i = 0; i < 1000; ++i)
+				{
+					vector.PushBack(i);
+					if (vector.Capacity() != capacity)
+					{
+						Assert::IsTrue(vector.Capacity() >= capacity + capacity / 2);
+						capacity = vector.Capacity();
+						++reallocations;
+					}
+				}
+				Assert::IsTrue(reallocations < 20);
+				for (int i = 0; i < 1000; ++i)
+					Assert::AreEqual(i, vector[i]);
+			}
+
+			//Custom policy
+			{
+				Vector<int, DoubleIncrement> vector;
+				vector.PushBack(1);
+				Assert::AreEqual(size_t(1), vector.Capacity());
+				vector.PushBack(2);
+				Assert::AreEqual(size_t(2), vector.Capacity());
+				vector.PushBack(3);
+				Assert::AreEqual(size_t(4), vector.Capacity());
+				vector.ShrinkToFit();
+				Assert::AreEqual(size_t(3), vector.Capacity());
+				Assert::AreEqual(3, vector.Back());
+			}
+		}
+
+		TEST_METHOD(NonTrivialElements)
+		{
+			//Strings long enough to live on the heap and short enough to live in the string itself
+			{
+				Vector<string> vector;
+				for (int i = 0; i < 50; ++i)
+					vector.PushBack(i % 2 == 0 ? to_string(i) : string(40, char('a' + i % 26)) + to_string(i));
+
+				Assert::IsTrue(vector.Remove(vector.cbegin() + 10, vector.cbegin() + 20));
+				Assert::AreEqual(size_t(40), vector.Size());
+				Assert::AreEqual(string{ "8" }, vector[8]);
+				Assert::AreEqual(string{ "20" }, vector[10]);
+				Assert::IsTrue(vector.Remove(string{ "20" }));
+				Assert::AreEqual(string(40, char('a' + 21 % 26)) + "21", vector[10]);
+
+				vector.ShrinkToFit();
+				Assert::AreEqual(size_t(39), vector.Capacity());
+				Assert::AreEqual(string{ "48" }, vector[37]);
+			}
+
+			//Elements that must be moved rather than copied byte for byte
+			{
+				Vector<SelfReferencing> vector;
+				for (int i = 0; i < 100; ++i)
+					vector.EmplaceBack(i);
+
+				Assert::IsTrue(vector.Remove(vector.cbegin(), vector.cbegin() + 3));
+				vector.ShrinkToFit();
+				Assert::AreEqual(size_t(97), vector.Size());
+				for (size_t i = 0; i < vector.Size(); ++i)
+				{
+					Assert::IsTrue(vector[i].IsValid());
+					Assert::AreEqual(int(i) + 3, vector[i].Value);
+				}
+			}
+		}
+
 		TEST_METHOD(EmplaceBack)
 		{
 			Foo a{ 1 };
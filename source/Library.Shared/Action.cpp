@@ -1,12 +1,13 @@
 #include "pch.h"
 #include "Action.h"
+#include "ReactionMessage.h"
 
 namespace FieaGameEngine
 {
 	RTTI_DEFINITIONS(Action);
 
-	Action::Action(RTTI::IdType typeId)
-		: Attributed(typeId)
+	Action::Action(RTTI::IdType typeId, IAllocator& allocator)
+		: Attributed(typeId, allocator)
 	{
 	}
 
@@ -22,6 +23,52 @@ namespace FieaGameEngine
 		}
 	}
 
+	void Action::ExtractArguments(const ReactionMessage& payload)
+	{
+		bool isBound = _argumentBindings.Size() == payload.ArgumentCount() && IsSearchChainUnchanged();
+		for (size_t i = 0; isBound && i < payload.ArgumentCount(); ++i)
+			isBound = _argumentBindings[i].first == payload.GetArgument(i).Name;
+
+		if (!isBound)
+		{
+			_argumentBindings.Clear();
+			for (size_t i = 0; i < payload.ArgumentCount(); ++i)
+			{
+				const Symbol name = payload.GetArgument(i).Name;
+				_argumentBindings.PushBack(std::make_pair(name, Search(name)));
+			}
+
+			_boundScopes.Clear();
+			for (const Scope* scope = this; scope != nullptr; scope = scope->GetParent())
+				_boundScopes.PushBack(std::make_pair(scope, scope->LayoutGeneration()));
+		}
+
+		for (size_t i = 0; i < payload.ArgumentCount(); ++i)
+		{
+			Datum* target = _argumentBindings[i].second;
+			if (target == nullptr)
+				continue;
+
+			const ReactionMessage::Argument& argument = payload.GetArgument(i);
+			if (argument.Type == Datum::DatumTypes::Integer)
+				target->Set(argument.Integer);
+			else
+				target->Set(argument.Float);
+		}
+	}
+
+	bool Action::IsSearchChainUnchanged() const
+	{
+		// Each Scope's generation also covers its parent pointer, so the walk only follows Scopes that are still the ones remembered.
+		const Scope* scope = this;
+		for (size_t i = 0; i < _boundScopes.Size(); ++i, scope = scope->GetParent())
+		{
+			if (scope != _boundScopes[i].first || scope->LayoutGeneration() != _boundScopes[i].second)
+				return false;
+		}
+		return scope == nullptr;
+	}
+
 	Vector<Signature> Action::Signatures()
 	{
 		return Vector{ Signature{"Name", Datum::DatumTypes::String, 1, offsetof(Action, Name)} };
@@ -5,6 +5,8 @@
 
 namespace FieaGameEngine
 {
+	class ReactionMessage;
+
 	class Action : public Attributed
 	{
 		RTTI_DECLARATIONS(Action, Attributed);
@@ -30,6 +32,15 @@ namespace FieaGameEngine
 		/// <param name="payload"> Const reference to the payload to extract the auxiliary attributes from. </param>
 		void ExtractArguments(const Attributed& payload);
 
+		/// <summary>
+		/// Function to extract the arguments of a compact payload and use them as parameters. Arguments keep their types, so no value is converted.
+		/// The Datums the arguments land in are searched for once and remembered; they are only searched for again when a message names
+		/// different arguments, or when the LayoutGeneration of "this" Action or one of its ancestors shows that it has grown or been reparented since.
+		/// Changes to any other Scope leave the remembered Datums alone.
+		/// </summary>
+		/// <param name="payload"> Const reference to the payload to extract the arguments from. </param>
+		void ExtractArguments(const ReactionMessage& payload);
+
 		std::string Name;
 
 	protected:
@@ -37,8 +48,26 @@ namespace FieaGameEngine
 		/// Constructor that calls Attributed's constructor with the passed in typeId.
 		/// </summary>
 		/// <param name="typeId"> The typeId of the child Action to pass into Attributed's constructor. </param>
-		Action(RTTI::IdType typeId);
+		/// <param name="allocator"> The allocator the Action takes its storage from. </param>
+		Action(RTTI::IdType typeId, IAllocator& allocator = IAllocator::Default());
 
 		Scope _arguments;
+
+	private:
+		/// <summary>
+		/// The argument names of the last compact payload, in slot order, each with the Datum it was found to land in, or nullptr.
+		/// </summary>
+		Vector<std::pair<Symbol, Datum*>> _argumentBindings;
+
+		/// <summary>
+		/// The Scopes the arguments were searched through, from "this" Action up to the root, each with its LayoutGeneration at the time.
+		/// </summary>
+		Vector<std::pair<const Scope*, std::uint64_t>> _boundScopes;
+
+		/// <summary>
+		/// Checks that the Search chain is made of the same Scopes as when the arguments were bound, none of which has changed since.
+		/// </summary>
+		/// <returns> True if the remembered Datums are still the ones Search would find, false otherwise. </returns>
+		bool IsSearchChainUnchanged() const;
 	};
 }
\ No newline at end of file
@@ -5,13 +5,82 @@ using namespace std;
 
 namespace FieaGameEngine
 {
+	namespace
+	{
+		template <typename T>
+		void CopyValues(Datum& target, const Datum& source)
+		{
+			for (size_t i = 0; i < source.Size(); ++i)
+				target.Get<T>(i) = source.Get<T>(i);
+		}
+
+		/// <summary>
+		/// Copies the values of one Datum over those of another of the same type and size, reusing the storage the target already has.
+		/// </summary>
+		/// <returns> True if the values were copied, false if the Datums differ in shape and must be copy assigned instead. </returns>
+		bool CopyValuesInPlace(Datum& target, const Datum& source)
+		{
+			if (target.Type() != source.Type() || target.Size() != source.Size() || target.IsExternal() || source.IsExternal())
+				return false;
+
+			switch (source.Type())
+			{
+			case Datum::DatumTypes::Integer:
+				CopyValues<int>(target, source);
+				return true;
+			case Datum::DatumTypes::Float:
+				CopyValues<float>(target, source);
+				return true;
+			case Datum::DatumTypes::String:
+				CopyValues<string>(target, source);
+				return true;
+			case Datum::DatumTypes::Vector:
+				CopyValues<glm::vec4>(target, source);
+				return true;
+			case Datum::DatumTypes::Matrix:
+				CopyValues<glm::mat4>(target, source);
+				return true;
+			case Datum::DatumTypes::Pointer:
+				CopyValues<RTTI*>(target, source);
+				return true;
+			default:
+				return false;
+			}
+		}
+	}
+
 	RTTI_DEFINITIONS(ActionEvent);
 
 	ActionEvent::ActionEvent()
-		: Action(ActionEvent::TypeIdClass())
+		: ActionEvent(IAllocator::Default())
 	{
 	}
 
+	ActionEvent::ActionEvent(IAllocator& allocator)
+		: Action(ActionEvent::TypeIdClass(), allocator)
+	{
+	}
+
+	ActionEvent::ActionEvent(const ActionEvent& other)
+		: Action(other), _subtype{ other._subtype }, _delay{ other._delay }, _isPayloadCompact{ other._isPayloadCompact }, _argumentNames{ other._argumentNames }
+	{
+	}
+
+	ActionEvent& ActionEvent::operator=(const ActionEvent& rhs)
+	{
+		if (this != &rhs)
+		{
+			Action::operator=(rhs);
+			_subtype = rhs._subtype;
+			_delay = rhs._delay;
+			_isPayloadCompact = rhs._isPayloadCompact;
+			_argumentNames = rhs._argumentNames;
+			_eventPool = EventPool<ReactionMessageAttributed>::Create();
+			_compactEventPool = EventPool<ReactionMessage>::Create();
+		}
+		return *this;
+	}
+
 	ActionEvent* ActionEvent::Clone() const
 	{
 		return new ActionEvent{ *this };
@@ -19,10 +88,23 @@ namespace FieaGameEngine
 
 	void ActionEvent::Update(GameState& gameState)
 	{
-		ReactionMessageAttributed reactionMessage{ _subtype, gameState };
+		if (_isPayloadCompact && BindArguments())
+		{
+			shared_ptr<Event<ReactionMessage>> reactionEvent = _compactEventPool->Acquire([this, &gameState]() { return ReactionMessage{ _subtype, gameState }; }, size_t(_subtype));
+			ReactionMessage& reactionMessage = reactionEvent->Message();
+			reactionMessage.SetSubtype(_subtype);
+			reactionMessage.SetGameState(gameState);
+			PopulateArguments(reactionMessage);
+			gameState.GetEventQueue().Enqueue(std::move(reactionEvent), gameState.GetGameTime(), chrono::milliseconds(_delay));
+			return;
+		}
+
+		shared_ptr<Event<ReactionMessageAttributed>> reactionEvent = _eventPool->Acquire([this, &gameState]() { return ReactionMessageAttributed{ _subtype, gameState }; }, size_t(_subtype));
+		ReactionMessageAttributed& reactionMessage = reactionEvent->Message();
+		reactionMessage.SetSubtype(_subtype);
+		reactionMessage.SetGameState(gameState);
 		PopulateArguments(reactionMessage);
-		shared_ptr reactionEvent = make_shared<Event<ReactionMessageAttributed>>(reactionMessage);
-		gameState.GetEventQueue().Enqueue(reactionEvent, gameState.GetGameTime(), chrono::milliseconds(_delay));
+		gameState.GetEventQueue().Enqueue(std::move(reactionEvent), gameState.GetGameTime(), chrono::milliseconds(_delay));
 	}
 
 	void ActionEvent::PopulateArguments(ReactionMessageAttributed& reactionMessage)
@@ -31,8 +113,51 @@ namespace FieaGameEngine
 		for (auto it = auxiliaryAttributes.begin(); it != auxiliaryAttributes.end(); ++it)
 		{
 			Datum& auxDatum = reactionMessage.AppendAuxiliaryAttribute(*it);
-			auxDatum = operator[](*it);
+			const Datum& datum = operator[](*it);
+			if (!CopyValuesInPlace(auxDatum, datum))
+				auxDatum = datum;
+		}
+	}
+
+	void ActionEvent::PopulateArguments(ReactionMessage& reactionMessage)
+	{
+		const size_t first = Attributes().Size() - _argumentNames.Size();
+		reactionMessage.ClearArguments();
+		for (size_t i = 0; i < _argumentNames.Size(); ++i)
+			reactionMessage.AppendArgument(_argumentNames[i], operator[](first + i));
+	}
+
+	bool ActionEvent::BindArguments()
+	{
+		const auto auxiliaryAttributes = AuxiliaryAttributes();
+		if (auxiliaryAttributes.Size() > ReactionMessage::Capacity)
+			return false;
+
+		// Attributes are only ever appended, so a change in count is the only way the names can have changed.
+		if (_argumentNames.Size() != auxiliaryAttributes.Size())
+		{
+			_argumentNames.Clear();
+			for (const string& name : auxiliaryAttributes)
+				_argumentNames.PushBack(Symbol::Intern(name));
 		}
+
+		const size_t first = Attributes().Size() - _argumentNames.Size();
+		for (size_t i = 0; i < _argumentNames.Size(); ++i)
+		{
+			if (!ReactionMessage::CanCarry(operator[](first + i)))
+				return false;
+		}
+		return true;
+	}
+
+	void ActionEvent::SetCompactPayload(bool isCompact)
+	{
+		_isPayloadCompact = isCompact;
+	}
+
+	bool ActionEvent::IsPayloadCompact() const
+	{
+		return _isPayloadCompact;
 	}
 
 	Vector<Signature> ActionEvent::Signatures()
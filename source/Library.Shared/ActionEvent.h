@@ -1,6 +1,8 @@
 #pragma once
 #include "Action.h"
 #include "ReactionMessageAttributed.h"
+#include "ReactionMessage.h"
+#include "EventPool.h"
 #include "Factory.h"
 
 namespace FieaGameEngine
@@ -12,6 +14,29 @@ namespace FieaGameEngine
 	public:
 		ActionEvent();
 
+		/// <summary>
+		/// Constructor for ActionEvent that takes its storage from the given allocator, as factories do when creating it in one.
+		/// </summary>
+		/// <param name="allocator"> The allocator the ActionEvent takes its storage from. </param>
+		explicit ActionEvent(IAllocator& allocator);
+
+		/// <summary>
+		/// Copy constructor for ActionEvent. The copy gets event pools of its own, as its auxiliary attributes may go on to differ.
+		/// </summary>
+		/// <param name="other"> The ActionEvent to be copied. </param>
+		ActionEvent(const ActionEvent& other);
+
+		/// <summary>
+		/// Copy assignment operator for ActionEvent. "this" gets fresh event pools, rather than keep messages shaped like the old attributes.
+		/// </summary>
+		/// <param name="rhs"> The ActionEvent to be copied onto "this" one. </param>
+		/// <returns> Reference to "this" ActionEvent after copying. </returns>
+		ActionEvent& operator=(const ActionEvent& rhs);
+
+		ActionEvent(ActionEvent&& other) noexcept = default;
+		ActionEvent& operator=(ActionEvent&& rhs) noexcept = default;
+		~ActionEvent() = default;
+
 		/// <summary>
 		/// Virtual constructor for ActionEvent. Calling context is responsible for deleting this pointer.
 		/// </summary>
@@ -19,11 +44,28 @@ namespace FieaGameEngine
 		ActionEvent* Clone() const override;
 
 		/// <summary>
-		/// Virtual Update function that creates and enqueues an Event of type ReactionMessageAttributed.
+		/// Virtual Update function that enqueues an Event carrying the Auxiliary attributes of "this", on the channel of its subtype.
+		/// The Event is a ReactionMessageAttributed, unless the compact payload has been opted into and every Auxiliary attribute is a single
+		/// integer or float that fits in a ReactionMessage.
+		/// Events come from pools that the ActionEvent keeps, so once the events fired earlier have been delivered, firing again reuses them.
 		/// </summary>
 		/// <param name="gameState"> A reference to a GameState instance. </param>
 		void Update(GameState& gameState) override;
 
+		/// <summary>
+		/// Function to opt in to the compact payload. The Attributed payload, the default, reaches every Event&lt;ReactionMessageAttributed&gt; subscriber
+		/// and can be inspected like any other Scope, while the compact one is far cheaper to fill and to deliver but only reaches subscribers to Event&lt;ReactionMessage&gt;,
+		/// such as ReactionAttributed.
+		/// </summary>
+		/// <param name="isCompact"> True to publish ReactionMessage events when the arguments allow it, false to always publish ReactionMessageAttributed events. </param>
+		void SetCompactPayload(bool isCompact);
+
+		/// <summary>
+		/// Function to check if "this" has opted in to the compact payload.
+		/// </summary>
+		/// <returns> True if "this" publishes ReactionMessage events when the arguments allow it, false if it always publishes ReactionMessageAttributed events. </returns>
+		bool IsPayloadCompact() const;
+
 		/// <summary>
 		/// Static function that returns the Signatures of all Attributes of ActionEvent.
 		/// </summary>
@@ -33,13 +75,37 @@ namespace FieaGameEngine
 	private:
 		/// <summary>
 		/// Helper function to populate the ReactionMessageAttributed payload with the Auxiliary attributes of "this" object.
+		/// A recycled payload already has the attributes, so only their values are copied.
 		/// </summary>
 		/// <param name="reactionMessage"> Reference to the ReactionMessageAttributed to populate. </param>
 		void PopulateArguments(ReactionMessageAttributed& reactionMessage);
 
+		/// <summary>
+		/// Helper function to populate the compact payload with the Auxiliary attributes of "this" object, reading them by position.
+		/// </summary>
+		/// <param name="reactionMessage"> Reference to the ReactionMessage to populate. </param>
+		void PopulateArguments(ReactionMessage& reactionMessage);
+
+		/// <summary>
+		/// Helper function that resolves the names of the Auxiliary attributes to Symbols, once for each time attributes are appended,
+		/// and checks if their current values can all travel in a ReactionMessage.
+		/// </summary>
+		/// <returns> True if the compact payload can carry the arguments, false if not. </returns>
+		bool BindArguments();
+
 		ReactionSubtypes _subtype{0};
-		int _delay;
+		int _delay{ 0 };
+
+		bool _isPayloadCompact{ false };
+
+		/// <summary>
+		/// Symbols of the Auxiliary attributes, in the order they were appended, which is the order of the slots of a compact payload.
+		/// </summary>
+		Vector<Symbol> _argumentNames;
+
+		std::shared_ptr<EventPool<ReactionMessageAttributed>> _eventPool{ EventPool<ReactionMessageAttributed>::Create() };
+		std::shared_ptr<EventPool<ReactionMessage>> _compactEventPool{ EventPool<ReactionMessage>::Create() };
 	};
 
-	ConcreteFactory(ActionEvent, Scope);
+	ConcreteScopeFactory(ActionEvent);
 }
\ No newline at end of file
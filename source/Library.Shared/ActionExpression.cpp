@@ -13,8 +13,13 @@ namespace FieaGameEngine
 
 	RTTI_DEFINITIONS(ActionExpression);
 
-	ActionExpression::ActionExpression() 
-		: Action(ActionExpression::TypeIdClass())
+	ActionExpression::ActionExpression()
+		: ActionExpression(IAllocator::Default())
+	{
+	}
+
+	ActionExpression::ActionExpression(IAllocator& allocator)
+		: Action(ActionExpression::TypeIdClass(), allocator)
 	{
 		_operatorsPrecedenceMap.Insert(std::make_pair("^", std::make_pair(4, OrderOfEvaluation::RightToLeft)));
 		_operatorsPrecedenceMap.Insert(std::make_pair("*", std::make_pair(3, OrderOfEvaluation::LeftToRight)));
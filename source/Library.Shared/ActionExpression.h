@@ -9,6 +9,12 @@ namespace FieaGameEngine
 
 	public:
 		ActionExpression();
+
+		/// <summary>
+		/// Constructor for ActionExpression that takes its storage from the given allocator, as factories do when creating it in one.
+		/// </summary>
+		/// <param name="allocator"> The allocator the ActionExpression takes its storage from. </param>
+		explicit ActionExpression(IAllocator& allocator);
 		void Update(GameState& gameState)override;
 
 		ActionExpression* Clone() const override;
@@ -37,5 +43,5 @@ namespace FieaGameEngine
 		HashMap<std::string, std::pair<std::int32_t, OrderOfEvaluation>> _operatorsPrecedenceMap;
 	};
 
-	ConcreteFactory(ActionExpression, Scope)
+	ConcreteScopeFactory(ActionExpression)
 }
\ No newline at end of file
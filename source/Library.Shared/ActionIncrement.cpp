@@ -7,7 +7,12 @@ namespace FieaGameEngine
 	RTTI_DEFINITIONS(ActionIncrement);
 
 	ActionIncrement::ActionIncrement()
-		: Action(ActionIncrement::TypeIdClass())
+		: ActionIncrement(IAllocator::Default())
+	{
+	}
+
+	ActionIncrement::ActionIncrement(IAllocator& allocator)
+		: Action(ActionIncrement::TypeIdClass(), allocator)
 	{
 	}
 
@@ -18,13 +23,27 @@ namespace FieaGameEngine
 
 	void ActionIncrement::Update(GameState&)
 	{
-		Datum* datum = Search(Target);
+		if (!_targetSymbol.IsValid())
+			PostLoad();
+
+		Datum* datum = Search(_targetSymbol);
 		if (datum == nullptr)
 			throw runtime_error("Target Datum was not found");
 		assert(datum->Type() == Datum::DatumTypes::Integer);
 		datum->Get<int>() += Step;
 	}
 
+	void ActionIncrement::PostLoad()
+	{
+		_targetSymbol = Symbol::Intern(Target);
+	}
+
+	void ActionIncrement::SetTarget(const string& target)
+	{
+		Target = target;
+		PostLoad();
+	}
+
 	Vector<Signature> ActionIncrement::Signatures()
 	{
 		return Vector{
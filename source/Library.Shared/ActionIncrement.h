@@ -10,6 +10,12 @@ namespace FieaGameEngine
 
 	public:
 		ActionIncrement();
+
+		/// <summary>
+		/// Constructor for ActionIncrement that takes its storage from the given allocator, as factories do when creating it in one.
+		/// </summary>
+		/// <param name="allocator"> The allocator the ActionIncrement takes its storage from. </param>
+		explicit ActionIncrement(IAllocator& allocator);
 		ActionIncrement(const ActionIncrement& other) = default;
 		ActionIncrement(ActionIncrement&& other) noexcept = default;
 		ActionIncrement& operator=(const ActionIncrement& rhs) noexcept = default;
@@ -28,15 +34,36 @@ namespace FieaGameEngine
 		/// <param name="gameTime"> A const reference to a GameTime instance. </param>
 		void Update(GameState& gameState) override;
 
+		/// <summary>
+		/// Resolves Target to a Symbol once loading has written it, so that Update only has to search for it.
+		/// </summary>
+		void PostLoad() override;
+
+		/// <summary>
+		/// Function to set the name of the Datum to increment, resolving it to a Symbol straight away.
+		/// </summary>
+		/// <param name="target"> The name of the Datum to increment. </param>
+		void SetTarget(const std::string& target);
+
 		/// <summary>
 		/// Static function that returns the Signatures of all Attributes of ActionIncrement.
 		/// </summary>
 		/// <returns> The Vector of signatures of the Attributes of the ActionIncrement class.</returns>
 		static Vector<Signature> Signatures();
 
+		/// <summary>
+		/// The name of the Datum to increment. Writing it directly, rather than through SetTarget, must be followed by a call to PostLoad.
+		/// </summary>
 		std::string Target;
 		int32_t Step;
+
+	private:
+		/// <summary>
+		/// Target, interned when it is set or loaded so that updates resolve it with integer compares.
+		/// An ActionIncrement whose Target was written directly and never resolved interns it on its first update.
+		/// </summary>
+		Symbol _targetSymbol;
 	};
 
-	ConcreteFactory(ActionIncrement, Scope);
+	ConcreteScopeFactory(ActionIncrement);
 }
\ No newline at end of file
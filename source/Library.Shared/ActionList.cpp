@@ -7,12 +7,17 @@ namespace FieaGameEngine
 	RTTI_DEFINITIONS(ActionList);
 
 	ActionList::ActionList()
-		: Action(ActionList::TypeIdClass())
+		: ActionList(IAllocator::Default())
 	{
 	}
 
-	ActionList::ActionList(RTTI::IdType idType)
-		: Action(idType)
+	ActionList::ActionList(IAllocator& allocator)
+		: Action(ActionList::TypeIdClass(), allocator)
+	{
+	}
+
+	ActionList::ActionList(RTTI::IdType idType, IAllocator& allocator)
+		: Action(idType, allocator)
 	{
 	}
 
@@ -10,6 +10,12 @@ namespace FieaGameEngine
 
 	public:
 		ActionList();
+
+		/// <summary>
+		/// Constructor for ActionList that takes its storage from the given allocator, as factories do when creating it in one.
+		/// </summary>
+		/// <param name="allocator"> The allocator the ActionList takes its storage from. </param>
+		explicit ActionList(IAllocator& allocator);
 		ActionList(const ActionList& other) = default;
 		ActionList(ActionList&& other) noexcept = default;
 		ActionList& operator=(const ActionList& rhs) = default;
@@ -45,7 +51,8 @@ namespace FieaGameEngine
 		/// Constructor that calls Action's constructor with the passed in typeId.
 		/// </summary>
 		/// <param name="typeId"> The typeId of the child Action to pass into Action's constructor. </param>
-		ActionList(RTTI::IdType typeId);
+		/// <param name="allocator"> The allocator the ActionList takes its storage from. </param>
+		ActionList(RTTI::IdType typeId, IAllocator& allocator = IAllocator::Default());
 
 		/// <summary>
 		/// Helper function that calls Update on all contained Actions.
@@ -54,5 +61,5 @@ namespace FieaGameEngine
 		void UpdateActions(GameState& gameState);
 	};
 
-	ConcreteFactory(ActionList, Scope);
+	ConcreteScopeFactory(ActionList);
 }
\ No newline at end of file
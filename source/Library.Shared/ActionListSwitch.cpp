@@ -5,7 +5,12 @@ namespace FieaGameEngine
 	RTTI_DEFINITIONS(ActionListSwitch);
 
 	ActionListSwitch::ActionListSwitch()
-		: ActionList(ActionList::TypeIdClass())
+		: ActionListSwitch(IAllocator::Default())
+	{
+	}
+
+	ActionListSwitch::ActionListSwitch(IAllocator& allocator)
+		: ActionList(ActionListSwitch::TypeIdClass(), allocator)
 	{
 	}
 
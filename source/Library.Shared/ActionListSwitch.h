@@ -9,6 +9,12 @@ namespace FieaGameEngine
 
 	public:
 		ActionListSwitch();
+
+		/// <summary>
+		/// Constructor for ActionListSwitch that takes its storage from the given allocator, as factories do when creating it in one.
+		/// </summary>
+		/// <param name="allocator"> The allocator the ActionListSwitch takes its storage from. </param>
+		explicit ActionListSwitch(IAllocator& allocator);
 		ActionListSwitch(const ActionListSwitch& other) = default;
 		ActionListSwitch(ActionListSwitch&& other) noexcept = default;
 		ActionListSwitch& operator=(const ActionListSwitch& other)= default;
@@ -36,5 +42,5 @@ namespace FieaGameEngine
 		int32_t Condition;
 	};
 
-	ConcreteFactory(ActionListSwitch, Scope);
+	ConcreteScopeFactory(ActionListSwitch);
 }
\ No newline at end of file
@@ -0,0 +1,139 @@
+#pragma once
+#include "pch.h"
+#include "ArenaAllocator.h"
+
+namespace FieaGameEngine
+{
+	ArenaAllocator::ArenaAllocator(std::size_t chunkSize, IAllocator& upstream)
+		: _upstream{ &upstream }, _chunkSize{ std::max(chunkSize, ChunkHeaderSize + Alignment) }
+	{
+	}
+
+	ArenaAllocator::~ArenaAllocator()
+	{
+		Release();
+	}
+
+	void* ArenaAllocator::Allocate(std::size_t size)
+	{
+		if (size == 0)
+			return nullptr;
+
+		size = AlignedSize(size);
+		while (_currentChunk == nullptr || static_cast<std::size_t>(ChunkEnd(_currentChunk) - _cursor) < size)
+		{
+			// Chunks kept from before the last reset are reused in order; a block too big for any of them gets a new chunk at the end of the list.
+			Chunk* next = _currentChunk != nullptr ? _currentChunk->Next : _firstChunk;
+			if (next == nullptr)
+			{
+				std::size_t chunkSize = std::max(_chunkSize, ChunkHeaderSize + size);
+				next = reinterpret_cast<Chunk*>(_upstream->Allocate(chunkSize));
+				assert(next != nullptr);
+				next->Next = nullptr;
+				next->Size = chunkSize;
+				if (_currentChunk != nullptr)
+					_currentChunk->Next = next;
+				else
+					_firstChunk = next;
+				++_chunkCount;
+			}
+
+			_currentChunk = next;
+			_cursor = ChunkBegin(next);
+		}
+
+		void* block = _cursor;
+		_cursor += size;
+		_bytesInUse += size;
+		return block;
+	}
+
+	void* ArenaAllocator::Reallocate(void* block, std::size_t size, std::size_t newSize)
+	{
+		if (block == nullptr)
+			return Allocate(newSize);
+
+		if (newSize == 0)
+		{
+			Deallocate(block, size);
+			return nullptr;
+		}
+
+		// Buffers that are grown while they are still the newest block, which is the common case while a document is being loaded, are extended in place.
+		if (IsLastBlock(block, size))
+		{
+			std::byte* blockEnd = reinterpret_cast<std::byte*>(block) + AlignedSize(newSize);
+			if (blockEnd <= ChunkEnd(_currentChunk))
+			{
+				_bytesInUse = _bytesInUse - AlignedSize(size) + AlignedSize(newSize);
+				_cursor = blockEnd;
+				return block;
+			}
+		}
+		else if (AlignedSize(newSize) <= AlignedSize(size))
+			return block;
+
+		void* newBlock = Allocate(newSize);
+		std::memcpy(newBlock, block, std::min(size, newSize));
+		return newBlock;
+	}
+
+	void ArenaAllocator::Deallocate(void* block, std::size_t size)
+	{
+		if (block != nullptr && IsLastBlock(block, size))
+		{
+			_cursor = reinterpret_cast<std::byte*>(block);
+			_bytesInUse -= AlignedSize(size);
+		}
+	}
+
+	void ArenaAllocator::Reset()
+	{
+		_currentChunk = nullptr;
+		_cursor = nullptr;
+		_bytesInUse = 0;
+	}
+
+	void ArenaAllocator::Release()
+	{
+		while (_firstChunk != nullptr)
+		{
+			Chunk* next = _firstChunk->Next;
+			_upstream->Deallocate(_firstChunk, _firstChunk->Size);
+			_firstChunk = next;
+		}
+
+		_chunkCount = 0;
+		Reset();
+	}
+
+	std::size_t ArenaAllocator::BytesInUse() const
+	{
+		return _bytesInUse;
+	}
+
+	std::size_t ArenaAllocator::ChunkCount() const
+	{
+		return _chunkCount;
+	}
+
+	std::size_t ArenaAllocator::AlignedSize(std::size_t size)
+	{
+		return (size + Alignment - 1) / Alignment * Alignment;
+	}
+
+	std::byte* ArenaAllocator::ChunkBegin(Chunk* chunk) const
+	{
+		return reinterpret_cast<std::byte*>(chunk) + ChunkHeaderSize;
+	}
+
+	std::byte* ArenaAllocator::ChunkEnd(Chunk* chunk) const
+	{
+		return reinterpret_cast<std::byte*>(chunk) + chunk->Size;
+	}
+
+	bool ArenaAllocator::IsLastBlock(void* block, std::size_t size) const
+	{
+		return _cursor != nullptr && reinterpret_cast<std::byte*>(block) + AlignedSize(size) == _cursor;
+	}
+}
@@ -0,0 +1,80 @@
+#pragma once
+#include "IAllocator.h"
+
+namespace FieaGameEngine
+{
+	/// <summary>
+	/// Bump allocator for data that is created together and thrown away together, such as everything loaded for one level.
+	/// Blocks are handed out back to back from large chunks. Deallocating is free, and only the most recent block is actually reclaimed;
+	/// everything else comes back at once when the arena is reset. The arena is not thread-safe.
+	/// </summary>
+	class ArenaAllocator final : public IAllocator
+	{
+	public:
+		/// <summary>
+		/// Constructor for ArenaAllocator.
+		/// </summary>
+		/// <param name="chunkSize"> The number of bytes requested from the upstream allocator whenever the arena runs out of room. Larger blocks get a chunk of their own. </param>
+		/// <param name="upstream"> The allocator that chunks are taken from. </param>
+		explicit ArenaAllocator(std::size_t chunkSize = 65536, IAllocator& upstream = IAllocator::Default());
+
+		ArenaAllocator(const ArenaAllocator& other) = delete;
+		ArenaAllocator& operator=(const ArenaAllocator& rhs) = delete;
+		ArenaAllocator(ArenaAllocator&& other) noexcept = delete;
+		ArenaAllocator& operator=(ArenaAllocator&& rhs) noexcept = delete;
+
+		/// <summary>
+		/// Destructor for ArenaAllocator. Releases all chunks back to the upstream allocator.
+		/// </summary>
+		~ArenaAllocator();
+
+		void* Allocate(std::size_t size) override;
+		void* Reallocate(void* block, std::size_t size, std::size_t newSize) override;
+		void Deallocate(void* block, std::size_t size) override;
+
+		/// <summary>
+		/// Function to make the whole arena available again in constant time. The chunks are kept for the next load.
+		/// Destructors are not run, so anything still living in the arena must either have been destroyed already or not need destruction.
+		/// </summary>
+		void Reset();
+
+		/// <summary>
+		/// Function to reset the arena and return all of its chunks to the upstream allocator.
+		/// </summary>
+		void Release();
+
+		/// <summary>
+		/// Function to get the number of bytes handed out since the last reset, including alignment padding.
+		/// </summary>
+		/// <returns> The number of bytes in use. </returns>
+		std::size_t BytesInUse() const;
+
+		/// <summary>
+		/// Function to get the number of chunks taken from the upstream allocator.
+		/// </summary>
+		/// <returns> The number of chunks currently held by the arena. </returns>
+		std::size_t ChunkCount() const;
+
+	private:
+		struct Chunk final
+		{
+			Chunk* Next;
+			std::size_t Size;
+		};
+
+		static constexpr std::size_t ChunkHeaderSize = (sizeof(Chunk) + Alignment - 1) / Alignment * Alignment;
+
+		static std::size_t AlignedSize(std::size_t size);
+		std::byte* ChunkBegin(Chunk* chunk) const;
+		std::byte* ChunkEnd(Chunk* chunk) const;
+		bool IsLastBlock(void* block, std::size_t size) const;
+
+		Chunk* _firstChunk{ nullptr };
+		Chunk* _currentChunk{ nullptr };
+		std::byte* _cursor{ nullptr };
+		IAllocator* _upstream;
+		std::size_t _chunkSize;
+		std::size_t _chunkCount{ 0 };
+		std::size_t _bytesInUse{ 0 };
+	};
+}
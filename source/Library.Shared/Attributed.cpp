@@ -9,23 +9,24 @@ namespace FieaGameEngine
 {
 	RTTI_DEFINITIONS(Attributed);
 
-	Attributed::Attributed(IdType typeID)
+	Attributed::Attributed(IdType typeID, IAllocator& allocator)
+		: Scope{ allocator }
 	{
 		Populate(typeID);
 	}
 
 	Attributed::Attributed(const Attributed& other)
-		: Scope{ other }
+		: Scope{ other }, _signatureTable{ other._signatureTable }
 	{
-		(*this)["this"s] = this;	
-		UpdateExternalPointers(other.TypeIdInstance());
+		_orderVector[0]->second = this;
+		UpdateExternalPointers();
 	}
 
 	Attributed::Attributed(Attributed&& other) noexcept
-		: Scope{ forward<Attributed&&>(other) }
+		: Scope{ forward<Attributed&&>(other) }, _signatureTable{ other._signatureTable }
 	{
-		(*this)["this"s] = this;
-		UpdateExternalPointers(other.TypeIdInstance());
+		_orderVector[0]->second = this;
+		UpdateExternalPointers();
 	}
 
 	Attributed& Attributed::operator=(const Attributed& rhs)
@@ -33,8 +34,9 @@ namespace FieaGameEngine
 		if (this != &rhs)
 		{
 			Scope::operator=(rhs);
-			(*this)["this"s] = this;
-			UpdateExternalPointers(rhs.TypeIdInstance());
+			_signatureTable = rhs._signatureTable;
+			_orderVector[0]->second = this;
+			UpdateExternalPointers();
 		}
 		return *this;
 	}
@@ -44,110 +46,168 @@ namespace FieaGameEngine
 		if (this != &rhs)
 		{
 			Scope::operator=(forward<Attributed&&>(rhs));
-			(*this)["this"s] = this;
-			UpdateExternalPointers(rhs.TypeIdInstance());
+			_signatureTable = rhs._signatureTable;
+			_orderVector[0]->second = this;
+			UpdateExternalPointers();
 		}
 		return *this;
 	}
 
 	void Attributed::Populate(IdType typeID)
 	{
-		(*this)["this"s] = this;
-		const Vector<Signature> vector = TypeManager::GetInstance()->_signatureMap.Find(typeID)->second;
-		Vector<Signature>::ConstIterator it = vector.begin();
-		while (it != vector.end())
+		_signatureTable = &TypeManager::GetInstance()->GetSignatureTable(typeID);
+		const Vector<Signature>& signatures = _signatureTable->Signatures;
+		Reserve(1 + signatures.Size());
+
+		// Interned once, rather than by every Attributed that is constructed.
+		static const Symbol thisSymbol = Symbol::Intern("this"sv);
+		Append(thisSymbol) = this;
+
+		byte* baseAddress = reinterpret_cast<byte*>(this);
+		for (size_t i = 0; i < signatures.Size(); ++i)
 		{
-			const Signature& signature = *it;
-			
-			Datum& datum = Append(signature._name);
+			const Signature& signature = signatures[i];
+
+			Datum& datum = Append(_signatureTable->Names[i]);
+			assert(&datum == &_orderVector[_signatureTable->Slots[i]]->second);
 			if (datum.Type() != Datum::DatumTypes::Unknown && datum.Type() != signature._type)
 				throw runtime_error("Incompatible Datum type.");
 
 			if (signature._type == Datum::DatumTypes::Table)
 				datum.SetType(Datum::DatumTypes::Table);
 			else
-			{
-				byte* baseAddress = reinterpret_cast<byte*>(this);
 				datum.SetStorage(baseAddress + signature._offset, signature._size, signature._type);
-			}
-
-			++it;
 		}
 	}
 
-	void Attributed::UpdateExternalPointers(IdType typeID)
+	void Attributed::UpdateExternalPointers()
 	{
-		const Vector<Signature>& signatures = TypeManager::GetInstance()->_signatureMap.Find(typeID)->second;
-		Vector<Signature>::ConstIterator it = signatures.begin();
+		const Vector<Signature>& signatures = _signatureTable->Signatures;
+		byte* baseAddress = reinterpret_cast<byte*>(this);
 
-		size_t orderVecIndex = 1;
-		while (it != signatures.end())
+		for (size_t i = 0; i < signatures.Size(); ++i)
 		{
-			const Signature& signature = *it;
-			assert(signature._name == _orderVector[orderVecIndex]->first);
-
-			Datum& datum = _orderVector[orderVecIndex]->second;
-
+			const Signature& signature = signatures[i];
+			Datum& datum = _orderVector[_signatureTable->Slots[i]]->second;
 			if (datum._IsExternal)
-			{
-				byte* baseAddress = reinterpret_cast<byte*>(this);
 				datum.SetStorage(baseAddress + signature._offset, signature._size, signature._type);
-			}
-
-			++it;
-			++orderVecIndex;
 		}
 	}
 
-	Datum& Attributed::AppendAuxiliaryAttribute(const string& name)
+	Datum& Attributed::AppendAuxiliaryAttribute(string_view name)
 	{
-		auto prescribedAttributes = PrescribedAttributes();
-		if(prescribedAttributes.Find(name) != prescribedAttributes.end())
+		if (IsPrescribedAttribute(name))
 			throw runtime_error("Prescribed attribute already exists with given key.");
 		
 		return Append(name);
 	}
 
-	const Vector<string> Attributed::Attributes() const
+	Attributed::AttributeView Attributed::Attributes() const
 	{
-		Vector<string> attributes{ _orderVector.Size() };
-		for (size_t i = 0; i < _orderVector.Size(); ++i)
-			attributes.PushBack(_orderVector[i]->first);
-		return attributes;
+		return AttributeView{ _orderVector, 0, _orderVector.Size() };
 	}
 
-	const Vector<string> Attributed::PrescribedAttributes() const
+	Attributed::AttributeView Attributed::PrescribedAttributes() const
 	{
-		const Vector<Signature>& signatures = TypeManager::GetInstance()->_signatureMap.Find(TypeIdInstance())->second;
-		Vector<string> presAttributes{ signatures.Size()};
-		for (size_t i = 0; i < signatures.Size(); ++i)
-			presAttributes.PushBack(signatures[i]._name);
-		return presAttributes;
+		const size_t prescribedCount = _signatureTable->Indices.Size();
+		return AttributeView{ _orderVector, 1, 1 + prescribedCount };
 	}
 
-	const Vector<string> Attributed::AuxiliaryAttributes() const
+	Attributed::AttributeView Attributed::AuxiliaryAttributes() const
 	{
-		const Vector<Signature>& signatures = TypeManager::GetInstance()->_signatureMap.Find(TypeIdInstance())->second;
-		Vector<string> auxAttributes{ _orderVector.Size() - signatures.Size() };
-		for (size_t i = 1 + signatures.Size(); i < _orderVector.Size(); ++i)
-			auxAttributes.PushBack(_orderVector[i]->first);
-		return auxAttributes;
+		const size_t prescribedCount = _signatureTable->Indices.Size();
+		return AttributeView{ _orderVector, 1 + prescribedCount, _orderVector.Size() };
 	}
 
-	bool Attributed::IsAttribute(const string& name) const
+	bool Attributed::IsAttribute(string_view name) const
 	{
-		return name == "this"s || IsPrescribedAttribute(name) || IsAuxiliaryAttribute(name);
+		return name == "this"sv || IsPrescribedAttribute(name) || IsAuxiliaryAttribute(name);
 	}
 
-	bool Attributed::IsPrescribedAttribute(const string& name) const
+	bool Attributed::IsPrescribedAttribute(string_view name) const
 	{
-		auto presAttributes = PrescribedAttributes();
-		return presAttributes.Find(name) != presAttributes.end();
+		return _signatureTable->NameIndices.ContainsKey(name);
 	}
 
-	bool Attributed::IsAuxiliaryAttribute(const string& name) const
+	bool Attributed::IsAuxiliaryAttribute(string_view name) const
 	{
-		auto auxAttributes = AuxiliaryAttributes();
-		return auxAttributes.Find(name) != auxAttributes.end();
+		return name != "this"sv && !IsPrescribedAttribute(name) && _map.ContainsKey(name);
+	}
+
+	void Attributed::PostLoad()
+	{
+	}
+
+	Attributed::AttributeView::AttributeView(const NameVector& names, size_t first, size_t last)
+		: _names{ &names }, _first{ first }, _last{ last }
+	{
+		assert(_first <= _last && _last <= names.Size());
+	}
+
+	size_t Attributed::AttributeView::Size() const
+	{
+		return _last - _first;
+	}
+
+	bool Attributed::AttributeView::IsEmpty() const
+	{
+		return _first == _last;
+	}
+
+	const string& Attributed::AttributeView::operator[](size_t index) const
+	{
+		if (index >= Size())
+			throw out_of_range("Index is out of bounds");
+
+		return (*_names)[_first + index]->first;
+	}
+
+	Attributed::AttributeView::ConstIterator Attributed::AttributeView::begin() const
+	{
+		return ConstIterator{ *_names, _first };
+	}
+
+	Attributed::AttributeView::ConstIterator Attributed::AttributeView::end() const
+	{
+		return ConstIterator{ *_names, _last };
+	}
+
+	Attributed::AttributeView::ConstIterator::ConstIterator(const NameVector& names, size_t index)
+		: _names{ &names }, _index{ index }
+	{
+	}
+
+	bool Attributed::AttributeView::ConstIterator::operator==(const ConstIterator& rhs) const
+	{
+		return _names == rhs._names && _index == rhs._index;
+	}
+
+	bool Attributed::AttributeView::ConstIterator::operator!=(const ConstIterator& rhs) const
+	{
+		return !operator==(rhs);
+	}
+
+	Attributed::AttributeView::ConstIterator& Attributed::AttributeView::ConstIterator::operator++()
+	{
+		if (_names == nullptr)
+			throw runtime_error("Iterator is not associated with a view.");
+
+		++_index;
+		return *this;
+	}
+
+	Attributed::AttributeView::ConstIterator Attributed::AttributeView::ConstIterator::operator++(int)
+	{
+		ConstIterator it = *this;
+		operator++();
+		return it;
+	}
+
+	const string& Attributed::AttributeView::ConstIterator::operator*() const
+	{
+		if (_names == nullptr)
+			throw runtime_error("Iterator is not associated with a view.");
+
+		return (*_names)[_index]->first;
 	}
 }
\ No newline at end of file
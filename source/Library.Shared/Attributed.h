@@ -4,57 +4,151 @@
 namespace FieaGameEngine
 
 {
+	struct SignatureTable;
+
 	class Attributed : public Scope
 	{
 		RTTI_DECLARATIONS(Attributed, Scope);
 
 	public:
+		/// <summary>
+		/// Read-only view over a run of attribute names, in the order they were appended. The names are not copied, so the view is invalidated by appending to the Attributed object.
+		/// </summary>
+		class AttributeView final
+		{
+			friend Attributed;
+			using NameVector = OrderVector;
+
+		public:
+			class ConstIterator final
+			{
+				friend AttributeView;
+
+			public:
+				ConstIterator() = default;
+
+				/// <summary>
+				/// Equality operator for ConstIterator.
+				/// </summary>
+				/// <param name="rhs"> The ConstIterator to compare "this" ConstIterator to. </param>
+				/// <returns> True if both ConstIterators point to the same name, false if they do not. </returns>
+				bool operator==(const ConstIterator& rhs) const;
+
+				/// <summary>
+				/// Inequality operator for ConstIterator.
+				/// </summary>
+				/// <param name="rhs"> The ConstIterator to compare "this" ConstIterator to. </param>
+				/// <returns> True if the ConstIterators point to different names, false if they do not. </returns>
+				bool operator!=(const ConstIterator& rhs) const;
+
+				/// <summary>
+				/// Prefix increment operator which makes the ConstIterator point to the next name.
+				/// </summary>
+				/// <returns> A reference to "this" ConstIterator after incrementing. </returns>
+				ConstIterator& operator++();
+
+				/// <summary>
+				/// Postfix increment operator which makes the ConstIterator point to the next name.
+				/// </summary>
+				/// <returns> A copy of "this" ConstIterator before incrementing. </returns>
+				ConstIterator operator++(int);
+
+				/// <summary>
+				/// Dereference operator for ConstIterator.
+				/// </summary>
+				/// <returns> A const reference to the name the ConstIterator points to. </returns>
+				const std::string& operator*() const;
+
+			private:
+				ConstIterator(const NameVector& names, std::size_t index);
+
+				const NameVector* _names{ nullptr };
+				std::size_t _index{ 0 };
+			};
+
+			/// <summary>
+			/// Function to get the number of names in the view.
+			/// </summary>
+			/// <returns> The number of names in the view. </returns>
+			std::size_t Size() const;
+
+			/// <summary>
+			/// Function to check if the view has no names.
+			/// </summary>
+			/// <returns> True if the view is empty, false if it is not. </returns>
+			bool IsEmpty() const;
+
+			/// <summary>
+			/// Function to get the name at the given position in the view.
+			/// </summary>
+			/// <param name="index"> The position of the name within the view. </param>
+			/// <returns> A const reference to the name. </returns>
+			/// <exception cref="out_of_range"> Throws if the index is greater than or equal to the Size of the view. </exception>
+			const std::string& operator[](std::size_t index) const;
+
+			ConstIterator begin() const;
+			ConstIterator end() const;
+
+		private:
+			AttributeView(const NameVector& names, std::size_t first, std::size_t last);
+
+			const NameVector* _names;
+			std::size_t _first;
+			std::size_t _last;
+		};
+
 		/// <summary>
 		/// Function to append an auxiliary attribute to the Attributed object.
 		/// </summary>
 		/// <param name="name"> The name of the attribute to be appended. </param>
 		/// <returns> Reference to the Datum created by appending the attribute name. </returns>
 		/// <exception cref="runtime_error"> Throws if a prescribed attribute already exists with the same name. </exception>
-		Datum& AppendAuxiliaryAttribute(const std::string& name);
+		Datum& AppendAuxiliaryAttribute(std::string_view name);
 
 		/// <summary>
 		/// Function to get all the attributes of the Attributed object.
 		/// </summary>
-		/// <returns> A Vector containing the names of all the attributes of the object. </returns>
-		const Vector<std::string> Attributes() const;
+		/// <returns> A view of the names of all the attributes of the object, including "this". </returns>
+		AttributeView Attributes() const;
 
 		/// <summary>
 		/// Function to get all the prescribed attributes of the Attributed object.
 		/// </summary>
-		/// <returns> A Vector containing the names of all the prescribed attributes of the object. </returns>
-		const Vector<std::string> PrescribedAttributes() const;
+		/// <returns> A view of the names of all the prescribed attributes of the object. </returns>
+		AttributeView PrescribedAttributes() const;
 
 		/// <summary>
 		/// Function to get all the auxiliary attributes of the Attributed object.
 		/// </summary>
-		/// <returns> A Vector containing the names of all the auxiliary attributes of the object. </returns>
-		const Vector<std::string> AuxiliaryAttributes() const;
+		/// <returns> A view of the names of all the auxiliary attributes of the object. </returns>
+		AttributeView AuxiliaryAttributes() const;
 
 		/// <summary>
 		/// Function to check if a given name is an attribute of the object.
 		/// </summary>
 		/// <param name="name"> The name of the prescribed attribute to check the object for. </param>
 		/// <returns> True if it is an attribute, false if it is not. </returns>
-		bool IsAttribute(const std::string& name) const;
+		bool IsAttribute(std::string_view name) const;
 
 		/// <summary>
 		/// Function to check if a given name is a prescribed attribute of the object.
 		/// </summary>
 		/// <param name="name"> The name of the prescribed attribute to check the object for. </param>
 		/// <returns> True if it is a prescribed attribute, false if it is not. </returns>
-		bool IsPrescribedAttribute(const std::string& name) const;
+		bool IsPrescribedAttribute(std::string_view name) const;
 
 		/// <summary>
 		/// Function to check if a given name is an auxiliary attribute of the object.
 		/// </summary>
 		/// <param name="name"> The name of the auxiliary attribute to check the object for. </param>
 		/// <returns> True if it is an auxiliary attributed, false if it is not. </returns>
-		bool IsAuxiliaryAttribute(const std::string& name) const;
+		bool IsAuxiliaryAttribute(std::string_view name) const;
+
+		/// <summary>
+		/// Hook called once the object has been loaded and its attributes written, such as by TableParseHelper when a table ends.
+		/// Derived classes override it to resolve what they derive from their attributes, so that it is not worked out again at runtime.
+		/// </summary>
+		virtual void PostLoad();
 
 	protected:
 
@@ -64,7 +158,8 @@ namespace FieaGameEngine
 		/// Constructor to construct an Attributed object.
 		/// </summary>
 		/// <param name="typeID"> The type ID of the class. </param>
-		Attributed(RTTI::IdType typeID);
+		/// <param name="allocator"> The allocator the object takes its storage from. </param>
+		Attributed(RTTI::IdType typeID, IAllocator& allocator = IAllocator::Default());
 
 		/// <summary>
 		/// Copy constructor for Attributed to construct an Attributed by copying over the contents of another one.
@@ -103,7 +198,11 @@ namespace FieaGameEngine
 		/// <summary>
 		/// Function to fix the external pointers of the Datums to point to the members of "this" Attributed object, after copying or moving.
 		/// </summary>
-		/// <param name="typeID"> The type ID of the object. </param>
-		void UpdateExternalPointers(RTTI::IdType typeID);
+		void UpdateExternalPointers();
+
+		/// <summary>
+		/// The shared SignatureTable of the object's type, resolved once when the object is populated.
+		/// </summary>
+		const SignatureTable* _signatureTable{ nullptr };
 	};
 }
\ No newline at end of file
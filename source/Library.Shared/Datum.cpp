@@ -5,8 +5,8 @@
 
 namespace FieaGameEngine
 {
-	Datum::Datum(DatumTypes type)
-		: _type{ type }
+	Datum::Datum(DatumTypes type, IAllocator& allocator)
+		: _type{ type }, _allocator{ &allocator }
 	{
 		_data.vp = nullptr;
 	}
@@ -134,7 +134,7 @@ namespace FieaGameEngine
 		{
 			Clear();
 			if (!_IsExternal)
-				free(_data.vp);
+				ReleaseStorage();
 		
 			_data.vp = nullptr;
 			_capacity = 0;
@@ -171,8 +171,14 @@ namespace FieaGameEngine
 	}
 
 	Datum::Datum(Datum&& other) noexcept
-		: _data{ other._data }, _size{ other._size }, _capacity{ other._capacity }, _type{ other._type }, _IsExternal{ other._IsExternal }
+		: _data{ other._data }, _size{ other._size }, _capacity{ other._capacity }, _type{ other._type }, _IsExternal{ other._IsExternal }, _allocator{ other._allocator }
 	{
+		if (other.IsInline())
+		{
+			_data.vp = _inlineStorage;
+			RelocateElements(_inlineStorage, other._inlineStorage, _size);
+		}
+
 		other._data.vp = nullptr;
 		other._size = 0;
 		other._capacity = 0;
@@ -183,13 +189,21 @@ namespace FieaGameEngine
 		if (this != &rhs)
 		{
 			Clear();
-			free(_data.vp);
+			if (!_IsExternal)
+				ReleaseStorage();
 
 			_data = rhs._data;
 			_size = rhs._size;
 			_capacity = rhs._capacity;
 			_type = rhs._type;
 			_IsExternal = rhs._IsExternal;
+			_allocator = rhs._allocator;
+
+			if (rhs.IsInline())
+			{
+				_data.vp = _inlineStorage;
+				RelocateElements(_inlineStorage, rhs._inlineStorage, _size);
+			}
 
 			rhs._data.vp = nullptr;
 			rhs._size = 0;
@@ -204,7 +218,7 @@ namespace FieaGameEngine
 		if (!_IsExternal)
 		{
 			Clear();
-			free(_data.vp);
+			ReleaseStorage();
 		}
 	}
 
@@ -234,14 +248,7 @@ namespace FieaGameEngine
 			return;
 
 		if (capacity > _capacity)
-		{
-			size_t size = DatumTypeSizes[static_cast<int>(_type)];
-			void* data = realloc(_data.vp, capacity * size);
-			assert(data != nullptr);
-
-			_data.vp = data;
-			_capacity = capacity;
-		}
+			Reallocate(capacity);
 	}
 
 	void Datum::PushBack(int value)
@@ -343,7 +350,7 @@ namespace FieaGameEngine
 		if (_size > 0 && !_IsExternal)
 		{
 			Clear();
-			free(_data.vp);
+			ReleaseStorage();
 		}
 
 		_IsExternal = true;
@@ -360,7 +367,7 @@ namespace FieaGameEngine
 		if (_size > 0 && !_IsExternal)
 		{
 			Clear();
-			free(_data.vp);
+			ReleaseStorage();
 		}
 
 		_IsExternal = true;
@@ -377,7 +384,7 @@ namespace FieaGameEngine
 		if (_size > 0 && !_IsExternal)
 		{
 			Clear();
-			free(_data.vp);
+			ReleaseStorage();
 		}
 
 		_IsExternal = true;
@@ -394,7 +401,7 @@ namespace FieaGameEngine
 		if (_size > 0 && !_IsExternal)
 		{
 			Clear();
-			free(_data.vp);
+			ReleaseStorage();
 		}
 
 		_IsExternal = true;
@@ -411,7 +418,7 @@ namespace FieaGameEngine
 		if (_size > 0 && !_IsExternal)
 		{
 			Clear();
-			free(_data.vp);
+			ReleaseStorage();
 		}
 
 		_IsExternal = true;
@@ -428,7 +435,7 @@ namespace FieaGameEngine
 		if (_size > 0 && !_IsExternal)
 		{
 			Clear();
-			free(_data.vp);
+			ReleaseStorage();
 		}
 
 		_IsExternal = true;
@@ -731,6 +738,64 @@ namespace FieaGameEngine
 		_size = 0;
 	}
 
+	void Datum::ReleaseStorage()
+	{
+		if (!IsInline())
+			_allocator->Deallocate(_data.vp, _capacity * DatumTypeSizes[static_cast<int>(_type)]);
+		_data.vp = nullptr;
+		_capacity = 0;
+	}
+
+	void Datum::Reallocate(size_t capacity)
+	{
+		size_t size = DatumTypeSizes[static_cast<int>(_type)];
+		bool fitsInline = capacity * size <= InlineStorageSize;
+
+		if (fitsInline && (_data.vp == nullptr || IsInline()))
+		{
+			_data.vp = _inlineStorage;
+			_capacity = capacity;
+			return;
+		}
+
+		if (!fitsInline && !IsInline() && _type != DatumTypes::String)
+		{
+			void* data = _allocator->Reallocate(_data.vp, _capacity * size, capacity * size);
+			assert(data != nullptr);
+			_data.vp = data;
+			_capacity = capacity;
+			return;
+		}
+
+		void* data = fitsInline ? _inlineStorage : _allocator->Allocate(capacity * size);
+		assert(data != nullptr);
+		if (_data.vp != nullptr)
+		{
+			RelocateElements(data, _data.vp, std::min(_size, capacity));
+			if (!IsInline())
+				_allocator->Deallocate(_data.vp, _capacity * size);
+		}
+
+		_data.vp = data;
+		_capacity = capacity;
+	}
+
+	void Datum::RelocateElements(void* destination, void* source, size_t count) const
+	{
+		if (_type == DatumTypes::String)
+		{
+			std::string* from = reinterpret_cast<std::string*>(source);
+			std::string* to = reinterpret_cast<std::string*>(destination);
+			for (size_t i = 0; i < count; ++i)
+			{
+				new (to + i) std::string(std::move(from[i]));
+				from[i].~basic_string();
+			}
+		}
+		else if (count > 0)
+			memcpy(destination, source, count * DatumTypeSizes[static_cast<int>(_type)]);
+	}
+
 	void Datum::Resize(size_t newSize)
 	{
 		assert(!_IsExternal);
@@ -743,10 +808,10 @@ namespace FieaGameEngine
 				_data.s[i].~basic_string();
 		}
 
-		size_t size = DatumTypeSizes[static_cast<int>(_type)];
-		void* data = realloc(_data.vp, newSize * size);
-		_data.vp = data;
-		
+		if (newSize < _size)
+			_size = newSize;
+		Reallocate(newSize);
+
 		if (newSize > _size)
 		{
 			switch (_type)
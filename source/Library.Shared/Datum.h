@@ -1,5 +1,6 @@
 #pragma once
 #include "DefaultEquality.h"
+#include "IAllocator.h"
 #include <stdio.h>
 #include <stdexcept>
 
@@ -13,6 +14,7 @@ namespace FieaGameEngine
 	{
 		friend Scope;
 		friend class Attributed;
+		friend class PrefabRegistry;
 
 	public:
 		/// <summary>
@@ -34,7 +36,8 @@ namespace FieaGameEngine
 		/// Constructor that contructs a Datum and sets it's type to the specified type.
 		/// </summary>
 		/// <param name="type"> The type to initialize the Datum to hold. Defaulted to Unknown. </param>
-		explicit Datum(DatumTypes type = DatumTypes::Unknown);
+		/// <param name="allocator"> The allocator the Datum takes its internal storage from. Copies of the Datum take their storage from the default allocator. </param>
+		explicit Datum(DatumTypes type = DatumTypes::Unknown, IAllocator& allocator = IAllocator::Default());
 
 		/// <summary>
 		/// Constructor that constructs a Datum with only a single specified integer.
@@ -611,12 +614,24 @@ namespace FieaGameEngine
 		/// <returns> The amount of data allocated to the Datum. </returns>
 		size_t Capacity() const;
 
+		/// <summary>
+		/// Function that gets the allocator the Datum takes its internal storage from.
+		/// </summary>
+		/// <returns> A reference to the allocator. </returns>
+		IAllocator& GetAllocator() const;
+
 		/// <summary>
 		/// Function to check if the Datum stores external data.
 		/// </summary>
 		/// <returns> Weather or not the Datum stores external data. </returns>
 		bool IsExternal() const;
 
+		/// <summary>
+		/// Function to check if the Datum keeps its elements inside itself rather than in storage taken from its allocator.
+		/// </summary>
+		/// <returns> True if the elements are stored inline, false otherwise. </returns>
+		bool IsInline() const;
+
 		/// <summary>
 		/// Not equals operator that checks equivalence between two Datums by comparing their sizes and respective elements.
 		/// </summary>
@@ -779,6 +794,26 @@ namespace FieaGameEngine
 		/// <param name="type"> The type of data held by the array. </param>
 		void SetStorage(void* array, size_t size, DatumTypes type);
 
+		/// <summary>
+		/// Returns the internal storage of the Datum to its allocator. Elements must already have been destroyed.
+		/// </summary>
+		void ReleaseStorage();
+
+		/// <summary>
+		/// Moves the internal storage to a block of the given capacity. Storage that fits in InlineStorageSize bytes stays inside the Datum.
+		/// Strings are move constructed into their new home, everything else is copied bytewise.
+		/// </summary>
+		/// <param name="capacity"> The capacity of the new storage. Elements past it must already have been destroyed. </param>
+		void Reallocate(std::size_t capacity);
+
+		/// <summary>
+		/// Moves elements of the Datum's type from one block to another, leaving the source elements destroyed.
+		/// </summary>
+		/// <param name="destination"> Uninitialized storage for the elements. </param>
+		/// <param name="source"> The elements to be moved. </param>
+		/// <param name="count"> The number of elements to be moved. </param>
+		void RelocateElements(void* destination, void* source, std::size_t count) const;
+
 		union DatumValues final
 		{
 			void* vp;
@@ -796,6 +831,13 @@ namespace FieaGameEngine
 		std::size_t _capacity{ 0 };
 		DatumTypes _type{ DatumTypes::Unknown };
 		bool _IsExternal{ false };
+		IAllocator* _allocator{ &IAllocator::Default() };
+
+		/// <summary>
+		/// Most Datums hold a single value, so storage up to this size lives inside the Datum instead of costing an allocation.
+		/// </summary>
+		static constexpr std::size_t InlineStorageSize = std::max(sizeof(glm::vec4), sizeof(std::string));
+		alignas(16) std::byte _inlineStorage[InlineStorageSize];
 
 		static constexpr std::size_t DatumTypeSizes[8] =
 		{
@@ -17,11 +17,21 @@ namespace FieaGameEngine
 		return _capacity;
 	}
 
+	inline IAllocator& Datum::GetAllocator() const
+	{
+		return *_allocator;
+	}
+
 	inline bool Datum::IsExternal() const
 	{
 		return _IsExternal;
 	}
 
+	inline bool Datum::IsInline() const
+	{
+		return _data.vp == _inlineStorage;
+	}
+
 	template<typename T>
 	inline T& Datum::Front()
 	{
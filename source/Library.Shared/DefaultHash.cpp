@@ -1,14 +1,268 @@
 #pragma once
 #include "pch.h"
 #include "DefaultHash.h"
+#include <cstdint>
+
+#if defined(_MSC_VER) && defined(_M_X64)
+#include <intrin.h>
+#endif
+
+#if defined(_M_X64) || defined(__SSE2__)
+#include <emmintrin.h>
+#define FIEA_HASH_SSE2
+#endif
 
 namespace FieaGameEngine
 {
-	std::size_t AdditiveHash(const std::byte* data, std::size_t size)
+	namespace
+	{
+		constexpr std::uint64_t WySecret[] = { 0xa0761d6478bd642full, 0xe7037ed1a0b428dbull, 0x8ebc6af09c88c6e3ull, 0x589965cc75cf09a7ull };
+
+		constexpr std::uint64_t StripeSecret[] =
+		{
+			0x5b1eaaeb90e2cc8aull, 0x8d495a07b42e76b2ull, 0x401af969bf945d9full, 0xf3fb95e2e9e0bc86ull,
+			0x3d5e9e59b7d28541ull, 0x3bbe0b56e037c904ull, 0x5d389450db379a72ull, 0xd9cd1830a8855d82ull,
+			0x8157208387f6ae86ull, 0xb413d0ce2dfc558eull, 0x91e41cdb412e9576ull, 0x1905f1139b0a38b3ull,
+			0x1a5072b02c82a902ull, 0x03a199cd70676429ull, 0x8e42274aaa4f6d60ull, 0x53a2afebcd4d0aacull
+		};
+
+		constexpr std::uint64_t Prime32 = 0x9E3779B1ull;
+		constexpr std::size_t StripeLength = 64;
+		constexpr std::size_t StripesPerBlock = 8;
+		constexpr std::size_t BlockLength = StripeLength * StripesPerBlock;
+
+		/// <summary>
+		/// Keys at least this long are hashed 64 bytes at a time across eight independent lanes, which vectorizes well.
+		/// </summary>
+		constexpr std::size_t LongKeyLength = 256;
+
+		inline std::uint64_t Read64(const std::uint8_t* p)
+		{
+			std::uint64_t value;
+			std::memcpy(&value, p, sizeof(value));
+			return value;
+		}
+
+		inline std::uint64_t Read32(const std::uint8_t* p)
+		{
+			std::uint32_t value;
+			std::memcpy(&value, p, sizeof(value));
+			return value;
+		}
+
+		inline std::uint64_t Read3(const std::uint8_t* p, std::size_t size)
+		{
+			return (std::uint64_t(p[0]) << 16) | (std::uint64_t(p[size >> 1]) << 8) | p[size - 1];
+		}
+
+		/// <summary>
+		/// Full 64x64 bit multiply, leaving the low half in a and the high half in b.
+		/// </summary>
+		inline void Multiply(std::uint64_t& a, std::uint64_t& b)
+		{
+#if defined(_MSC_VER) && defined(_M_X64)
+			a = _umul128(a, b, &b);
+#elif defined(__SIZEOF_INT128__)
+			unsigned __int128 product = static_cast<unsigned __int128>(a) * b;
+			a = static_cast<std::uint64_t>(product);
+			b = static_cast<std::uint64_t>(product >> 64);
+#else
+			std::uint64_t ha = a >> 32, hb = b >> 32, la = static_cast<std::uint32_t>(a), lb = static_cast<std::uint32_t>(b);
+			std::uint64_t hh = ha * hb, hl = ha * lb, lh = la * hb, ll = la * lb;
+			std::uint64_t t = ll + (hl << 32);
+			std::uint64_t low = t + (lh << 32);
+			std::uint64_t carry = (t < ll) + (low < t);
+			b = hh + (hl >> 32) + (lh >> 32) + carry;
+			a = low;
+#endif
+		}
+
+		inline std::uint64_t Mix(std::uint64_t a, std::uint64_t b)
+		{
+			Multiply(a, b);
+			return a ^ b;
+		}
+
+		/// <summary>
+		/// wyhash for short and medium keys.
+		/// </summary>
+		std::uint64_t ShortHash(const std::uint8_t* p, std::size_t size)
+		{
+			std::uint64_t seed = Mix(WySecret[0], WySecret[1]);
+			std::uint64_t a, b;
+
+			if (size <= 16)
+			{
+				if (size >= 4)
+				{
+					a = (Read32(p) << 32) | Read32(p + ((size >> 3) << 2));
+					b = (Read32(p + size - 4) << 32) | Read32(p + size - 4 - ((size >> 3) << 2));
+				}
+				else if (size > 0)
+				{
+					a = Read3(p, size);
+					b = 0;
+				}
+				else
+					a = b = 0;
+			}
+			else
+			{
+				std::size_t remaining = size;
+				if (remaining > 48)
+				{
+					std::uint64_t seed1 = seed;
+					std::uint64_t seed2 = seed;
+					do
+					{
+						seed = Mix(Read64(p) ^ WySecret[1], Read64(p + 8) ^ seed);
+						seed1 = Mix(Read64(p + 16) ^ WySecret[2], Read64(p + 24) ^ seed1);
+						seed2 = Mix(Read64(p + 32) ^ WySecret[3], Read64(p + 40) ^ seed2);
+						p += 48;
+						remaining -= 48;
+					} while (remaining > 48);
+					seed ^= seed1 ^ seed2;
+				}
+
+				while (remaining > 16)
+				{
+					seed = Mix(Read64(p) ^ WySecret[1], Read64(p + 8) ^ seed);
+					p += 16;
+					remaining -= 16;
+				}
+
+				a = Read64(p + remaining - 16);
+				b = Read64(p + remaining - 8);
+			}
+
+			a ^= WySecret[1];
+			b ^= seed;
+			Multiply(a, b);
+			return Mix(a ^ WySecret[0] ^ size, b ^ WySecret[1]);
+		}
+
+#if defined(FIEA_HASH_SSE2)
+		struct Accumulator final
+		{
+			__m128i Lanes[4];
+
+			Accumulator(const std::uint64_t (&initial)[8])
+			{
+				for (std::size_t i = 0; i < 4; ++i)
+					Lanes[i] = _mm_loadu_si128(reinterpret_cast<const __m128i*>(initial + 2 * i));
+			}
+
+			void Accumulate(const std::uint8_t* stripe, std::size_t secretOffset)
+			{
+				for (std::size_t i = 0; i < 4; ++i)
+				{
+					__m128i data = _mm_loadu_si128(reinterpret_cast<const __m128i*>(stripe + 16 * i));
+					__m128i key = _mm_xor_si128(data, _mm_loadu_si128(reinterpret_cast<const __m128i*>(StripeSecret + secretOffset + 2 * i)));
+					__m128i product = _mm_mul_epu32(key, _mm_shuffle_epi32(key, _MM_SHUFFLE(0, 3, 0, 1)));
+					__m128i swapped = _mm_shuffle_epi32(data, _MM_SHUFFLE(1, 0, 3, 2));
+					Lanes[i] = _mm_add_epi64(Lanes[i], _mm_add_epi64(product, swapped));
+				}
+			}
+
+			void Scramble()
+			{
+				const __m128i prime = _mm_set1_epi32(static_cast<int>(Prime32));
+				for (std::size_t i = 0; i < 4; ++i)
+				{
+					__m128i lane = _mm_xor_si128(Lanes[i], _mm_srli_epi64(Lanes[i], 47));
+					lane = _mm_xor_si128(lane, _mm_loadu_si128(reinterpret_cast<const __m128i*>(StripeSecret + 8 + 2 * i)));
+					__m128i low = _mm_mul_epu32(lane, prime);
+					__m128i high = _mm_mul_epu32(_mm_srli_epi64(lane, 32), prime);
+					Lanes[i] = _mm_add_epi64(low, _mm_slli_epi64(high, 32));
+				}
+			}
+
+			void Store(std::uint64_t (&out)[8]) const
+			{
+				for (std::size_t i = 0; i < 4; ++i)
+					_mm_storeu_si128(reinterpret_cast<__m128i*>(out + 2 * i), Lanes[i]);
+			}
+		};
+#else
+		struct Accumulator final
+		{
+			std::uint64_t Lanes[8];
+
+			Accumulator(const std::uint64_t (&initial)[8])
+			{
+				std::memcpy(Lanes, initial, sizeof(Lanes));
+			}
+
+			void Accumulate(const std::uint8_t* stripe, std::size_t secretOffset)
+			{
+				for (std::size_t i = 0; i < 8; ++i)
+				{
+					std::uint64_t data = Read64(stripe + 8 * i);
+					std::uint64_t key = data ^ StripeSecret[secretOffset + i];
+					Lanes[i ^ 1] += data;
+					Lanes[i] += (key & 0xFFFFFFFFull) * (key >> 32);
+				}
+			}
+
+			void Scramble()
+			{
+				for (std::size_t i = 0; i < 8; ++i)
+				{
+					std::uint64_t lane = Lanes[i] ^ (Lanes[i] >> 47);
+					lane ^= StripeSecret[8 + i];
+					Lanes[i] = lane * Prime32;
+				}
+			}
+
+			void Store(std::uint64_t (&out)[8]) const
+			{
+				std::memcpy(out, Lanes, sizeof(Lanes));
+			}
+		};
+#endif
+
+		/// <summary>
+		/// XXH3-style hash for long keys. The SSE2 and scalar accumulators compute identical values.
+		/// </summary>
+		std::uint64_t LongHash(const std::uint8_t* p, std::size_t size)
+		{
+			constexpr std::uint64_t initial[8] =
+			{
+				0xC2B2AE3Dull, 0x9E3779B185EBCA87ull, 0xC2B2AE3D27D4EB4Full, 0x165667B19E3779F9ull,
+				0x85EBCA77C2B2AE63ull, 0x85EBCA77ull, 0x27D4EB2F165667C5ull, 0x9E3779B1ull
+			};
+			Accumulator accumulator{ initial };
+
+			const std::size_t blockCount = (size - 1) / BlockLength;
+			for (std::size_t block = 0; block < blockCount; ++block)
+			{
+				for (std::size_t stripe = 0; stripe < StripesPerBlock; ++stripe)
+					accumulator.Accumulate(p + block * BlockLength + stripe * StripeLength, stripe);
+				accumulator.Scramble();
+			}
+
+			const std::size_t stripeCount = ((size - 1) - blockCount * BlockLength) / StripeLength;
+			for (std::size_t stripe = 0; stripe < stripeCount; ++stripe)
+				accumulator.Accumulate(p + blockCount * BlockLength + stripe * StripeLength, stripe);
+			accumulator.Accumulate(p + size - StripeLength, StripesPerBlock - 1);
+
+			std::uint64_t lanes[8];
+			accumulator.Store(lanes);
+
+			std::uint64_t result = size * 0x9E3779B185EBCA87ull;
+			for (std::size_t i = 0; i < 4; ++i)
+				result += Mix(lanes[2 * i] ^ StripeSecret[2 * i], lanes[2 * i + 1] ^ StripeSecret[2 * i + 1]);
+
+			result ^= result >> 37;
+			result *= 0x165667919E3779F9ull;
+			return result ^ (result >> 32);
+		}
+	}
+
+	std::size_t ByteHash(const std::byte* data, std::size_t size)
 	{
-		size_t sum = 37;
-		for (size_t i = 0; i < size; ++i)
-			sum += static_cast<size_t>(data[i]);
-		return sum;
+		const std::uint8_t* bytes = reinterpret_cast<const std::uint8_t*>(data);
+		std::uint64_t hash = size < LongKeyLength ? ShortHash(bytes, size) : LongHash(bytes, size);
+		return static_cast<std::size_t>(hash);
 	}
-}
\ No newline at end of file
+}
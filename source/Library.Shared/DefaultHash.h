@@ -1,9 +1,16 @@
 #pragma once
 #include <stdlib.h>
+#include <string_view>
 
 namespace FieaGameEngine
 {
-	std::size_t AdditiveHash(const std::byte* data, std::size_t size);
+	/// <summary>
+	/// 64-bit hash of a range of bytes. Short keys use wyhash, long keys an XXH3-style multi-lane hash that is vectorized where SSE2 is available.
+	/// </summary>
+	/// <param name="data"> Pointer to the first byte to be hashed. </param>
+	/// <param name="size"> The number of bytes to be hashed. </param>
+	/// <returns> The hash of the passed in bytes. </returns>
+	std::size_t ByteHash(const std::byte* data, std::size_t size);
 }
 
 #include "DefaultHash.inl"
\ No newline at end of file
@@ -7,7 +7,7 @@ namespace FieaGameEngine
 	{
 		std::size_t operator()(const T& key)
 		{
-			return AdditiveHash(reinterpret_cast<const std::byte*>(&key), sizeof(T));
+			return ByteHash(reinterpret_cast<const std::byte*>(&key), sizeof(T));
 		}
 	};
 
@@ -16,11 +16,16 @@ namespace FieaGameEngine
 	{
 		std::size_t operator()(const char* key)
 		{
-			size_t sum = 0;
-			size_t i = 0;
-			while (key[i] != '\0')
-				sum += key[i++];
-			return sum;
+			return ByteHash(reinterpret_cast<const std::byte*>(key), strlen(key));
+		}
+	};
+
+	template<>
+	struct DefaultHash<const char*> final
+	{
+		std::size_t operator()(const char* key)
+		{
+			return ByteHash(reinterpret_cast<const std::byte*>(key), strlen(key));
 		}
 	};
 
@@ -29,7 +34,16 @@ namespace FieaGameEngine
 	{
 		std::size_t operator()(const std::string& key)
 		{
-			return AdditiveHash(reinterpret_cast<const std::byte*>(key.c_str()), key.size());
+			return ByteHash(reinterpret_cast<const std::byte*>(key.c_str()), key.size());
+		}
+	};
+
+	template<>
+	struct DefaultHash<std::string_view> final
+	{
+		std::size_t operator()(std::string_view key)
+		{
+			return ByteHash(reinterpret_cast<const std::byte*>(key.data()), key.size());
 		}
 	};
 }
\ No newline at end of file
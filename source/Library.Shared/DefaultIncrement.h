@@ -3,8 +3,22 @@
 
 namespace FieaGameEngine
 {
+	/// <summary>
+	/// Default growth policy for Vector. Grows the capacity geometrically by half, so a run of PushBacks costs amortized constant time without overshooting as far as doubling does.
+	/// </summary>
 	struct DefaultIncrement final
 	{
+		/// <summary>
+		/// The smallest number of elements a full Vector grows by.
+		/// </summary>
+		static constexpr size_t MinimumIncrement = 4;
+
+		/// <summary>
+		/// Function call operator that computes the capacity a full Vector should grow to.
+		/// </summary>
+		/// <param name="size"> The number of elements in the Vector. </param>
+		/// <param name="capacity"> The current capacity of the Vector. </param>
+		/// <returns> The new capacity of the Vector. </returns>
 		size_t operator()(size_t size, size_t capacity) const;
 	};
 }
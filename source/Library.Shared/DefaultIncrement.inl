@@ -4,6 +4,6 @@ namespace FieaGameEngine
 {
 	inline size_t DefaultIncrement::operator()(size_t size, size_t capacity) const
 	{
-		return size + capacity;
+		return std::max(size, capacity) + std::max(capacity / 2, MinimumIncrement);
 	}
 }
\ No newline at end of file
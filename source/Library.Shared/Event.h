@@ -1,20 +1,65 @@
 #pragma once
+#include <limits>
 #include "IEventPublisher.h"
 #include "IEventSubscriber.h"
+#include "HashMap.h"
 
 namespace FieaGameEngine
 {
+	template <typename T>
+	class EventPool;
+
+	/// <summary>
+	/// Customization point for the delivery of Events carrying messages of type T. Specialize it next to a message type that names
+	/// its own channel, or whose subscribers must be brought up to date on the delivering thread before an Event of that type is delivered.
+	/// </summary>
+	template <typename T>
+	struct EventRouting final
+	{
+		/// <summary>
+		/// Called by Event::Deliver for an Event published without a channel.
+		/// </summary>
+		/// <returns> The channel the message belongs on, or Event::NoChannel to reach only the subscribers to every event of its type. </returns>
+		static std::size_t Channel(const T&) { return std::numeric_limits<std::size_t>::max(); }
+
+		/// <summary>
+		/// Called by Event::Deliver before any subscriber is notified.
+		/// </summary>
+		static void BeforeDeliver() {}
+	};
+
+	/// <summary>
+	/// Event carrying a message of type T. Each instantiation keeps its own subscribers, so delivering an Event only reaches
+	/// instances interested in messages of type T. An Event may also be published on a channel, such as a reaction subtype,
+	/// in which case it additionally reaches the instances subscribed to that channel alone.
+	/// </summary>
 	template <typename T>
 	class Event final : public IEventPublisher
 	{
 		RTTI_DECLARATIONS(Event, IEventPublisher);
+		friend EventPool<T>;
+
 	public:
 		/// <summary>
-		/// Constructor for Event.
+		/// Constructor for an Event published without a channel. If EventRouting names a channel for the message, it is delivered there.
 		/// </summary>
 		/// <param name="message"> The mesage that "this" event delivers to EventSubscribers. </param>
 		explicit Event(T& message);
 
+		/// <summary>
+		/// Constructor for an Event published on a channel.
+		/// </summary>
+		/// <param name="message"> The mesage that "this" event delivers to EventSubscribers. </param>
+		/// <param name="channel"> The channel whose subscribers are notified alongside the subscribers to every event of this type. </param>
+		Event(T& message, std::size_t channel);
+
+		/// <summary>
+		/// Constructor for Event which takes over a message instead of copying it.
+		/// </summary>
+		/// <param name="message"> The mesage that "this" event delivers to EventSubscribers. </param>
+		/// <param name="channel"> The channel whose subscribers are notified alongside the subscribers to every event of this type. </param>
+		explicit Event(T&& message, std::size_t channel = NoChannel);
+
 		/// <summary>
 		/// Static function for an EventSubscriber to subscribe to an event of this type.
 		/// </summary>
@@ -22,6 +67,14 @@ namespace FieaGameEngine
 		/// <exception cref="runtime_error"> Throws if the passed in pointer to the EventPublisher points to null. </exception>
 		static void Subscribe(IEventSubscriber* eventToQueue);
 
+		/// <summary>
+		/// Static function for an EventSubscriber to subscribe to events of this type published on one channel.
+		/// </summary>
+		/// <param name="eventToQueue"> Pointer to the event to add to the list of subscribers for the channel. </param>
+		/// <param name="channel"> The channel to subscribe to. </param>
+		/// <exception cref="runtime_error"> Throws if the passed in pointer to the EventPublisher points to null. </exception>
+		static void Subscribe(IEventSubscriber* eventToQueue, std::size_t channel);
+
 		/// <summary>
 		/// Static function for an EventSubscriber to unsubscribe from an event of this type. 
 		/// </summary>
@@ -29,18 +82,46 @@ namespace FieaGameEngine
 		static void Unsubscribe(IEventSubscriber* eventToRemove);
 
 		/// <summary>
-		/// Static function that clears the list of subscribers for events of this type.
+		/// Static function for an EventSubscriber to unsubscribe from one channel of events of this type.
+		/// </summary>
+		/// <param name="eventToRemove"> Pointer to the event to remove from the list of subscribers for the channel. </param>
+		/// <param name="channel"> The channel to unsubscribe from. </param>
+		static void Unsubscribe(IEventSubscriber* eventToRemove, std::size_t channel);
+
+		/// <summary>
+		/// Static function that clears the list of subscribers for events of this type, including every channel.
 		/// </summary>
 		static void UnsubscribeAll();
 
+		/// <summary>
+		/// Static function to get the number of instances a delivery on a channel would notify.
+		/// </summary>
+		/// <param name="channel"> The channel to count the subscribers of. </param>
+		/// <returns> The number of subscribers to every event of this type plus the number of subscribers to the channel. </returns>
+		static std::size_t SubscriberCount(std::size_t channel = NoChannel);
+
+		/// <summary>
+		/// Calls EventRouting::BeforeDeliver, then Notify on the subscribers to every event of this type, then on the subscribers to this event's channel.
+		/// </summary>
+		void Deliver() override;
+
 		/// <summary>
 		/// Function to get the message/payload contained by this Event.
 		/// </summary>
 		/// <returns> A reference to the message/payload contained by this Event. </returns>
 		T& Message();
 
+		/// <summary>
+		/// Channel of an Event which is only delivered to the subscribers to every event of its type.
+		/// </summary>
+		static constexpr std::size_t NoChannel = std::numeric_limits<std::size_t>::max();
+
 	private:
 		T _message{};
+		std::size_t _channel{ NoChannel };
+
+		inline static Vector<IEventSubscriber*> _subscribers{ 17 };
+		inline static HashMap<std::size_t, Vector<IEventSubscriber*>> _channelSubscribers;
 	};
 }
 #include "Event.inl"
\ No newline at end of file
@@ -12,6 +12,18 @@ namespace FieaGameEngine
 	{
 	}
 
+	template <typename T>
+	Event<T>::Event(T& message, std::size_t channel)
+		: _message{ message }, _channel{ channel }
+	{
+	}
+
+	template <typename T>
+	Event<T>::Event(T&& message, std::size_t channel)
+		: _message{ std::move(message) }, _channel{ channel }
+	{
+	}
+
 	template <typename T>
 	inline void Event<T>::Subscribe(IEventSubscriber* eventToQueue)
 	{
@@ -23,6 +35,19 @@ namespace FieaGameEngine
 		_subscribers.PushBack(eventToQueue);
 	}
 
+	template <typename T>
+	inline void Event<T>::Subscribe(IEventSubscriber* eventToQueue, std::size_t channel)
+	{
+		if (eventToQueue == nullptr)
+			throw std::runtime_error("Cannot enqueue a null pointer");
+
+		Vector<IEventSubscriber*>& subscribers = _channelSubscribers[channel];
+		if (subscribers.Find(eventToQueue) != subscribers.end())
+			return;
+
+		subscribers.PushBack(eventToQueue);
+	}
+
 	template <typename T>
 	inline void Event<T>::Unsubscribe(IEventSubscriber* eventToRemove)
 	{
@@ -35,10 +60,61 @@ namespace FieaGameEngine
 		}
 	}
 
+	template <typename T>
+	inline void Event<T>::Unsubscribe(IEventSubscriber* eventToRemove, std::size_t channel)
+	{
+		auto channelIt = _channelSubscribers.Find(channel);
+		if (channelIt == _channelSubscribers.end())
+			return;
+
+		Vector<IEventSubscriber*>& subscribers = channelIt->second;
+		auto it = subscribers.Find(eventToRemove);
+		if (it != subscribers.end())
+		{
+			auto end = it;
+			++end;
+			subscribers.Remove(it, end);
+		}
+
+		if (subscribers.IsEmpty())
+			_channelSubscribers.Remove(channel);
+	}
+
 	template <typename T>
 	inline void Event<T>::UnsubscribeAll()
 	{
 		_subscribers.Clear();
+		_channelSubscribers.Clear();
+	}
+
+	template <typename T>
+	inline std::size_t Event<T>::SubscriberCount(std::size_t channel)
+	{
+		auto channelIt = _channelSubscribers.Find(channel);
+		return _subscribers.Size() + (channelIt != _channelSubscribers.end() ? channelIt->second.Size() : 0);
+	}
+
+	template <typename T>
+	inline void Event<T>::Deliver()
+	{
+		EventRouting<T>::BeforeDeliver();
+		const std::size_t channel = _channel != NoChannel ? _channel : EventRouting<T>::Channel(_message);
+
+		// Indexing, rather than iterating, tolerates subscribers that subscribe more instances while being notified.
+		for (std::size_t i = 0; i < _subscribers.Size(); ++i)
+			_subscribers[i]->Notify(this);
+
+		if (channel == NoChannel)
+			return;
+
+		for (std::size_t i = 0; ; ++i)
+		{
+			// Looked up again each time, as a subscriber opening a new channel may move the lists.
+			auto channelIt = _channelSubscribers.Find(channel);
+			if (channelIt == _channelSubscribers.end() || i >= channelIt->second.Size())
+				break;
+			channelIt->second[i]->Notify(this);
+		}
 	}
 
 	template <typename T>
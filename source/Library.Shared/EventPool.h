@@ -0,0 +1,110 @@
+#pragma once
+#include <memory>
+#include <mutex>
+#include "Event.h"
+
+namespace FieaGameEngine
+{
+	/// <summary>
+	/// Recycles Events, together with the shared_ptr control blocks that own them, for code that publishes the same kind of event over and over.
+	/// An Event handed out by Acquire returns to the pool, message and all, once the last shared_ptr to it goes away, so refilling its message
+	/// reuses the storage the message already has. Once the pool has grown to cover the events in flight, acquiring one allocates nothing.
+	/// A pool lives in a shared_ptr that every outstanding Event holds on to, so it may be dropped while its Events are still queued.
+	/// Events may be acquired and released on different threads.
+	/// </summary>
+	template <typename T>
+	class EventPool final : public std::enable_shared_from_this<EventPool<T>>
+	{
+	public:
+		/// <summary>
+		/// Function to create an empty pool.
+		/// </summary>
+		/// <returns> A shared_ptr owning the new pool. </returns>
+		static std::shared_ptr<EventPool> Create();
+
+		EventPool(const EventPool&) = delete;
+		EventPool(EventPool&&) = delete;
+		EventPool& operator=(const EventPool&) = delete;
+		EventPool& operator=(EventPool&&) = delete;
+
+		/// <summary>
+		/// Destructor for EventPool, which deletes the idle Events and control blocks.
+		/// </summary>
+		~EventPool();
+
+		/// <summary>
+		/// Function to get an Event from the pool, constructing one only if none is idle. The message of a recycled Event still holds
+		/// whatever it held when it was released, so the caller is expected to overwrite it.
+		/// </summary>
+		/// <param name="createMessage"> Callable that returns the message a newly constructed Event is to be moved into. </param>
+		/// <param name="channel"> The channel the Event is to be published on. </param>
+		/// <returns> A shared_ptr that hands the Event back to the pool when the last copy of it is destroyed. </returns>
+		template <typename MessageFactory>
+		std::shared_ptr<Event<T>> Acquire(MessageFactory createMessage, std::size_t channel = Event<T>::NoChannel);
+
+		/// <summary>
+		/// Function to get the number of Events waiting in the pool to be reused.
+		/// </summary>
+		/// <returns> The number of idle Events. </returns>
+		std::size_t IdleCount() const;
+
+		/// <summary>
+		/// Function to get the number of Events the pool has constructed, which stops growing once the pool covers the events in flight.
+		/// </summary>
+		/// <returns> The number of Events constructed by the pool. </returns>
+		std::size_t CreatedCount() const;
+
+	private:
+		EventPool() = default;
+
+		/// <summary>
+		/// Deleter of the shared_ptrs handed out by Acquire, which returns the Event to its pool.
+		/// </summary>
+		struct Recycler final
+		{
+			void operator()(Event<T>* event) const;
+
+			EventPool* Pool;
+		};
+
+		/// <summary>
+		/// Allocator of the shared_ptr control blocks, which recycles them through the pool. Each control block holds a copy, and so keeps the pool alive.
+		/// </summary>
+		template <typename U>
+		struct BlockAllocator final
+		{
+			using value_type = U;
+
+			explicit BlockAllocator(std::shared_ptr<EventPool> pool);
+
+			template <typename V>
+			BlockAllocator(const BlockAllocator<V>& other);
+
+			U* allocate(std::size_t count);
+			void deallocate(U* block, std::size_t count);
+
+			template <typename V>
+			bool operator==(const BlockAllocator<V>& rhs) const;
+
+			std::shared_ptr<EventPool> Pool;
+		};
+
+		/// <summary>
+		/// Takes an idle control block if it is the right size, and allocates one otherwise.
+		/// </summary>
+		void* AllocateBlock(std::size_t size);
+
+		/// <summary>
+		/// Keeps a control block for reuse if it is the size the pool recycles, and frees it otherwise.
+		/// </summary>
+		void DeallocateBlock(void* block, std::size_t size);
+
+		mutable std::mutex _mutex;
+		Vector<Event<T>*> _idleEvents;
+		Vector<void*> _idleBlocks;
+		std::size_t _blockSize{ 0 };
+		std::size_t _createdCount{ 0 };
+	};
+}
+
+#include "EventPool.inl"
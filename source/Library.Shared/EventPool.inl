@@ -0,0 +1,136 @@
+#include "EventPool.h"
+
+namespace FieaGameEngine
+{
+	template <typename T>
+	inline std::shared_ptr<EventPool<T>> EventPool<T>::Create()
+	{
+		return std::shared_ptr<EventPool>{ new EventPool{} };
+	}
+
+	template <typename T>
+	inline EventPool<T>::~EventPool()
+	{
+		for (Event<T>* event : _idleEvents)
+			delete event;
+		for (void* block : _idleBlocks)
+			::operator delete(block);
+	}
+
+	template <typename T>
+	template <typename MessageFactory>
+	inline std::shared_ptr<Event<T>> EventPool<T>::Acquire(MessageFactory createMessage, std::size_t channel)
+	{
+		Event<T>* event = nullptr;
+		{
+			std::lock_guard<std::mutex> lock{ _mutex };
+			if (!_idleEvents.IsEmpty())
+			{
+				event = _idleEvents.Back();
+				_idleEvents.PopBack();
+			}
+		}
+
+		if (event == nullptr)
+		{
+			event = new Event<T>{ createMessage(), channel };
+			std::lock_guard<std::mutex> lock{ _mutex };
+			++_createdCount;
+		}
+		else
+			event->_channel = channel;
+
+		return std::shared_ptr<Event<T>>{ event, Recycler{ this }, BlockAllocator<Event<T>>{ this->shared_from_this() } };
+	}
+
+	template <typename T>
+	inline std::size_t EventPool<T>::IdleCount() const
+	{
+		std::lock_guard<std::mutex> lock{ _mutex };
+		return _idleEvents.Size();
+	}
+
+	template <typename T>
+	inline std::size_t EventPool<T>::CreatedCount() const
+	{
+		std::lock_guard<std::mutex> lock{ _mutex };
+		return _createdCount;
+	}
+
+	template <typename T>
+	inline void EventPool<T>::Recycler::operator()(Event<T>* event) const
+	{
+		std::lock_guard<std::mutex> lock{ Pool->_mutex };
+		Pool->_idleEvents.PushBack(event);
+	}
+
+	template <typename T>
+	template <typename U>
+	inline EventPool<T>::BlockAllocator<U>::BlockAllocator(std::shared_ptr<EventPool> pool)
+		: Pool{ std::move(pool) }
+	{
+	}
+
+	template <typename T>
+	template <typename U>
+	template <typename V>
+	inline EventPool<T>::BlockAllocator<U>::BlockAllocator(const BlockAllocator<V>& other)
+		: Pool{ other.Pool }
+	{
+	}
+
+	template <typename T>
+	template <typename U>
+	inline U* EventPool<T>::BlockAllocator<U>::allocate(std::size_t count)
+	{
+		return static_cast<U*>(Pool->AllocateBlock(sizeof(U) * count));
+	}
+
+	template <typename T>
+	template <typename U>
+	inline void EventPool<T>::BlockAllocator<U>::deallocate(U* block, std::size_t count)
+	{
+		Pool->DeallocateBlock(block, sizeof(U) * count);
+	}
+
+	template <typename T>
+	template <typename U>
+	template <typename V>
+	inline bool EventPool<T>::BlockAllocator<U>::operator==(const BlockAllocator<V>& rhs) const
+	{
+		return Pool == rhs.Pool;
+	}
+
+	template <typename T>
+	inline void* EventPool<T>::AllocateBlock(std::size_t size)
+	{
+		{
+			std::lock_guard<std::mutex> lock{ _mutex };
+			if (_blockSize == 0)
+				_blockSize = size;
+			if (size == _blockSize && !_idleBlocks.IsEmpty())
+			{
+				void* block = _idleBlocks.Back();
+				_idleBlocks.PopBack();
+				return block;
+			}
+		}
+
+		return ::operator new(size);
+	}
+
+	template <typename T>
+	inline void EventPool<T>::DeallocateBlock(void* block, std::size_t size)
+	{
+		{
+			std::lock_guard<std::mutex> lock{ _mutex };
+			if (size == _blockSize)
+			{
+				_idleBlocks.PushBack(block);
+				return;
+			}
+		}
+
+		::operator delete(block);
+	}
+}
@@ -1,52 +1,461 @@
 #include "EventQueue.h"
-#include <algorithm>
+#include <bit>
 
 using namespace std;
 
 namespace FieaGameEngine
 {
-	void EventQueue::Enqueue(shared_ptr<IEventPublisher> eventPublisher, const GameTime& gameTime, chrono::milliseconds delay)
+	namespace
 	{
-		_eventQueue.PushBack(EventQueueArgs{ eventPublisher, gameTime.CurrentTime(), delay });
+		/// <summary>
+		/// The queue and Batch of the innermost BatchScope active on the calling thread, if any.
+		/// </summary>
+		thread_local EventQueue* CurrentBatchQueue{ nullptr };
+		thread_local EventQueue::Batch* CurrentBatch{ nullptr };
+	}
+
+	bool EventQueue::Handle::IsValid() const
+	{
+		return _id != 0;
+	}
+
+	EventQueue::Handle::Handle(uint64_t id)
+		: _id{ id }
+	{
+	}
+
+	bool EventQueue::Batch::IsEmpty() const
+	{
+		return _events.IsEmpty();
+	}
+
+	size_t EventQueue::Batch::Size() const
+	{
+		return _events.Size();
+	}
+
+	EventQueue::BatchScope::BatchScope(EventQueue& eventQueue, Batch& batch)
+		: _previousQueue{ CurrentBatchQueue }, _previousBatch{ CurrentBatch }
+	{
+		CurrentBatchQueue = &eventQueue;
+		CurrentBatch = &batch;
+	}
+
+	EventQueue::BatchScope::~BatchScope()
+	{
+		CurrentBatchQueue = _previousQueue;
+		CurrentBatch = _previousBatch;
+	}
+
+	EventQueue::EventQueue()
+		: _ownerThread{ this_thread::get_id() }
+	{
+	}
+
+	EventQueue::~EventQueue()
+	{
+		Clear();
+		for (atomic<PendingEvent*>& block : _pendingBlocks)
+			delete[] block.load(memory_order_relaxed);
+	}
+
+	EventQueue::Handle EventQueue::Enqueue(shared_ptr<IEventPublisher> eventPublisher, const GameTime& gameTime, chrono::milliseconds delay)
+	{
+		const uint64_t id = _nextId.fetch_add(1, memory_order_relaxed);
+		if (CurrentBatchQueue == this)
+		{
+			CurrentBatch->_events.PushBack(EventQueueArgs{ std::move(eventPublisher), gameTime.CurrentTime(), delay, id });
+			return Handle{ id };
+		}
+
+		// The owning thread can schedule straight into the heap, saving the pending node, unless it is in the middle of delivering.
+		if (this_thread::get_id() == _ownerThread && !_isUpdating.load(memory_order_relaxed))
+		{
+			MergePending();
+			Schedule(EventQueueArgs{ std::move(eventPublisher), gameTime.CurrentTime(), delay, id });
+			return Handle{ id };
+		}
+
+		CheckDeterministicEnqueue();
+		PendingEvent* pendingEvent = AcquirePending(EventQueueArgs{ std::move(eventPublisher), gameTime.CurrentTime(), delay, id }, nullptr);
+		PushPending(pendingEvent, pendingEvent);
+		return Handle{ id };
+	}
+
+	void EventQueue::Merge(Batch& batch)
+	{
+		if (batch.IsEmpty())
+			return;
+
+		if (CurrentBatchQueue == this && CurrentBatch != &batch)
+		{
+			for (EventQueueArgs& args : batch._events)
+				CurrentBatch->_events.PushBack(std::move(args));
+			batch._events.Clear();
+			return;
+		}
+
+		CheckDeterministicEnqueue();
+		PendingEvent* newest = nullptr;
+		PendingEvent* oldest = nullptr;
+		for (EventQueueArgs& args : batch._events)
+		{
+			newest = AcquirePending(std::move(args), newest);
+			if (oldest == nullptr)
+				oldest = newest;
+		}
+		batch._events.Clear();
+
+		PushPending(newest, oldest);
 	}
 
 	void EventQueue::Update(const GameTime& gameTime)
 	{
-		if (_isUpdating)
+		bool wasUpdating = false;
+		if (!_isUpdating.compare_exchange_strong(wasUpdating, true, memory_order_acquire))
 			return;
 
-		_isUpdating = true;
+		_updateCount.fetch_add(1, memory_order_release);
+		MergePending();
+
+		const auto currentTime = gameTime.CurrentTime();
+		while (!_heap.IsEmpty() && _slots[_heap.Front()].Deadline <= currentTime)
+		{
+			const size_t slot = RemoveFromHeap(0);
+			_delivered.PushBack(slot);
+
+			// Held for the call, since a subscriber may cancel the event, or clear the queue, while it is being delivered.
+			shared_ptr<IEventPublisher> eventPublisher = _slots[slot].Args.eventPublisher;
+			eventPublisher->Deliver();
+		}
+
+		// Requeued only now, so that an event with no delay is published once per Update.
+		for (size_t slot : _delivered)
+		{
+			ScheduledEvent& scheduledEvent = _slots[slot];
+			if (scheduledEvent.Args.eventPublisher.use_count() > 1)
+			{
+				// Counting from the previous deadline keeps a replay's timing independent of frame timing; otherwise a late frame delays the next firing.
+				scheduledEvent.Args.timeEnqueued = _isDeterministic.load(memory_order_relaxed) ? scheduledEvent.Deadline : currentTime;
+				scheduledEvent.Deadline = scheduledEvent.Args.timeEnqueued + scheduledEvent.Args.delay;
+				scheduledEvent.Sequence = _nextSequence++;
+				PushHeap(slot);
+			}
+			else
+				Release(slot);
+		}
+		_delivered.Clear();
+
+		_isUpdating.store(false, memory_order_release);
+	}
+
+	void EventQueue::SetDeterministic(bool isDeterministic)
+	{
+		_isDeterministic.store(isDeterministic, memory_order_relaxed);
+	}
+
+	bool EventQueue::IsDeterministic() const
+	{
+		return _isDeterministic.load(memory_order_relaxed);
+	}
+
+	uint64_t EventQueue::UpdateCount()
+	{
+		return _updateCount.load(memory_order_acquire);
+	}
 
-		auto it = partition(_eventQueue.begin(), _eventQueue.end(), [&gameTime](const EventQueueArgs& args) { return gameTime.CurrentTime() < args.timeEnqueued + args.delay; });
-		for (auto tempIt = it; tempIt != _eventQueue.end(); ++tempIt)
-			(*tempIt).eventPublisher->Deliver();
+	bool EventQueue::Cancel(Handle handle)
+	{
+		if (!handle.IsValid())
+			return false;
 
-		Vector<EventQueueArgs> requeueEvents{ _eventQueue.Capacity() };
-		for (auto tempIt = it; tempIt != _eventQueue.end(); ++tempIt)
+		auto it = _slotsById.Find(handle._id);
+		if (it == _slotsById.end())
 		{
-			if ((*tempIt).eventPublisher.use_count() > size_t(1))
-				requeueEvents.PushBack(*it);
+			// Producers only ever replace the head of the pending list, so the owning thread can walk and edit the events already in it.
+			for (PendingEvent* pendingEvent = _pending.load(memory_order_acquire); pendingEvent != nullptr; pendingEvent = pendingEvent->Next)
+			{
+				if (pendingEvent->Args.id == handle._id)
+				{
+					pendingEvent->Args = EventQueueArgs{};
+					return true;
+				}
+			}
+			return false;
 		}
-		_eventQueue.Remove(it, _eventQueue.end());
 
-		for (it = requeueEvents.begin(); it != requeueEvents.end(); ++it)
-			Enqueue((*it).eventPublisher, gameTime, (*it).delay);
+		const size_t slot = it->second;
+		if (_slots[slot].HeapIndex != NotInHeap)
+			RemoveFromHeap(_slots[slot].HeapIndex);
+		else
+		{
+			// Being delivered by the current Update, which must not requeue it.
+			auto delivered = _delivered.Find(slot);
+			assert(delivered != _delivered.end());
+			auto end = delivered;
+			++end;
+			_delivered.Remove(delivered, end);
+		}
 
-		_isUpdating = false;
+		Release(slot);
+		return true;
 	}
 
 	void EventQueue::Clear()
 	{
-		_eventQueue.Clear();
+		PendingEvent* first = _pending.exchange(nullptr, memory_order_acquire);
+		for (PendingEvent* pendingEvent = first; pendingEvent != nullptr; pendingEvent = pendingEvent->Next)
+			pendingEvent->Args = EventQueueArgs{};
+		RecyclePending(first);
+
+		_slots.Clear();
+		_freeSlots.Clear();
+		_heap.Clear();
+		_slotsById.Clear();
+		_delivered.Clear();
 	}
 
 	bool EventQueue::IsEmpty()
 	{
-		return _eventQueue.IsEmpty();
+		return Size() == 0;
 	}
 
 	size_t EventQueue::Size()
 	{
-		return _eventQueue.Size();
+		if (!_isUpdating.load(memory_order_relaxed))
+			MergePending();
+		return _slotsById.Size();
+	}
+
+	void EventQueue::CheckDeterministicEnqueue() const
+	{
+		if (_isDeterministic.load(memory_order_relaxed) && this_thread::get_id() != _ownerThread)
+			throw runtime_error("Deterministic EventQueue can only be enqueued into from other threads through a Batch.");
+	}
+
+	void EventQueue::PushPending(PendingEvent* newest, PendingEvent* oldest)
+	{
+		PendingEvent* head = _pending.load(memory_order_relaxed);
+		do
+		{
+			oldest->Next = head;
+		} while (!_pending.compare_exchange_weak(head, newest, memory_order_release, memory_order_relaxed));
+	}
+
+	void EventQueue::MergePending()
+	{
+		PendingEvent* newest = _pending.exchange(nullptr, memory_order_acquire);
+		if (newest == nullptr)
+			return;
+
+		PendingEvent* oldest = nullptr;
+		while (newest != nullptr)
+		{
+			PendingEvent* next = newest->Next;
+			newest->Next = oldest;
+			oldest = newest;
+			newest = next;
+		}
+
+		for (PendingEvent* pendingEvent = oldest; pendingEvent != nullptr; pendingEvent = pendingEvent->Next)
+		{
+			if (pendingEvent->Args.id != 0)
+				Schedule(std::move(pendingEvent->Args));
+			pendingEvent->Args = EventQueueArgs{};
+		}
+		RecyclePending(oldest);
+	}
+
+	EventQueue::PendingEvent* EventQueue::AcquirePending(EventQueueArgs&& args, PendingEvent* next)
+	{
+		PendingEvent* pendingEvent = nullptr;
+		while (pendingEvent == nullptr)
+		{
+			uint64_t head = _freePending.load(memory_order_acquire);
+			while (static_cast<uint32_t>(head) != 0)
+			{
+				// The node may be taken and pushed back by others before the swap; the tag makes the swap fail if it was.
+				PendingEvent& top = PendingAt(static_cast<uint32_t>(head) - 1);
+				const uint64_t popped = (((head >> 32) + 1) << 32) | top.NextFree.load(memory_order_relaxed);
+				if (_freePending.compare_exchange_weak(head, popped, memory_order_acquire, memory_order_acquire))
+				{
+					pendingEvent = &top;
+					break;
+				}
+			}
+
+			if (pendingEvent == nullptr)
+				pendingEvent = GrowPending();
+		}
+
+		pendingEvent->Args = std::move(args);
+		pendingEvent->Next = next;
+		return pendingEvent;
+	}
+
+	void EventQueue::RecyclePending(PendingEvent* first)
+	{
+		if (first == nullptr)
+			return;
+
+		PendingEvent* last = first;
+		while (last->Next != nullptr)
+		{
+			last->NextFree.store(last->Next->Index + 1, memory_order_relaxed);
+			last = last->Next;
+		}
+		PushFreePending(*first, *last);
+	}
+
+	void EventQueue::PushFreePending(PendingEvent& first, PendingEvent& last)
+	{
+		uint64_t head = _freePending.load(memory_order_relaxed);
+		uint64_t pushed;
+		do
+		{
+			last.NextFree.store(static_cast<uint32_t>(head), memory_order_relaxed);
+			pushed = (((head >> 32) + 1) << 32) | (first.Index + 1);
+		} while (!_freePending.compare_exchange_weak(head, pushed, memory_order_release, memory_order_relaxed));
+	}
+
+	EventQueue::PendingEvent* EventQueue::GrowPending()
+	{
+		size_t blockIndex = 0;
+		while (blockIndex < PendingBlockCount && _pendingBlocks[blockIndex].load(memory_order_acquire) != nullptr)
+			++blockIndex;
+		if (blockIndex == PendingBlockCount)
+			throw runtime_error("EventQueue has run out of pending nodes.");
+
+		const size_t blockSize = FirstPendingBlockSize << blockIndex;
+		const size_t firstIndex = FirstPendingBlockSize * ((size_t(1) << blockIndex) - 1);
+		PendingEvent* block = new PendingEvent[blockSize];
+		for (size_t i = 0; i < blockSize; ++i)
+		{
+			block[i].Index = static_cast<uint32_t>(firstIndex + i);
+			block[i].NextFree.store(static_cast<uint32_t>(firstIndex + i + 2), memory_order_relaxed);
+		}
+
+		PendingEvent* expected = nullptr;
+		if (!_pendingBlocks[blockIndex].compare_exchange_strong(expected, block, memory_order_release, memory_order_acquire))
+		{
+			delete[] block;
+			return nullptr;
+		}
+
+		if (blockSize > 1)
+			PushFreePending(block[1], block[blockSize - 1]);
+		return &block[0];
+	}
+
+	EventQueue::PendingEvent& EventQueue::PendingAt(uint32_t index) const
+	{
+		const size_t blockIndex = static_cast<size_t>(bit_width(index / FirstPendingBlockSize + 1)) - 1;
+		const size_t firstIndex = FirstPendingBlockSize * ((size_t(1) << blockIndex) - 1);
+		return _pendingBlocks[blockIndex].load(memory_order_acquire)[index - firstIndex];
+	}
+
+	void EventQueue::Schedule(EventQueueArgs&& args)
+	{
+		size_t slot;
+		if (_freeSlots.IsEmpty())
+		{
+			slot = _slots.Size();
+			_slots.EmplaceBack();
+		}
+		else
+		{
+			slot = _freeSlots.Back();
+			_freeSlots.PopBack();
+		}
+
+		ScheduledEvent& scheduledEvent = _slots[slot];
+		scheduledEvent.Deadline = args.timeEnqueued + args.delay;
+		scheduledEvent.Sequence = _nextSequence++;
+		scheduledEvent.Args = std::move(args);
+		_slotsById.Insert(make_pair(scheduledEvent.Args.id, slot));
+		PushHeap(slot);
+	}
+
+	void EventQueue::Release(size_t slot)
+	{
+		ScheduledEvent& scheduledEvent = _slots[slot];
+		assert(scheduledEvent.HeapIndex == NotInHeap);
+
+		_slotsById.Remove(scheduledEvent.Args.id);
+		scheduledEvent.Args = EventQueueArgs{};
+		_freeSlots.PushBack(slot);
+	}
+
+	bool EventQueue::IsEarlier(size_t slot, size_t otherSlot) const
+	{
+		const ScheduledEvent& scheduledEvent = _slots[slot];
+		const ScheduledEvent& otherEvent = _slots[otherSlot];
+		return scheduledEvent.Deadline < otherEvent.Deadline || (scheduledEvent.Deadline == otherEvent.Deadline && scheduledEvent.Sequence < otherEvent.Sequence);
+	}
+
+	void EventQueue::PushHeap(size_t slot)
+	{
+		_heap.PushBack(slot);
+		_slots[slot].HeapIndex = _heap.Size() - 1;
+		SiftUp(_heap.Size() - 1);
+	}
+
+	size_t EventQueue::RemoveFromHeap(size_t heapIndex)
+	{
+		const size_t slot = _heap[heapIndex];
+		const size_t last = _heap.Size() - 1;
+		if (heapIndex != last)
+		{
+			PlaceInHeap(heapIndex, _heap[last]);
+			_heap.PopBack();
+			if (heapIndex > 0 && IsEarlier(_heap[heapIndex], _heap[(heapIndex - 1) / 2]))
+				SiftUp(heapIndex);
+			else
+				SiftDown(heapIndex);
+		}
+		else
+			_heap.PopBack();
+
+		_slots[slot].HeapIndex = NotInHeap;
+		return slot;
+	}
+
+	void EventQueue::SiftUp(size_t heapIndex)
+	{
+		const size_t slot = _heap[heapIndex];
+		while (heapIndex > 0)
+		{
+			const size_t parent = (heapIndex - 1) / 2;
+			if (!IsEarlier(slot, _heap[parent]))
+				break;
+			PlaceInHeap(heapIndex, _heap[parent]);
+			heapIndex = parent;
+		}
+		PlaceInHeap(heapIndex, slot);
+	}
+
+	void EventQueue::SiftDown(size_t heapIndex)
+	{
+		const size_t slot = _heap[heapIndex];
+		const size_t size = _heap.Size();
+		while (true)
+		{
+			size_t child = 2 * heapIndex + 1;
+			if (child >= size)
+				break;
+			if (child + 1 < size && IsEarlier(_heap[child + 1], _heap[child]))
+				++child;
+			if (!IsEarlier(_heap[child], slot))
+				break;
+			PlaceInHeap(heapIndex, _heap[child]);
+			heapIndex = child;
+		}
+		PlaceInHeap(heapIndex, slot);
+	}
+
+	void EventQueue::PlaceInHeap(size_t heapIndex, size_t slot)
+	{
+		_heap[heapIndex] = slot;
+		_slots[slot].HeapIndex = heapIndex;
 	}
-}
\ No newline at end of file
+}
@@ -1,5 +1,10 @@
 #pragma once
+#include <atomic>
+#include <cstdint>
+#include <limits>
+#include <thread>
 #include "IEventPublisher.h"
+#include "HashMap.h"
 
 namespace FieaGameEngine
 {
@@ -8,29 +13,168 @@ namespace FieaGameEngine
 		std::shared_ptr<IEventPublisher> eventPublisher;
 		std::chrono::high_resolution_clock::time_point timeEnqueued;
 		std::chrono::milliseconds delay;
+		std::uint64_t id{ 0 };
 	};
 
+	/// <summary>
+	/// Queue of events to be delivered after a delay, kept as a binary min-heap on the time each event is due. Enqueueing and cancelling
+	/// cost O(log n), and Update only touches the events that are due, so a frame in which nothing fires costs O(1) however much is pending.
+	/// Enqueue may be called from any thread: events from other threads, or from the owning thread while it is delivering, are pushed onto
+	/// a lock-free pending list and merged into the queue, in the order they were pushed, at the start of Update or the owning thread's next Enqueue. The remaining functions belong to the thread that constructed the queue.
+	/// Pending list nodes, like heap slots, are recycled through a lock-free free list, so a queue that has warmed up enqueues without allocating or locking.
+	/// Threads that enqueue concurrently race for their place in the pending list. Code that needs the same order every run,
+	/// such as parallel GameObject updates, gives each job its own Batch and merges the Batches in a fixed order once the jobs are joined.
+	/// Given the same enqueues and game times, the queue then publishes the same events in the same order on every run; deterministic
+	/// mode turns any enqueue that could break that guarantee into an error.
+	/// </summary>
 	class EventQueue final
 	{
 	public:
-		EventQueue() = default;
+		/// <summary>
+		/// Identifies an enqueued event so that it can be cancelled. A default constructed Handle refers to no event.
+		/// </summary>
+		class Handle final
+		{
+			friend EventQueue;
+
+		public:
+			Handle() = default;
+
+			/// <summary>
+			/// Function to check if the Handle was returned by Enqueue, whether or not the event is still queued.
+			/// </summary>
+			/// <returns> True if the Handle refers to an event, false if it was default constructed. </returns>
+			bool IsValid() const;
+
+			bool operator==(const Handle& rhs) const = default;
+
+		private:
+			explicit Handle(std::uint64_t id);
+
+			std::uint64_t _id{ 0 };
+		};
 
 		/// <summary>
-		/// Function to enqueue an event publisher along with a delay to the EventQueue.
+		/// Events enqueued on one thread while a BatchScope for it is active, kept aside until they are merged with EventQueue::Merge.
+		/// </summary>
+		class Batch final
+		{
+			friend EventQueue;
+
+		public:
+			Batch() = default;
+			Batch(const Batch&) = delete;
+			Batch(Batch&&) = default;
+			Batch& operator=(const Batch&) = delete;
+			Batch& operator=(Batch&&) = default;
+			~Batch() = default;
+
+			/// <summary>
+			/// Function to check if no events have been enqueued into the Batch.
+			/// </summary>
+			/// <returns> True if the Batch is empty, false if not. </returns>
+			bool IsEmpty() const;
+
+			/// <summary>
+			/// Function to get the number of events waiting in the Batch.
+			/// </summary>
+			/// <returns> The size of the Batch. </returns>
+			std::size_t Size() const;
+
+		private:
+			Vector<EventQueueArgs> _events;
+		};
+
+		/// <summary>
+		/// Routes every call to Enqueue on an EventQueue, made by the constructing thread, into a Batch for as long as the scope lives.
+		/// Scopes nest; the previous one is restored on destruction.
+		/// </summary>
+		class BatchScope final
+		{
+		public:
+			BatchScope(EventQueue& eventQueue, Batch& batch);
+			BatchScope(const BatchScope&) = delete;
+			BatchScope(BatchScope&&) = delete;
+			BatchScope& operator=(const BatchScope&) = delete;
+			BatchScope& operator=(BatchScope&&) = delete;
+			~BatchScope();
+
+		private:
+			EventQueue* _previousQueue;
+			Batch* _previousBatch;
+		};
+
+		EventQueue();
+		EventQueue(const EventQueue&) = delete;
+		EventQueue(EventQueue&&) = delete;
+		EventQueue& operator=(const EventQueue&) = delete;
+		EventQueue& operator=(EventQueue&&) = delete;
+
+		/// <summary>
+		/// Destructor for EventQueue, which releases any events still pending and the nodes kept for reuse.
+		/// </summary>
+		~EventQueue();
+
+		/// <summary>
+		/// Function to enqueue an event publisher along with a delay to the EventQueue. Safe to call from any thread.
 		/// </summary>
 		/// <param name="eventPublisher"> Pointer to the EventPublisher to enqueue. </param>
 		/// <param name="gameTime"> Const reference to a GameTime instance to get the time at which the Event was enqueued. </param>
 		/// <param name="delay"> The time, in milliseconds, after which the Event is to be published. Defaulted to zero. </param>
-		void Enqueue(std::shared_ptr<IEventPublisher> eventPublisher, const GameTime& gameTime, std::chrono::milliseconds delay = std::chrono::milliseconds::zero());
+		/// <returns> A Handle with which the Event can be cancelled. </returns>
+		/// <exception cref="runtime_error"> Throws in deterministic mode if called from another thread outside of a BatchScope for "this" queue. </exception>
+		Handle Enqueue(std::shared_ptr<IEventPublisher> eventPublisher, const GameTime& gameTime, std::chrono::milliseconds delay = std::chrono::milliseconds::zero());
 
 		/// <summary>
-		/// Loops through the queue and publishes any expired events and deletes/requeues them after.
+		/// Function to enqueue the contents of a Batch, in the order they were enqueued into it, and empty it. The events stay together
+		/// even if other threads are enqueueing at the same time. If the calling thread has a BatchScope for "this" queue active, the events
+		/// are moved into that scope's Batch instead. Safe to call from any thread.
+		/// </summary>
+		/// <param name="batch"> The Batch to be merged. </param>
+		/// <exception cref="runtime_error"> Throws in deterministic mode if called from another thread outside of a BatchScope for "this" queue. </exception>
+		void Merge(Batch& batch);
+
+		/// <summary>
+		/// Function to turn deterministic mode on or off. In deterministic mode, events may only reach the pending list from the thread
+		/// that owns the queue; other threads must enqueue into a Batch, since the order in which they would otherwise arrive depends on timing.
+		/// Repeating events are also requeued from their previous deadline rather than from the Update that published them.
+		/// </summary>
+		/// <param name="isDeterministic"> True to reject enqueues whose order could differ between runs, false to accept them. </param>
+		void SetDeterministic(bool isDeterministic);
+
+		/// <summary>
+		/// Function to check if the EventQueue is in deterministic mode.
+		/// </summary>
+		/// <returns> True if enqueues whose order could differ between runs are rejected, false if not. </returns>
+		bool IsDeterministic() const;
+
+		/// <summary>
+		/// Static function to get the number of times any EventQueue has begun delivering, so that work needed once per update, rather than once per event, can tell when one has started.
+		/// </summary>
+		/// <returns> The number of Updates begun on every EventQueue so far. </returns>
+		static std::uint64_t UpdateCount();
+
+		/// <summary>
+		/// Function to remove an event from the queue before it is published. An event whose publisher is still referenced elsewhere
+		/// is requeued every time it is published, and cancelling it stops it for good. Cancelling an event that is being delivered
+		/// keeps it from being requeued. Events enqueued from other threads can be cancelled before they are merged, but events in a Batch cannot until it is merged.
+		/// </summary>
+		/// <param name="handle"> The Handle returned when the event was enqueued. </param>
+		/// <returns> True if the event was queued and has been removed, false if it had already been published or cancelled. </returns>
+		bool Cancel(Handle handle);
+
+		/// <summary>
+		/// Publishes the events that are due, in deadline order, and deletes/requeues them after. Events due at the same time are published
+		/// in the order they were merged into the queue, with requeued events going after the ones already queued. A requeued event is next due
+		/// one delay after the Update that published it. In deterministic mode it is instead due one delay after its previous deadline,
+		/// so that repeating events keep the same schedule on every run, however late the frames that publish them are.
+		/// Events enqueued since the last Update are merged in first; events enqueued while delivering wait for the next Update.
 		/// </summary>
 		/// <param name="gameTime">Const reference to a GameTime instance to check if the Events are expired. </param>
 		void Update(const GameTime& gameTime);
 
 		/// <summary>
-		/// Function to clear the contents of the EventQueue.
+		/// Function to clear the contents of the EventQueue, including pending events. Storage is kept for reuse.
 		/// </summary>
 		void Clear();
 
@@ -41,14 +185,164 @@ namespace FieaGameEngine
 		bool IsEmpty();
 
 		/// <summary>
-		/// Function to get the size of the EventQueue.
+		/// Function to get the size of the EventQueue. Called while the queue is delivering, it leaves out events enqueued since the Update began.
 		/// </summary>
 		/// <returns> The size of the EventQueue. </returns>
 		std::size_t Size();
 
 	private:
-		Vector<EventQueueArgs> _eventQueue{ 17 };
+		/// <summary>
+		/// A node of the pending list. Nodes live in blocks owned by the queue, and are linked on the free list by index rather than by pointer,
+		/// so that the head of the free list and a tag fit in one word that can be swapped without a lock.
+		/// </summary>
+		struct PendingEvent final
+		{
+			EventQueueArgs Args;
+			PendingEvent* Next{ nullptr };
+			std::uint32_t Index{ 0 };
+			std::atomic<std::uint32_t> NextFree{ 0 };
+		};
+
+		static constexpr std::size_t FirstPendingBlockSize = 16;
+		static constexpr std::size_t PendingBlockCount = 27;
+
+		/// <summary>
+		/// An event in the queue. Slots are recycled through a free list, and each one knows where it sits in the heap so that it can be cancelled.
+		/// </summary>
+		struct ScheduledEvent final
+		{
+			EventQueueArgs Args;
+			std::chrono::high_resolution_clock::time_point Deadline;
+			std::uint64_t Sequence{ 0 };
+			std::size_t HeapIndex{ NotInHeap };
+		};
+
+		static constexpr std::size_t NotInHeap = std::numeric_limits<std::size_t>::max();
+
+		/// <summary>
+		/// Throws if the queue is in deterministic mode and the calling thread does not own it.
+		/// </summary>
+		void CheckDeterministicEnqueue() const;
+
+		/// <summary>
+		/// Takes a node from the free list, or allocates a new block of them if it is empty, and fills it in.
+		/// </summary>
+		/// <returns> The node, linked in front of next. </returns>
+		PendingEvent* AcquirePending(EventQueueArgs&& args, PendingEvent* next);
+
+		/// <summary>
+		/// Returns a chain of emptied nodes, linked through Next, to the free list in one step.
+		/// </summary>
+		void RecyclePending(PendingEvent* first);
+
+		/// <summary>
+		/// Links a chain of nodes, already linked through NextFree from first to last, onto the free list in one step.
+		/// </summary>
+		void PushFreePending(PendingEvent& first, PendingEvent& last);
+
+		/// <summary>
+		/// Allocates the next block of nodes, keeps its first node for the caller and puts the rest on the free list.
+		/// </summary>
+		/// <returns> A node that is not on the free list, or nullptr if another thread added the block first. </returns>
+		PendingEvent* GrowPending();
+
+		/// <summary>
+		/// Finds the node with an index. Block k holds FirstPendingBlockSize &lt;&lt; k nodes.
+		/// </summary>
+		PendingEvent& PendingAt(std::uint32_t index) const;
+
+		/// <summary>
+		/// Links a chain of pending events, given newest first, onto the pending list in one step.
+		/// </summary>
+		void PushPending(PendingEvent* newest, PendingEvent* oldest);
+
+		/// <summary>
+		/// Takes the whole pending list and schedules it, oldest first.
+		/// </summary>
+		void MergePending();
+
+		/// <summary>
+		/// Puts an event into a free slot and pushes it onto the heap.
+		/// </summary>
+		void Schedule(EventQueueArgs&& args);
+
+		/// <summary>
+		/// Empties a slot that is not in the heap and returns it to the free list.
+		/// </summary>
+		void Release(std::size_t slot);
+
+		/// <summary>
+		/// Checks if the event in a slot is due before the event in another, or at the same time but was scheduled first.
+		/// </summary>
+		bool IsEarlier(std::size_t slot, std::size_t otherSlot) const;
+
+		/// <summary>
+		/// Pushes a slot onto the heap.
+		/// </summary>
+		void PushHeap(std::size_t slot);
+
+		/// <summary>
+		/// Takes the slot at a position out of the heap, keeping the rest of it in order.
+		/// </summary>
+		/// <returns> The slot that was removed. </returns>
+		std::size_t RemoveFromHeap(std::size_t heapIndex);
+
+		/// <summary>
+		/// Moves the slot at a position towards the root until its parent is due no later than it.
+		/// </summary>
+		void SiftUp(std::size_t heapIndex);
+
+		/// <summary>
+		/// Moves the slot at a position towards the leaves until neither child is due before it.
+		/// </summary>
+		void SiftDown(std::size_t heapIndex);
+
+		/// <summary>
+		/// Stores a slot at a position in the heap and records the position in the slot.
+		/// </summary>
+		void PlaceInHeap(std::size_t heapIndex, std::size_t slot);
+
+		Vector<ScheduledEvent> _slots{ 17 };
+		Vector<std::size_t> _freeSlots;
+
+		/// <summary>
+		/// Indices of the queued slots, ordered as a binary min-heap on their deadlines and then the order they were scheduled in.
+		/// </summary>
+		Vector<std::size_t> _heap;
+
+		/// <summary>
+		/// Slot of every queued event by the id in its Handle, including events that are being delivered.
+		/// </summary>
+		HashMap<std::uint64_t, std::size_t> _slotsById;
+
+		/// <summary>
+		/// Slots delivered during the current Update that are to be requeued once it finishes.
+		/// </summary>
+		Vector<std::size_t> _delivered;
+
+		std::atomic<std::uint64_t> _nextId{ 1 };
+		std::uint64_t _nextSequence{ 0 };
+
+		/// <summary>
+		/// Events enqueued since the last merge, newest first.
+		/// </summary>
+		std::atomic<PendingEvent*> _pending{ nullptr };
+
+		/// <summary>
+		/// The blocks every pending node lives in, each twice the size of the one before. A block is never moved or freed before the queue is destroyed.
+		/// </summary>
+		std::atomic<PendingEvent*> _pendingBlocks[PendingBlockCount]{};
+
+		/// <summary>
+		/// Emptied pending nodes kept for reuse, as a stack any thread may push to or pop from. The low half holds the index of the top node plus one,
+		/// or zero when it is empty; the high half is a tag bumped by every change, so that a thread whose pop raced with others cannot succeed on a stale top.
+		/// </summary>
+		std::atomic<std::uint64_t> _freePending{ 0 };
+
+		std::atomic<bool> _isUpdating{ false };
+		inline static std::atomic<std::uint64_t> _updateCount{ 0 };
 
-		bool _isUpdating{ false };
+		std::thread::id _ownerThread;
+		std::atomic<bool> _isDeterministic{ false };
 	};
-}
\ No newline at end of file
+}
@@ -1,7 +1,9 @@
 #pragma once
 #include <string>
 #include <memory>
+#include <type_traits>
 #include "HashMap.h"
+#include "IAllocator.h"
 #include <gsl/gsl>
 
 namespace FieaGameEngine
@@ -27,6 +29,14 @@ namespace FieaGameEngine
 		/// <returns> Pointer to the newly created object by the Factory associated with the class name. Calling context is now responsible for deleting the pointer. </returns>
 		inline static gsl::owner<T*> Create(const std::string& className);
 
+		/// <summary>
+		/// Function that creates an object through the Factory associated with the given class name, taking its memory and storage from the given allocator.
+		/// </summary>
+		/// <param name="className"> The name of the type of Factory to be found. </param>
+		/// <param name="allocator"> The allocator the new object is to be placed in. </param>
+		/// <returns> Pointer to the newly created object by the Factory associated with the class name. Calling context is now responsible for deleting the pointer. </returns>
+		inline static gsl::owner<T*> Create(const std::string& className, IAllocator& allocator);
+
 		/// <summary>
 		/// Function that clears the list of Factories.
 		/// </summary>
@@ -34,6 +44,14 @@ namespace FieaGameEngine
 
 		virtual gsl::owner<T*> Create() const = 0;
 
+		/// <summary>
+		/// Creates an object taking its memory and storage from the given allocator. Products that cannot be placed in an allocator are created
+		/// as by Create() instead; ConcreteScopeFactory overrides this for Scopes, which record their allocator.
+		/// </summary>
+		/// <param name="allocator"> The allocator the new object is to be placed in, if it can be. </param>
+		/// <returns> Pointer to the newly created object. Calling context is now responsible for deleting the pointer. </returns>
+		virtual gsl::owner<T*> Create(IAllocator& allocator) const;
+
 		virtual const std::string& ClassName() const = 0;
 
 		virtual ~Factory() = default;
@@ -80,5 +98,38 @@ class ConcreteProductType ## Factory final : public FieaGameEngine::Factory<Fiea
 		std::string _className;																						\
 };
 
+/// <summary>
+/// Factory for a Scope-derived product, which is placed in the allocator it is created with and takes it as its constructor argument,
+/// so that its own storage comes from the same place.
+/// </summary>
+#define ConcreteScopeFactory(ConcreteProductType)																	\
+class ConcreteProductType ## Factory final : public FieaGameEngine::Factory<FieaGameEngine::Scope>					\
+{																													\
+	static_assert(std::is_base_of_v<FieaGameEngine::Scope, ConcreteProductType>);									\
+	public:																											\
+		ConcreteProductType ## Factory() : _className{std::string(#ConcreteProductType)}							\
+		{																											\
+			Add(_className, *this);																					\
+		}																											\
+		gsl::owner<FieaGameEngine::Scope*> Create() const override													\
+		{																											\
+			return new ConcreteProductType{};																		\
+		}																											\
+		gsl::owner<FieaGameEngine::Scope*> Create(FieaGameEngine::IAllocator& allocator) const override				\
+		{																											\
+			return new (allocator) ConcreteProductType{ allocator };												\
+		}																											\
+		const std::string& ClassName() const override																\
+		{																											\
+			return _className;																						\
+		}																											\
+		~ConcreteProductType ## Factory()																			\
+		{																											\
+			Remove(*this);																							\
+		}																											\
+	private:																										\
+		std::string _className;																						\
+};
+
 }
 #include "Factory.inl"
\ No newline at end of file
@@ -18,6 +18,20 @@ namespace FieaGameEngine
 		return Factories.Find(className)->second->Create();
 	}
 
+	template<typename T>
+	inline gsl::owner<T*> Factory<T>::Create(const std::string& className, IAllocator& allocator)
+	{
+		assert(Factories.ContainsKey(className));
+
+		return Factories.Find(className)->second->Create(allocator);
+	}
+
+	template<typename T>
+	inline gsl::owner<T*> Factory<T>::Create(IAllocator&) const
+	{
+		return Create();
+	}
+
 	template<typename T>
 	inline void Factory<T>::Add(const std::string& className, Factory& factory)
 	{
@@ -0,0 +1,63 @@
+#pragma once
+#include <cstddef>
+
+namespace FieaGameEngine
+{
+	/// <summary>
+	/// Last in, first out stack with a hard bound on its depth. The elements live inside the object, so it never allocates.
+	/// Meant for stacks whose depth is known up front, such as an evaluator stack sized for the deepest expression.
+	/// </summary>
+	/// <typeparam name="T"> The type of the elements. </typeparam>
+	/// <typeparam name="N"> The maximum number of elements. </typeparam>
+	template <typename T, std::size_t N>
+	class FixedStack final
+	{
+		static_assert(N > 0, "FixedStack needs room for at least one element.");
+
+	public:
+		FixedStack() = default;
+		FixedStack(const FixedStack& other);
+		FixedStack(FixedStack&& other) noexcept;
+		FixedStack& operator=(const FixedStack& rhs);
+		FixedStack& operator=(FixedStack&& rhs) noexcept;
+		~FixedStack();
+
+		/// <summary>
+		/// Constructs an element in place at the top of the FixedStack.
+		/// </summary>
+		/// <exception cref="overflow_error"> Throws if the FixedStack is full. </exception>
+		template <typename... Args>
+		void Emplace(Args&&... args);
+
+		void Push(const T& value);
+
+		void Push(T&& value);
+
+		/// <summary>
+		/// Removes the element at the top of the FixedStack.
+		/// </summary>
+		/// <exception cref="runtime_error"> Throws if the FixedStack is empty. </exception>
+		void Pop();
+
+		/// <exception cref="runtime_error"> Throws if the FixedStack is empty. </exception>
+		[[nodiscard]] T& Top();
+		[[nodiscard]] const T& Top() const;
+		std::size_t Size() const;
+
+		bool IsEmpty() const;
+
+		bool IsFull() const;
+
+		static constexpr std::size_t Capacity() { return N; }
+
+		void Clear();
+
+	private:
+		T* Data();
+		const T* Data() const;
+
+		std::size_t _size{ 0 };
+		alignas(T) std::byte _storage[N * sizeof(T)];
+	};
+}
+#include "FixedStack.inl"
\ No newline at end of file
@@ -0,0 +1,140 @@
+#pragma once
+#include "FixedStack.h"
+#include <stdexcept>
+#include <utility>
+
+namespace FieaGameEngine
+{
+	template<typename T, std::size_t N>
+	FixedStack<T, N>::FixedStack(const FixedStack& other)
+	{
+		for (std::size_t i = 0; i < other._size; ++i)
+			Emplace(other.Data()[i]);
+	}
+
+	template<typename T, std::size_t N>
+	FixedStack<T, N>::FixedStack(FixedStack&& other) noexcept
+	{
+		for (std::size_t i = 0; i < other._size; ++i)
+			Emplace(std::move(other.Data()[i]));
+		other.Clear();
+	}
+
+	template<typename T, std::size_t N>
+	FixedStack<T, N>& FixedStack<T, N>::operator=(const FixedStack& rhs)
+	{
+		if (this != &rhs)
+		{
+			Clear();
+			for (std::size_t i = 0; i < rhs._size; ++i)
+				Emplace(rhs.Data()[i]);
+		}
+		return *this;
+	}
+
+	template<typename T, std::size_t N>
+	FixedStack<T, N>& FixedStack<T, N>::operator=(FixedStack&& rhs) noexcept
+	{
+		if (this != &rhs)
+		{
+			Clear();
+			for (std::size_t i = 0; i < rhs._size; ++i)
+				Emplace(std::move(rhs.Data()[i]));
+			rhs.Clear();
+		}
+		return *this;
+	}
+
+	template<typename T, std::size_t N>
+	inline FixedStack<T, N>::~FixedStack()
+	{
+		Clear();
+	}
+
+	template<typename T, std::size_t N>
+	template<typename... Args>
+	inline void FixedStack<T, N>::Emplace(Args&&... args)
+	{
+		if (_size == N)
+			throw std::overflow_error("Stack is full.");
+
+		new (Data() + _size) T(std::forward<Args>(args)...);
+		++_size;
+	}
+
+	template<typename T, std::size_t N>
+	inline void FixedStack<T, N>::Push(const T& value)
+	{
+		Emplace(value);
+	}
+
+	template<typename T, std::size_t N>
+	inline void FixedStack<T, N>::Push(T&& value)
+	{
+		Emplace(std::move(value));
+	}
+
+	template<typename T, std::size_t N>
+	inline void FixedStack<T, N>::Pop()
+	{
+		if (_size == 0)
+			throw std::runtime_error("Stack is empty.");
+
+		Data()[--_size].~T();
+	}
+
+	template<typename T, std::size_t N>
+	inline T& FixedStack<T, N>::Top()
+	{
+		if (_size == 0)
+			throw std::runtime_error("Stack is empty.");
+
+		return Data()[_size - 1];
+	}
+
+	template<typename T, std::size_t N>
+	inline const T& FixedStack<T, N>::Top() const
+	{
+		if (_size == 0)
+			throw std::runtime_error("Stack is empty.");
+
+		return Data()[_size - 1];
+	}
+
+	template<typename T, std::size_t N>
+	inline std::size_t FixedStack<T, N>::Size() const
+	{
+		return _size;
+	}
+
+	template<typename T, std::size_t N>
+	inline bool FixedStack<T, N>::IsEmpty() const
+	{
+		return _size == 0;
+	}
+
+	template<typename T, std::size_t N>
+	inline bool FixedStack<T, N>::IsFull() const
+	{
+		return _size == N;
+	}
+
+	template<typename T, std::size_t N>
+	inline void FixedStack<T, N>::Clear()
+	{
+		while (_size > 0)
+			Data()[--_size].~T();
+	}
+
+	template<typename T, std::size_t N>
+	inline T* FixedStack<T, N>::Data()
+	{
+		return reinterpret_cast<T*>(_storage);
+	}
+
+	template<typename T, std::size_t N>
+	inline const T* FixedStack<T, N>::Data() const
+	{
+		return reinterpret_cast<const T*>(_storage);
+	}
+}
\ No newline at end of file
@@ -1,5 +1,6 @@
 #include "GameObject.h"
 #include "Action.h"
+#include <cmath>
 
 using namespace std;
 
@@ -7,16 +8,84 @@ namespace FieaGameEngine
 {
 	RTTI_DEFINITIONS(GameObject);
 
-	GameObject::GameObject() 
-		: Attributed(GameObject::TypeIdClass())
+	GameObject::GameObject()
+		: GameObject(IAllocator::Default())
 	{
 	}
 
-	GameObject::GameObject(RTTI::IdType idType)
-		: Attributed(idType)
+	GameObject::GameObject(IAllocator& allocator)
+		: Attributed(GameObject::TypeIdClass(), allocator)
 	{
 	}
 
+	GameObject::GameObject(RTTI::IdType idType, IAllocator& allocator)
+		: Attributed(idType, allocator)
+	{
+	}
+
+	GameObject::GameObject(const GameObject& other)
+		: Attributed{ other }, Name{ other.Name }, Transform{ other.GetPosition(), other.GetRotation(), other.GetScale() }
+	{
+		if (other._transformStore != nullptr)
+			other._transformStore->Add(*this);
+	}
+
+	GameObject::GameObject(GameObject&& other) noexcept
+		: Attributed{ move(other) }, Name{ move(other.Name) }, Transform{ other.Transform }, _transformStore{ other._transformStore }, _transformIndex{ other._transformIndex }
+	{
+		if (_transformStore != nullptr)
+		{
+			other._transformStore = nullptr;
+			_transformStore->_owners[_transformIndex] = this;
+			BindTransform();
+		}
+		MarkTransformDirty();
+	}
+
+	GameObject& GameObject::operator=(const GameObject& rhs)
+	{
+		if (this != &rhs)
+		{
+			Attributed::operator=(rhs);
+			Name = rhs.Name;
+			GetPosition() = rhs.GetPosition();
+			GetRotation() = rhs.GetRotation();
+			GetScale() = rhs.GetScale();
+			BindTransform();
+			MarkTransformDirty();
+		}
+		return *this;
+	}
+
+	GameObject& GameObject::operator=(GameObject&& rhs) noexcept
+	{
+		if (this != &rhs)
+		{
+			if (_transformStore != nullptr)
+				_transformStore->Remove(*this);
+
+			Attributed::operator=(move(rhs));
+			Name = move(rhs.Name);
+			Transform = rhs.Transform;
+			_transformStore = rhs._transformStore;
+			_transformIndex = rhs._transformIndex;
+			if (_transformStore != nullptr)
+			{
+				rhs._transformStore = nullptr;
+				_transformStore->_owners[_transformIndex] = this;
+				BindTransform();
+			}
+			MarkTransformDirty();
+		}
+		return *this;
+	}
+
+	GameObject::~GameObject()
+	{
+		if (_transformStore != nullptr)
+			_transformStore->Remove(*this);
+	}
+
 	GameObject* GameObject::Clone() const
 	{
 		return new GameObject{ *this };
@@ -24,13 +93,71 @@ namespace FieaGameEngine
 
 	void GameObject::Update(GameState& gameState)
 	{
-		UpdateChildren(gameState);
+		// A parent that is handing its world transform down has just brought it up to date, so there is no need to walk past it.
+		GameObject* parent = ParentGameObject();
+		if (parent != nullptr && parent->_isHandingDownWorldTransform)
+			RefreshWorldTransform(parent);
+		else
+			GetWorldTransform();
+
+		_isHandingDownWorldTransform = true;
+		try
+		{
+			UpdateChildren(gameState);
+		}
+		catch (...)
+		{
+			_isHandingDownWorldTransform = false;
+			throw;
+		}
+		_isHandingDownWorldTransform = false;
+
 		UpdateActions(gameState);
 	}
 
 	void GameObject::UpdateChildren(GameState& gameState)
 	{
 		Datum& children = GetChildren();
+		JobSystem* jobSystem = gameState.GetJobSystem();
+		if (jobSystem != nullptr && children.Size() > 1)
+		{
+			// Each child enqueues its events into a Batch of its own, merged in child order so that the queue ends up as it would serially.
+			EventQueue& eventQueue = gameState.GetEventQueue();
+			while (_childJobs.Size() < children.Size())
+				_childJobs.EmplaceBack();
+
+			JobSystem::Counter counter;
+			for (size_t i = 0; i < children.Size(); ++i)
+			{
+				assert(children[i].Is(GameObject::TypeIdClass()));
+				ChildJob& childJob = _childJobs[i];
+				childJob.Child = static_cast<GameObject*>(&children[i]);
+
+				// Two references keep the closure small enough for std::function to store in place.
+				jobSystem->Schedule([&childJob, &gameState]()
+				{
+					EventQueue::BatchScope batchScope{ gameState.GetEventQueue(), childJob.Events };
+					childJob.Child->Update(gameState);
+				}, counter);
+			}
+
+			try
+			{
+				jobSystem->Wait(counter);
+			}
+			catch (...)
+			{
+				// Events from a frame that failed part-way are dropped, rather than being merged into the next one.
+				for (size_t i = 0; i < children.Size(); ++i)
+					_childJobs[i].Events = EventQueue::Batch{};
+				throw;
+			}
+
+			for (size_t i = 0; i < children.Size(); ++i)
+				eventQueue.Merge(_childJobs[i].Events);
+			return;
+		}
+
 		for (size_t i = 0; i < children.Size(); ++i)
 		{
 			assert(children[i].Is(GameObject::TypeIdClass()));
@@ -52,7 +179,7 @@ namespace FieaGameEngine
 
 	void GameObject::CreateAction(const string& actionName, const string& instanceName)
 	{
-		Scope* createdScope = Factory<Scope>::Create(actionName);
+		Scope* createdScope = Factory<Scope>::Create(actionName, GetAllocator());
 		assert(createdScope != nullptr);
 		assert(createdScope->Is(Action::TypeIdClass()));
 		Action* action = static_cast<Action*>(createdScope);
@@ -72,6 +199,163 @@ namespace FieaGameEngine
 		return _orderVector[7]->second;
 	}
 
+	glm::vec4& GameObject::GetPosition()
+	{
+		return _transformStore != nullptr ? _transformStore->_positions[_transformIndex] : Transform.Position;
+	}
+
+	const glm::vec4& GameObject::GetPosition() const
+	{
+		return _transformStore != nullptr ? _transformStore->_positions[_transformIndex] : Transform.Position;
+	}
+
+	glm::vec4& GameObject::GetRotation()
+	{
+		return _transformStore != nullptr ? _transformStore->_rotations[_transformIndex] : Transform.Rotation;
+	}
+
+	const glm::vec4& GameObject::GetRotation() const
+	{
+		return _transformStore != nullptr ? _transformStore->_rotations[_transformIndex] : Transform.Rotation;
+	}
+
+	glm::vec4& GameObject::GetScale()
+	{
+		return _transformStore != nullptr ? _transformStore->_scales[_transformIndex] : Transform.Scale;
+	}
+
+	const glm::vec4& GameObject::GetScale() const
+	{
+		return _transformStore != nullptr ? _transformStore->_scales[_transformIndex] : Transform.Scale;
+	}
+
+	TransformStore* GameObject::GetTransformStore() const
+	{
+		return _transformStore;
+	}
+
+	void GameObject::SetPosition(const glm::vec4& value)
+	{
+		GetPosition() = value;
+		MarkTransformDirty();
+	}
+
+	void GameObject::SetRotation(const glm::vec4& value)
+	{
+		GetRotation() = value;
+		MarkTransformDirty();
+	}
+
+	void GameObject::SetScale(const glm::vec4& value)
+	{
+		GetScale() = value;
+		MarkTransformDirty();
+	}
+
+	const glm::mat4& GameObject::GetWorldTransform()
+	{
+		// Each ancestor is brought up to date first, so that a change written anywhere above is found.
+		GameObject* parent = ParentGameObject();
+		if (parent != nullptr)
+			parent->GetWorldTransform();
+		return RefreshWorldTransform(parent);
+	}
+
+	std::size_t GameObject::WorldTransformCheckCount() const
+	{
+		return _worldTransformChecks.load(memory_order_relaxed);
+	}
+
+	GameObject* GameObject::ParentGameObject()
+	{
+		Scope* parentScope = GetParent();
+		return parentScope != nullptr && parentScope->Is(GameObject::TypeIdClass()) ? static_cast<GameObject*>(parentScope) : nullptr;
+	}
+
+	const glm::mat4& GameObject::RefreshWorldTransform(const GameObject* parent)
+	{
+		_worldTransformChecks.fetch_add(1, memory_order_relaxed);
+		if (parent != _worldParent)
+		{
+			_worldParent = parent;
+			MarkTransformDirty();
+		}
+		if (!_worldTransformDirty && HasLocalTransformChanged())
+			MarkTransformDirty();
+
+		// The parent's version says if it was rebuilt since the cached world transform was.
+		const size_t parentVersion = parent != nullptr ? parent->_worldVersion : 0;
+		if (_worldTransformDirty || parentVersion != _builtParentVersion)
+		{
+			_worldTransform = parent != nullptr ? parent->_worldTransform * LocalTransform() : LocalTransform();
+			_builtLocalTransform = { GetPosition(), GetRotation(), GetScale() };
+			_builtParentVersion = parentVersion;
+			++_worldVersion;
+			_worldTransformDirty = false;
+		}
+		return _worldTransform;
+	}
+
+	void GameObject::MarkTransformDirty()
+	{
+		_worldTransformDirty = true;
+
+		// A dirty child already has a dirty subtree, so the walk stops there.
+		Datum& children = GetChildren();
+		for (size_t i = 0; i < children.Size(); ++i)
+		{
+			assert(children[i].Is(GameObject::TypeIdClass()));
+			GameObject& child = static_cast<GameObject&>(children[i]);
+			if (!child._worldTransformDirty)
+				child.MarkTransformDirty();
+		}
+	}
+
+	bool GameObject::IsTransformDirty() const
+	{
+		return _worldTransformDirty;
+	}
+
+	bool GameObject::HasLocalTransformChanged() const
+	{
+		return GetPosition() != _builtLocalTransform.Position || GetRotation() != _builtLocalTransform.Rotation || GetScale() != _builtLocalTransform.Scale;
+	}
+
+	glm::mat4 GameObject::LocalTransform() const
+	{
+		const float degreesToRadians = 3.14159265358979f / 180.0f;
+		const glm::vec4& position = GetPosition();
+		const glm::vec4& rotation = GetRotation();
+		const glm::vec4& scale = GetScale();
+
+		const float cx = std::cos(rotation.x * degreesToRadians), sx = std::sin(rotation.x * degreesToRadians);
+		const float cy = std::cos(rotation.y * degreesToRadians), sy = std::sin(rotation.y * degreesToRadians);
+		const float cz = std::cos(rotation.z * degreesToRadians), sz = std::sin(rotation.z * degreesToRadians);
+
+		// Translation * RotationZ * RotationY * RotationX * Scale, written out column by column.
+		return glm::mat4
+		{
+			glm::vec4{ cy * cz, cy * sz, -sy, 0.0f } * scale.x,
+			glm::vec4{ cz * sx * sy - cx * sz, cx * cz + sx * sy * sz, cy * sx, 0.0f } * scale.y,
+			glm::vec4{ cx * cz * sy + sx * sz, cx * sy * sz - cz * sx, cx * cy, 0.0f } * scale.z,
+			glm::vec4{ position.x, position.y, position.z, 1.0f }
+		};
+	}
+
+	void GameObject::BindTransform()
+	{
+		if (_transformStore == nullptr)
+		{
+			UpdateExternalPointers();
+			return;
+		}
+
+		assert(IsPrescribedAttribute("Position"s) && IsPrescribedAttribute("Rotation"s) && IsPrescribedAttribute("Scale"s));
+		_orderVector[3]->second.SetStorage(&_transformStore->_positions[_transformIndex], 1);
+		_orderVector[4]->second.SetStorage(&_transformStore->_rotations[_transformIndex], 1);
+		_orderVector[5]->second.SetStorage(&_transformStore->_scales[_transformIndex], 1);
+	}
+
 	Vector<Signature> GameObject::Signatures()
 	{
 		return Vector<Signature>
@@ -82,7 +366,8 @@ namespace FieaGameEngine
 			{ "Rotation", Datum::DatumTypes::Vector, 1, offsetof(GameObject, Transform.Rotation) },
 			{ "Scale", Datum::DatumTypes::Vector, 1, offsetof(GameObject, Transform.Scale) },
 			{ "Children", Datum::DatumTypes::Table, 0, 0},
-			{ "Actions", Datum::DatumTypes::Table, 0, 0}
+			{ "Actions", Datum::DatumTypes::Table, 0, 0},
+			{ "WorldTransform", Datum::DatumTypes::Matrix, 1, offsetof(GameObject, _worldTransform) }
 		};
 	}
 }
\ No newline at end of file
@@ -4,6 +4,8 @@
 #include "TypeManager.h"
 #include "Factory.h"
 #include "GameState.h"
+#include "TransformStore.h"
+#include <atomic>
 
 namespace FieaGameEngine
 {
@@ -24,16 +26,51 @@ namespace FieaGameEngine
 	{
 		RTTI_DECLARATIONS(GameObject, Attributed);
 
+		friend TransformStore;
+
 	public:
 		GameObject();
-		GameObject(const GameObject& other) = default;
-		GameObject(GameObject&& other) noexcept = default;
-		GameObject& operator=(const GameObject& rhs) = default;
-		GameObject& operator=(GameObject&& rhs) noexcept = default;
-		virtual ~GameObject() = default;
 
 		/// <summary>
-		/// Virtual Update function that is called every frame and calls Update on all children GameObjects and Actions.
+		/// Constructor for GameObject that takes its storage from the given allocator, as factories do when creating it in one.
+		/// </summary>
+		/// <param name="allocator"> The allocator the GameObject takes its storage from. </param>
+		explicit GameObject(IAllocator& allocator);
+
+		/// <summary>
+		/// Copy constructor for GameObject. The copy joins the TransformStore of the original, if it has one.
+		/// </summary>
+		/// <param name="other"> The GameObject to be copied. </param>
+		GameObject(const GameObject& other);
+
+		/// <summary>
+		/// Move constructor for GameObject. The new GameObject takes over the TransformStore slot of the original, if it has one.
+		/// </summary>
+		/// <param name="other"> The GameObject to be moved. </param>
+		GameObject(GameObject&& other) noexcept;
+
+		/// <summary>
+		/// Copy assignment operator for GameObject. "This" GameObject stays in whichever TransformStore it was in.
+		/// </summary>
+		/// <param name="rhs"> The GameObject to be copied. </param>
+		/// <returns> A reference to "this" GameObject. </returns>
+		GameObject& operator=(const GameObject& rhs);
+
+		/// <summary>
+		/// Move assignment operator for GameObject. "This" GameObject leaves its TransformStore and takes over the slot of the original, if it has one.
+		/// </summary>
+		/// <param name="rhs"> The GameObject to be moved. </param>
+		/// <returns> A reference to "this" GameObject. </returns>
+		GameObject& operator=(GameObject&& rhs) noexcept;
+
+		/// <summary>
+		/// Destructor for GameObject, which gives up its TransformStore slot.
+		/// </summary>
+		virtual ~GameObject();
+
+		/// <summary>
+		/// Virtual Update function that is called every frame. Brings the world transform up to date, then calls Update on all children GameObjects and Actions.
+		/// The children are handed the world transform just computed, so a whole tree is brought up to date with one check per GameObject.
 		/// </summary>
 		/// <param name="gameTime"> A const reference to a GameTime instance. </param>
 		virtual void Update(GameState& gameState);
@@ -69,6 +106,62 @@ namespace FieaGameEngine
 		/// <returns> The Vector of signatures of the Attributes of the GameObject class. </returns>
 		static Vector<Signature> Signatures();
 
+		/// <summary>
+		/// Getters for the current transform, wherever it lives. While the GameObject is in a TransformStore the Transform member is
+		/// not kept up to date; these and the "Position", "Rotation" and "Scale" attributes always are.
+		/// </summary>
+		/// <returns> A reference to the position, rotation or scale of the GameObject. </returns>
+		glm::vec4& GetPosition();
+		const glm::vec4& GetPosition() const;
+		glm::vec4& GetRotation();
+		const glm::vec4& GetRotation() const;
+		glm::vec4& GetScale();
+		const glm::vec4& GetScale() const;
+
+		/// <summary>
+		/// Function to get the TransformStore the GameObject's transform lives in.
+		/// </summary>
+		/// <returns> Pointer to the TransformStore, or nullptr if the transform lives in the Transform member. </returns>
+		TransformStore* GetTransformStore() const;
+
+		/// <summary>
+		/// Setters for the local transform, which also mark the world transforms of "this" GameObject and its descendants out of date.
+		/// </summary>
+		/// <param name="value"> The new position, rotation (Euler angles in degrees, applied about X, then Y, then Z) or scale. </param>
+		void SetPosition(const glm::vec4& value);
+		void SetRotation(const glm::vec4& value);
+		void SetScale(const glm::vec4& value);
+
+		/// <summary>
+		/// Function to get the world-space transform of the GameObject, the product of its parents' local transforms and its own.
+		/// The result is cached, and recomputed only after the local transform of the GameObject or one of its ancestors has changed,
+		/// however it was written: through the setters, the "Position", "Rotation" and "Scale" attributes, or the TransformStore arrays.
+		/// Every call walks up to the root to compare each ancestor's local transform with the one its cached world transform was built from;
+		/// Update avoids the walk by handing each parent's world transform down to its children instead.
+		/// Moving the GameObject under another parent is picked up the next time its own world transform is requested.
+		/// </summary>
+		/// <returns> A const reference to the cached world transform, which is also the "WorldTransform" attribute. </returns>
+		const glm::mat4& GetWorldTransform();
+
+		/// <summary>
+		/// Function to mark the world transforms of "this" GameObject and its descendants out of date. The setters call this so that
+		/// IsTransformDirty answers at once; writes that bypass them are caught by GetWorldTransform without it.
+		/// </summary>
+		void MarkTransformDirty();
+
+		/// <summary>
+		/// Function to check if the cached world transform is out of date.
+		/// </summary>
+		/// <returns> True if GetWorldTransform will recompute the world transform, false otherwise. </returns>
+		bool IsTransformDirty() const;
+
+		/// <summary>
+		/// Function to get the number of times the cached world transform has been checked against the local transform and the parent's,
+		/// whether by Update or by GetWorldTransform walking up from a descendant. Meant for profiling.
+		/// </summary>
+		/// <returns> The number of checks since the GameObject was constructed. </returns>
+		std::size_t WorldTransformCheckCount() const;
+
 		std::string Name{};
 		Transform Transform{};
 
@@ -77,10 +170,13 @@ namespace FieaGameEngine
 		/// Constructor that is responsible for calling Attributed's constructor with the passed in typeId.
 		/// </summary>
 		/// <param name="idType"> The idType to call Attributed's constructor with. </param>
-		GameObject(RTTI::IdType idType);
+		/// <param name="allocator"> The allocator the GameObject takes its storage from. </param>
+		GameObject(RTTI::IdType idType, IAllocator& allocator = IAllocator::Default());
 
 		/// <summary>
-		/// Helper function that calls Update on all children GameObjects.
+		/// Helper function that calls Update on all children GameObjects, as parallel jobs if the GameState has a JobSystem.
+		/// The per-child Batches are kept from frame to frame, so that a warmed-up parallel update allocates nothing for its events;
+		/// what remains is the JobSystem's own bookkeeping, whose task deques may grow or shed a block as jobs come and go.
 		/// </summary>
 		/// <param name="gameTime"> Const reference to a GameTime instance to call the children Updates with. </param>
 		void UpdateChildren(GameState& gameState);
@@ -90,7 +186,62 @@ namespace FieaGameEngine
 		/// </summary>
 		/// <param name="gameTime"> Const reference to a GameTime instance to call the Actions' Updates with. </param>
 		void UpdateActions(GameState& gameState);
+
+	private:
+		/// <summary>
+		/// Points the "Position", "Rotation" and "Scale" Datums at the TransformStore slot, or back at the Transform member if there is no store.
+		/// </summary>
+		void BindTransform();
+
+		/// <summary>
+		/// Builds the local transform matrix from the position, rotation and scale.
+		/// </summary>
+		glm::mat4 LocalTransform() const;
+
+		/// <summary>
+		/// Compares the current position, rotation and scale with the ones the cached world transform was built from.
+		/// </summary>
+		/// <returns> True if the local transform has been written since the world transform was last computed, false otherwise. </returns>
+		bool HasLocalTransformChanged() const;
+
+		/// <summary>
+		/// Gets the parent, if it is a GameObject.
+		/// </summary>
+		/// <returns> Pointer to the parent GameObject, or nullptr if the parent is not a GameObject or there is none. </returns>
+		GameObject* ParentGameObject();
+
+		/// <summary>
+		/// Brings the cached world transform up to date, taking the parent's cached world transform as it is, without walking further up.
+		/// </summary>
+		/// <param name="parent"> The parent GameObject, whose world transform must already be up to date, or nullptr. </param>
+		/// <returns> A const reference to the cached world transform. </returns>
+		const glm::mat4& RefreshWorldTransform(const GameObject* parent);
+
+		/// <summary>
+		/// A child being updated as a job, along with the Batch its events go into until the jobs are joined.
+		/// </summary>
+		struct ChildJob final
+		{
+			GameObject* Child{ nullptr };
+			EventQueue::Batch Events;
+		};
+
+		/// <summary>
+		/// One ChildJob per child, reused by every parallel update. Not copied or moved along with the GameObject.
+		/// </summary>
+		Vector<ChildJob> _childJobs;
+
+		TransformStore* _transformStore{ nullptr };
+		std::size_t _transformIndex{ 0 };
+		glm::mat4 _worldTransform{ 1.0f };
+		const GameObject* _worldParent{ nullptr };
+		struct Transform _builtLocalTransform{};
+		std::size_t _worldVersion{ 0 };
+		std::size_t _builtParentVersion{ 0 };
+		std::atomic<std::size_t> _worldTransformChecks{ 0 };
+		bool _worldTransformDirty{ true };
+		bool _isHandingDownWorldTransform{ false };
 	};
 
-	ConcreteFactory(GameObject, Scope);
+	ConcreteScopeFactory(GameObject);
 }
\ No newline at end of file
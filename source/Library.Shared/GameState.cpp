@@ -18,4 +18,14 @@ namespace FieaGameEngine
 	{
 		return *_gameTime;
 	}
+
+	void GameState::SetJobSystem(JobSystem* jobSystem)
+	{
+		_jobSystem = jobSystem;
+	}
+
+	JobSystem* GameState::GetJobSystem() const
+	{
+		return _jobSystem;
+	}
 }
\ No newline at end of file
@@ -2,6 +2,7 @@
 #include "RTTI.h"
 #include "EventQueue.h"
 #include "GameTime.h"
+#include "JobSystem.h"
 
 namespace FieaGameEngine
 {
@@ -16,8 +17,22 @@ namespace FieaGameEngine
 
 		GameTime& GetGameTime() const;
 
+		/// <summary>
+		/// Function to opt in to updating sibling GameObjects in parallel. While a JobSystem is set, GameObject::Update runs each child's
+		/// subtree as a job and joins them before the parent's Actions run, so Actions in sibling subtrees must be safe to run concurrently.
+		/// </summary>
+		/// <param name="jobSystem"> The JobSystem to update on, or nullptr to update on the calling thread only. </param>
+		void SetJobSystem(JobSystem* jobSystem);
+
+		/// <summary>
+		/// Function to get the JobSystem GameObjects are updated on.
+		/// </summary>
+		/// <returns> Pointer to the JobSystem, or nullptr if updates are not parallel. </returns>
+		JobSystem* GetJobSystem() const;
+
 	private:
 		EventQueue* _eventQueue;
 		GameTime* _gameTime;
+		JobSystem* _jobSystem{ nullptr };
 	};
 }
\ No newline at end of file
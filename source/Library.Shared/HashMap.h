@@ -1,23 +1,30 @@
 #pragma once
 #include "Vector.h"
-#include "SList.h"
 #include "DefaultHash.h"
 #include "DefaultEquality.h"
 
 namespace FieaGameEngine
 {
 	/// <summary>
-	/// HashMap which maintains an unordered set of Key-Value pairs
+	/// HashMap which maintains an unordered set of Key-Value pairs.
+	/// Key-Value pairs are stored contiguously and indexed by an open-addressed slot table that uses Robin Hood probing.
+	/// Iteration follows insertion order until the first Remove, which fills the vacated position with the last pair.
 	/// </summary>
 	template <typename TKey, typename TValue>
 	class HashMap final
 	{
 	public:
 		using PairType = std::pair<const TKey, TValue>;
-		using ChainType = SList<PairType>;
 		using HashFunctor = std::function <std::size_t(const TKey&)>;
 		using KeyComparator = std::function<bool(const TKey&, const TKey&)>;
 
+		/// <summary>
+		/// True for lookup types that cannot be implicitly converted to TKey, such as std::string_view for a std::string key.
+		/// Such types are hashed and compared directly instead of being converted into a temporary key.
+		/// </summary>
+		template <typename TLookup>
+		static constexpr bool IsHeterogeneousLookup = !std::is_convertible_v<const TLookup&, TKey>;
+
 		/// <summary>
 		/// Iterator struct for HashMap which points to a Key-Value pair in the HashMap.
 		/// </summary>
@@ -78,13 +85,11 @@ namespace FieaGameEngine
 			/// Constructor for Iterator.
 			/// </summary>
 			/// <param name="owner"> The HashMap that "this" Iterator belongs to. </param>
-			/// <param name="vecIt"> The bucket to which "this" Iterator points to. </param>
-			/// <param name="listIt"> The SList element "this" Iterator points to. </param>
-			Iterator(const HashMap& owner, const typename Vector<ChainType>::Iterator vecIt, const typename ChainType::Iterator listIt);
+			/// <param name="index"> The index of the Key-Value pair "this" Iterator points to. </param>
+			Iterator(HashMap& owner, std::size_t index);
 
-			const HashMap* _owner{ nullptr };
-			typename Vector<ChainType>::Iterator _vecIt {};
-			typename ChainType::Iterator _listIt {};
+			HashMap* _owner{ nullptr };
+			std::size_t _index{ 0 };
 		};
 
 		/// <summary>
@@ -153,13 +158,11 @@ namespace FieaGameEngine
 			/// Constructor for ConstIterator.
 			/// </summary>
 			/// <param name="owner"> The HashMap that "this" ConstIterator belongs to. </param>
-			/// <param name="vecIt"> The bucket to which "this" ConstIterator points to. </param>
-			/// <param name="listIt"> The SList element "this" ConstIterator points to. </param>
-			ConstIterator(const HashMap& owner, const typename Vector<ChainType>::ConstIterator vecIt, const typename ChainType::ConstIterator listIt);
+			/// <param name="index"> The index of the Key-Value pair "this" ConstIterator points to. </param>
+			ConstIterator(const HashMap& owner, std::size_t index);
 			
 			const HashMap* _owner{ nullptr };
-			typename Vector<ChainType>::ConstIterator _vecIt{};
-			typename ChainType::ConstIterator _listIt{};
+			std::size_t _index{ 0 };
 		};
 		
 		/// <summary>
@@ -170,6 +173,15 @@ namespace FieaGameEngine
 		/// <param name="keyComparator"> Function that only compares the keys between two key-value pairs. Defaulted to DefaultEquality. </param>
 		explicit HashMap(std::size_t capacity = 11, HashFunctor hashFunctor = DefaultHash<TKey>{}, KeyComparator keyComparator = DefaultEquality<TKey>{});
 
+		/// <summary>
+		/// Constructor for HashMap that takes its storage from the given allocator. Copies of the HashMap take their storage from the default allocator.
+		/// </summary>
+		/// <param name="capacity"> The capacity to be reserved on the HashMap. </param>
+		/// <param name="allocator"> The allocator the entries and slots of the HashMap are taken from. </param>
+		/// <param name="hashFunctor"> The hash function that is to be used by this HashMap for inserts and retrievals of elements. Defaulted to DefaultHash. </param>
+		/// <param name="keyComparator"> Function that only compares the keys between two key-value pairs. Defaulted to DefaultEquality. </param>
+		HashMap(std::size_t capacity, IAllocator& allocator, HashFunctor hashFunctor = DefaultHash<TKey>{}, KeyComparator keyComparator = DefaultEquality<TKey>{});
+
 		/// <summary>
 		/// Constructor for HashMap.
 		/// </summary>
@@ -213,6 +225,22 @@ namespace FieaGameEngine
 		/// <returns> A const reference to the Value that is part of the Key-Value pair that was found. </returns>
 		const TValue& At(const TKey& key) const;
 
+		/// <summary>
+		/// At function for HashMap which looks up a key of a different type without converting it to TKey.
+		/// </summary>
+		/// <param name="key"> The key which is to be searched for in the HashMap. </param>
+		/// <returns>  A reference to the Value that is part of the Key-Value pair that was found. </returns>
+		template <typename TLookup, typename = std::enable_if_t<IsHeterogeneousLookup<TLookup>>>
+		TValue& At(const TLookup& key);
+
+		/// <summary>
+		/// At function for HashMap which looks up a key of a different type without converting it to TKey.
+		/// </summary>
+		/// <param name="key"> The key which is to be searched for in the HashMap. </param>
+		/// <returns> A const reference to the Value that is part of the Key-Value pair that was found. </returns>
+		template <typename TLookup, typename = std::enable_if_t<IsHeterogeneousLookup<TLookup>>>
+		const TValue& At(const TLookup& key) const;
+
 		/// <summary>
 		/// ContainsKey function for HashMap to check whether a given Key exists in the HashMap or not.
 		/// </summary>
@@ -220,6 +248,14 @@ namespace FieaGameEngine
 		/// <returns> True if the HashMap contains the given key, false if not. </returns>
 		bool ContainsKey(const TKey& key) const;
 
+		/// <summary>
+		/// ContainsKey function for HashMap which checks for a key of a different type without converting it to TKey.
+		/// </summary>
+		/// <param name="key"> The key which is to be searched for in the HashMap. </param>
+		/// <returns> True if the HashMap contains the given key, false if not. </returns>
+		template <typename TLookup, typename = std::enable_if_t<IsHeterogeneousLookup<TLookup>>>
+		bool ContainsKey(const TLookup& key) const;
+
 		/// <summary>
 		/// Begin method for HashMap.
 		/// </summary>
@@ -270,6 +306,28 @@ namespace FieaGameEngine
 		/// <returns> A ConstIterator which points to the key-value pair associated with the passed in key. </returns>
 		ConstIterator Find(const TKey& key) const;
 
+		/// <summary>
+		/// Find function for HashMap that searches the HashMap for a key of a different type without converting it to TKey.
+		/// The lookup hash must produce the same value as the HashMap's hash function for equivalent keys.
+		/// </summary>
+		/// <param name="key"> The key which is to be searched for in the HashMap. </param>
+		/// <param name="lookupHash"> The hash function for the lookup type. Defaulted to DefaultHash. </param>
+		/// <param name="lookupComparator"> Function that compares a stored key with the lookup key. Defaulted to DefaultEquality of the lookup type. </param>
+		/// <returns> An Iterator which points to the key-value pair associated with the passed in key. </returns>
+		template <typename TLookup, typename LookupHash = DefaultHash<TLookup>, typename LookupComparator = DefaultEquality<TLookup>, typename = std::enable_if_t<IsHeterogeneousLookup<TLookup>>>
+		Iterator Find(const TLookup& key, LookupHash lookupHash = LookupHash{}, LookupComparator lookupComparator = LookupComparator{});
+
+		/// <summary>
+		/// Find function for HashMap that searches the HashMap for a key of a different type without converting it to TKey.
+		/// The lookup hash must produce the same value as the HashMap's hash function for equivalent keys.
+		/// </summary>
+		/// <param name="key"> The key which is to be searched for in the HashMap. </param>
+		/// <param name="lookupHash"> The hash function for the lookup type. Defaulted to DefaultHash. </param>
+		/// <param name="lookupComparator"> Function that compares a stored key with the lookup key. Defaulted to DefaultEquality of the lookup type. </param>
+		/// <returns> A ConstIterator which points to the key-value pair associated with the passed in key. </returns>
+		template <typename TLookup, typename LookupHash = DefaultHash<TLookup>, typename LookupComparator = DefaultEquality<TLookup>, typename = std::enable_if_t<IsHeterogeneousLookup<TLookup>>>
+		ConstIterator Find(const TLookup& key, LookupHash lookupHash = LookupHash{}, LookupComparator lookupComparator = LookupComparator{}) const;
+
 		/// <summary>
 		/// Clear method which clears up the entire HashMap. 
 		/// </summary>
@@ -277,21 +335,41 @@ namespace FieaGameEngine
 
 		/// <summary>
 		/// Resize method to change the capacity of the HashMap while maintaining existing elements.
+		/// Only the slot table is rebuilt, the Key-Value pairs themselves are not copied.
 		/// </summary>
 		/// <param name="newSize"> The new size to which the HashMap is to be resized. </param>
 		void Resize(std::size_t newSize);
 
+		/// <summary>
+		/// Reserve method which pre-sizes the HashMap so that the given number of elements can be inserted without a rehash.
+		/// </summary>
+		/// <param name="count"> The number of elements the HashMap should be able to hold. </param>
+		void Reserve(std::size_t count);
+
 		/// <summary>
 		/// Remove method which uses a key to remove the associated key value pair from the HashMap.
+		/// The last Key-Value pair is moved into the vacated position, so iterators to it are invalidated and iteration no longer follows insertion order.
+		/// Keys and values must be nothrow move constructible, so that a pair is never left half moved.
 		/// </summary>
 		/// <param name="key"> The key associated with the key-value pair which is to be removed from the HashMap. </param>
 		/// <returns> True if the key was found and associated key-value pair was succesfully removed, false if not. </returns>
 		bool Remove(const TKey& key);
 
+		/// <summary>
+		/// Remove method which looks up a key of a different type without converting it to TKey, and removes the associated key value pair from the HashMap.
+		/// Otherwise the same as Remove(const TKey&).
+		/// </summary>
+		/// <param name="key"> The key associated with the key-value pair which is to be removed from the HashMap. </param>
+		/// <param name="lookupHash"> The hash function for the key, which must agree with the HashMap's hash function for equal keys. </param>
+		/// <param name="lookupComparator"> Function that compares a stored key with the passed in key. </param>
+		/// <returns> True if the key was found and associated key-value pair was succesfully removed, false if not. </returns>
+		template <typename TLookup, typename LookupHash = DefaultHash<TLookup>, typename LookupComparator = DefaultEquality<TLookup>, typename = std::enable_if_t<IsHeterogeneousLookup<TLookup>>>
+		bool Remove(const TLookup& key, LookupHash lookupHash = LookupHash{}, LookupComparator lookupComparator = LookupComparator{});
+
 		/// <summary>
 		/// Capacity function for HashMap.
 		/// </summary>
-		/// <returns> The capacity of the HashMap. </returns>
+		/// <returns> The number of slots in the HashMap. </returns>
 		std::size_t Capacity() const;
 
 		/// <summary>
@@ -300,24 +378,97 @@ namespace FieaGameEngine
 		/// <returns> The size of the HashMap. </returns>
 		std::size_t Size() const;
 
+		/// <summary>
+		/// Function to get the allocator the HashMap takes its storage from.
+		/// </summary>
+		/// <returns> A reference to the allocator. </returns>
+		IAllocator& GetAllocator() const;
+
 		/// <summary>
 		/// LoadFactor function for HashMap.
 		/// </summary>
-		/// <returns> The load factor of the HashMap. </returns>
-		std::size_t LoadFactor() const;
+		/// <returns> The load factor of the HashMap, which is the fraction of slots that are occupied: Size() / Capacity(), or zero if there are no slots. </returns>
+		float LoadFactor() const;
+
+		/// <summary>
+		/// MaxLoadFactor function for HashMap.
+		/// </summary>
+		/// <returns> The fraction of slots that may be occupied before an Insert grows the HashMap. </returns>
+		float MaxLoadFactor() const;
+
+		/// <summary>
+		/// Sets the fraction of slots that may be occupied before an Insert grows the HashMap. Rehashes immediately if the HashMap is already above it.
+		/// </summary>
+		/// <param name="maxLoadFactor"> The new maximum load factor, which must be greater than zero and no more than one. </param>
+		void SetMaxLoadFactor(float maxLoadFactor);
 		
 	private:
 
 		/// <summary>
-		/// Returns the hashed index for a particular key.
+		/// Slot in the open-addressed table which refers to a Key-Value pair by its index.
+		/// A Distance of zero marks an empty slot, otherwise it is one more than the slot's offset from its home index.
+		/// </summary>
+		struct Slot final
+		{
+			std::size_t Hash{ 0 };
+			std::size_t Entry{ 0 };
+			std::size_t Distance{ 0 };
+		};
+
+		/// <summary>
+		/// Returns the home slot for a particular hash.
+		/// </summary>
+		/// <param name="hash"> The hash of a key. </param>
+		/// <returns> The index of the slot at which probing for the passed in hash begins. </returns>
+		std::size_t GetIndex(std::size_t hash) const;
+
+		/// <summary>
+		/// Returns the number of slots needed to hold a number of elements without exceeding the maximum load factor.
+		/// </summary>
+		/// <param name="count"> The number of elements. </param>
+		/// <returns> The minimum capacity for the passed in number of elements. </returns>
+		std::size_t RequiredCapacity(std::size_t count) const;
+
+		/// <summary>
+		/// Probes the slot table for the given key.
+		/// </summary>
+		/// <param name="key"> The key which is to be searched for in the HashMap. </param>
+		/// <returns> The index of the slot referring to the key, or the capacity if the key does not exist. </returns>
+		std::size_t FindSlot(const TKey& key) const;
+
+		/// <summary>
+		/// Probes the slot table for a key using the given hash function and comparator.
+		/// </summary>
+		/// <param name="key"> The key which is to be searched for in the HashMap. </param>
+		/// <param name="lookupHash"> The hash function for the key. </param>
+		/// <param name="lookupComparator"> Function that compares a stored key with the passed in key. </param>
+		/// <returns> The index of the slot referring to the key, or the capacity if the key does not exist. </returns>
+		template <typename TLookup, typename LookupHash, typename LookupComparator>
+		std::size_t FindSlot(const TLookup& key, LookupHash& lookupHash, LookupComparator& lookupComparator) const;
+
+		/// <summary>
+		/// Removes the key-value pair a slot refers to, moving the last pair into its position.
+		/// </summary>
+		/// <param name="slot"> The index of the slot, or the capacity if there is nothing to remove. </param>
+		/// <returns> True if a pair was removed, false if not. </returns>
+		bool RemoveSlot(std::size_t slot);
+
+		/// <summary>
+		/// Places a slot into the table, displacing slots that are closer to their home index than it is.
+		/// There must be at least one empty slot in the table.
+		/// </summary>
+		/// <param name="slot"> The slot to be placed. Its Distance is recomputed. </param>
+		void PlaceSlot(Slot slot);
+
+		/// <summary>
+		/// Empties the given slot and shifts the slots after it back towards their home index.
 		/// </summary>
-		/// <param name="key"> The key to be hashed. </param>
-		/// <returns> The hashed index of the passed in key for a particular size of the HashMap. </returns>
-		size_t GetIndex(const TKey& key) const;
+		/// <param name="index"> The index of the slot to be emptied. </param>
+		void EraseSlot(std::size_t index);
 
-		Vector<ChainType> _vector{};
-		std::size_t _size{ 0 };
-		std::size_t _loadFactor{ 0 };
+		Vector<PairType> _entries{};
+		Vector<Slot> _slots{};
+		float _maxLoadFactor{ 0.75f };
 
 		HashFunctor _hashFunctor{ DefaultHash<TKey>{} };
 		KeyComparator _keyComparator{ DefaultEquality<TKey>{} };
@@ -1,45 +1,49 @@
 #include "HashMap.h"
+#include <cmath>
 
 namespace FieaGameEngine
 {
 	template <typename TKey, typename TValue>
 	HashMap<TKey, TValue>::HashMap(std::size_t capacity, HashFunctor hashFunctor, KeyComparator keyComparator)
-		: _vector { capacity }, _hashFunctor { hashFunctor }, _keyComparator { keyComparator }
+		: HashMap{ capacity, IAllocator::Default(), hashFunctor, keyComparator }
 	{
-		_vector.Reserve(capacity);
+	}
+
+	template <typename TKey, typename TValue>
+	HashMap<TKey, TValue>::HashMap(std::size_t capacity, IAllocator& allocator, HashFunctor hashFunctor, KeyComparator keyComparator)
+		: _entries{ allocator }, _slots{ allocator }, _hashFunctor { hashFunctor }, _keyComparator { keyComparator }
+	{
+		capacity = std::max(capacity, std::size_t(1));
+		_slots.Reserve(capacity);
 		for (size_t i = 0; i < capacity; ++i)
-			_vector.EmplaceBack();
+			_slots.EmplaceBack();
 	}
 
 	template <typename TKey, typename TValue>
 	HashMap<TKey, TValue>::HashMap(std::initializer_list<PairType> list, std::size_t capacity, HashFunctor hashFunctor, KeyComparator keyComparator)
-		: _hashFunctor{ hashFunctor }, _keyComparator { keyComparator }
+		: HashMap{ capacity, hashFunctor, keyComparator }
 	{
-		_vector.Reserve(capacity);
-		for (size_t i = 0; i < capacity; ++i)
-			_vector.EmplaceBack();
-		
 		for (const auto& value : list)
 			Insert(value);
 	}
 
 	template <typename TKey, typename TValue>
-	inline HashMap<TKey, TValue>::Iterator::Iterator(const HashMap& owner, const typename Vector<ChainType>::Iterator vecIt, const typename ChainType::Iterator listIt)
-		: _owner { &owner }, _vecIt { vecIt }, _listIt { listIt }
+	inline HashMap<TKey, TValue>::Iterator::Iterator(HashMap& owner, std::size_t index)
+		: _owner { &owner }, _index { index }
 	{
 
 	}
 
 	template <typename TKey, typename TValue>
-	inline HashMap<TKey, TValue>::ConstIterator::ConstIterator(const HashMap& owner, const typename Vector<ChainType>::ConstIterator vecIt, const typename ChainType::ConstIterator listIt)
-		: _owner{ &owner }, _vecIt{ vecIt }, _listIt{ listIt }
+	inline HashMap<TKey, TValue>::ConstIterator::ConstIterator(const HashMap& owner, std::size_t index)
+		: _owner{ &owner }, _index{ index }
 	{
 
 	}
 
 	template <typename TKey, typename TValue>
 	inline HashMap<TKey, TValue>::ConstIterator::ConstIterator(const Iterator& it)
-		: _owner{ it._owner }, _vecIt{ it._vecIt }, _listIt{ it._listIt }
+		: _owner{ it._owner }, _index{ it._index }
 	{
 
 	}
@@ -47,28 +51,50 @@ namespace FieaGameEngine
 	template <typename TKey, typename TValue>
 	inline std::size_t HashMap<TKey, TValue>::Capacity() const
 	{
-		return _vector.Capacity();
+		return _slots.Size();
 	}
 
 	template <typename TKey, typename TValue>
 	inline std::size_t HashMap<TKey, TValue>::Size() const
 	{
-		return _size;
+		return _entries.Size();
+	}
+
+	template <typename TKey, typename TValue>
+	inline IAllocator& HashMap<TKey, TValue>::GetAllocator() const
+	{
+		return _entries.GetAllocator();
+	}
+
+	template <typename TKey, typename TValue>
+	inline float HashMap<TKey, TValue>::LoadFactor() const
+	{
+		return _slots.IsEmpty() ? 0.0f : static_cast<float>(_entries.Size()) / static_cast<float>(_slots.Size());
+	}
+
+	template <typename TKey, typename TValue>
+	inline float HashMap<TKey, TValue>::MaxLoadFactor() const
+	{
+		return _maxLoadFactor;
 	}
 
 	template <typename TKey, typename TValue>
-	inline std::size_t HashMap<TKey, TValue>::LoadFactor() const
+	void HashMap<TKey, TValue>::SetMaxLoadFactor(float maxLoadFactor)
 	{
-		return _loadFactor;
+		if (maxLoadFactor <= 0.0f || maxLoadFactor > 1.0f)
+			throw std::runtime_error("Max load factor must be greater than zero and no more than one.");
+
+		_maxLoadFactor = maxLoadFactor;
+		if (RequiredCapacity(_entries.Size()) > _slots.Size())
+			Resize(RequiredCapacity(_entries.Size()));
 	}
 
 	template <typename TKey, typename TValue>
 	void HashMap<TKey, TValue>::Clear()
 	{
-		for (size_t i = 0; i < _vector.Size(); ++i)
-			_vector[i].Clear();
-		_size = 0;
-		_loadFactor = 0;
+		_entries.Clear();
+		for (size_t i = 0; i < _slots.Size(); ++i)
+			_slots[i] = Slot{};
 	}
 
 	template <typename TKey, typename TValue>
@@ -78,19 +104,21 @@ namespace FieaGameEngine
 		if (it != end())
 			return std::make_pair(it, false);
 
-		ChainType& list = _vector[GetIndex(pair.first)];
+		if (RequiredCapacity(_entries.Size() + 1) > _slots.Size())
+			Resize(std::max(_slots.Size() * 2, RequiredCapacity(_entries.Size() + 1)));
 
-		if (list.IsEmpty())
-			++_loadFactor;
-		++_size;
+		std::size_t entry = _entries.Size();
+		std::size_t hash = _hashFunctor(pair.first);
+		_entries.PushBack(pair);
+		PlaceSlot(Slot{ hash, entry });
 
-		return std::make_pair(Iterator{ *this, _vector.Find(list), list.EmplaceBack(std::move(pair)) }, true);
+		return std::make_pair(Iterator{ *this, entry }, true);
 	}
 
 	template <typename TKey, typename TValue>
 	bool HashMap<TKey, TValue>::ContainsKey(const TKey& key) const
 	{
-		return Find(key) != end();
+		return FindSlot(key) != _slots.Size();
 	}
 
 	template <typename TKey, typename TValue>
@@ -112,181 +140,291 @@ namespace FieaGameEngine
 	}
 
 	template <typename TKey, typename TValue>
-	TValue& HashMap<TKey, TValue>::operator[](const TKey& key)
+	template <typename TLookup, typename>
+	inline bool HashMap<TKey, TValue>::ContainsKey(const TLookup& key) const
 	{
-		if (!ContainsKey(key))
-			Insert(std::make_pair(key, TValue{}));
-		return At(key);
+		return Find(key) != end();
 	}
 
 	template <typename TKey, typename TValue>
-	typename HashMap<TKey, TValue>::Iterator HashMap<TKey, TValue>::Find(const TKey& key)
+	template <typename TLookup, typename>
+	TValue& HashMap<TKey, TValue>::At(const TLookup& key)
 	{
-		ChainType& list = _vector[GetIndex(key)];
+		Iterator it = Find(key);
+		if (it == end())
+			throw std::runtime_error("Key does not exist.");
+		return (*it).second;
+	}
 
-		typename ChainType::Iterator listIt = list.Find(std::make_pair(key, TValue{}), 
-			[&](const PairType& lhs, const PairType& rhs) { return _keyComparator(lhs.first, rhs.first); });
+	template <typename TKey, typename TValue>
+	template <typename TLookup, typename>
+	const TValue& HashMap<TKey, TValue>::At(const TLookup& key) const
+	{
+		ConstIterator it = Find(key);
+		if (it == end())
+			throw std::runtime_error("Key does not exist.");
+		return (*it).second;
+	}
 
-		typename Vector<ChainType>::Iterator vecIt;
-		if (listIt == list.end())
-		{
-			vecIt = _vector.end();
-			listIt = {};
-		}
-		else
-			vecIt = _vector.Find(list);
+	template <typename TKey, typename TValue>
+	TValue& HashMap<TKey, TValue>::operator[](const TKey& key)
+	{
+		Iterator it = Find(key);
+		if (it == end())
+			it = Insert(std::make_pair(key, TValue{})).first;
+		return (*it).second;
+	}
 
-		return Iterator{ *this, vecIt, listIt };
+	template <typename TKey, typename TValue>
+	typename HashMap<TKey, TValue>::Iterator HashMap<TKey, TValue>::Find(const TKey& key)
+	{
+		std::size_t slot = FindSlot(key);
+		return Iterator{ *this, slot == _slots.Size() ? _entries.Size() : _slots[slot].Entry };
 	}
 
 	template <typename TKey, typename TValue>
 	typename HashMap<TKey, TValue>::ConstIterator HashMap<TKey, TValue>::Find(const TKey& key) const
 	{
-		const ChainType& list = _vector[GetIndex(key)];
+		std::size_t slot = FindSlot(key);
+		return ConstIterator{ *this, slot == _slots.Size() ? _entries.Size() : _slots[slot].Entry };
+	}
 
-		typename ChainType::ConstIterator listIt = list.Find(std::make_pair(key, TValue{}),
-			[&](const PairType& lhs, const PairType& rhs) { return _keyComparator(lhs.first, rhs.first); });
-		
-		typename Vector<ChainType>::ConstIterator vecIt;
-		if (listIt == list.end())
-		{
-			vecIt = _vector.end();
-			listIt = {};
-		}
-		else
-			vecIt = _vector.Find(list);
+	template <typename TKey, typename TValue>
+	template <typename TLookup, typename LookupHash, typename LookupComparator, typename>
+	typename HashMap<TKey, TValue>::Iterator HashMap<TKey, TValue>::Find(const TLookup& key, LookupHash lookupHash, LookupComparator lookupComparator)
+	{
+		std::size_t slot = FindSlot(key, lookupHash, lookupComparator);
+		return Iterator{ *this, slot == _slots.Size() ? _entries.Size() : _slots[slot].Entry };
+	}
 
-		return ConstIterator{ *this, vecIt, listIt };
+	template <typename TKey, typename TValue>
+	template <typename TLookup, typename LookupHash, typename LookupComparator, typename>
+	typename HashMap<TKey, TValue>::ConstIterator HashMap<TKey, TValue>::Find(const TLookup& key, LookupHash lookupHash, LookupComparator lookupComparator) const
+	{
+		std::size_t slot = FindSlot(key, lookupHash, lookupComparator);
+		return ConstIterator{ *this, slot == _slots.Size() ? _entries.Size() : _slots[slot].Entry };
 	}
 
 	template <typename TKey, typename TValue>
 	bool HashMap<TKey, TValue>::Remove(const TKey& key)
 	{
-		Iterator it = Find(key);
-		if (it == end())
+		return RemoveSlot(FindSlot(key));
+	}
+
+	template <typename TKey, typename TValue>
+	template <typename TLookup, typename LookupHash, typename LookupComparator, typename>
+	bool HashMap<TKey, TValue>::Remove(const TLookup& key, LookupHash lookupHash, LookupComparator lookupComparator)
+	{
+		return RemoveSlot(FindSlot(key, lookupHash, lookupComparator));
+	}
+
+	template <typename TKey, typename TValue>
+	bool HashMap<TKey, TValue>::RemoveSlot(std::size_t slot)
+	{
+		if (slot == _slots.Size())
 			return false;
 
-		ChainType& list = *(it._vecIt);
-		list.Remove(*it);
+		std::size_t entry = _slots[slot].Entry;
+		std::size_t last = _entries.Size() - 1;
+		if (entry != last)
+		{
+			// The key is const, so the last pair cannot be move assigned into the hole. It is copied out first, while nothing has been
+			// touched yet, and then moved into the hole from the copy, which cannot throw, so the entries never hold a destroyed pair.
+			static_assert(std::is_nothrow_move_constructible_v<std::remove_const_t<TKey>> && std::is_nothrow_move_constructible_v<TValue>,
+				"HashMap::Remove requires keys and values that can be moved without throwing.");
+			std::pair<std::remove_const_t<TKey>, TValue> relocated{ _entries[last].first, std::move(_entries[last].second) };
+
+			EraseSlot(slot);
+			_slots[FindSlot(relocated.first)].Entry = entry;
+
+			PairType* vacated = &_entries[entry];
+			vacated->~PairType();
+			new (vacated) PairType(std::move(relocated.first), std::move(relocated.second));
+		}
+		else
+			EraseSlot(slot);
 
-		if (list.IsEmpty())
-			--_loadFactor;
-		--_size;
+		_entries.PopBack();
 		return true;
 	}
 
 	template <typename TKey, typename TValue>
 	void HashMap<TKey, TValue>::Resize(std::size_t newSize)
 	{
-		Vector<ChainType> newVector{ newSize };
-		for (size_t i = 0; i < newVector.Capacity(); ++i)
-			newVector.EmplaceBack();
+		newSize = std::max({ newSize, _entries.Size(), std::size_t(1) });
 
-		_loadFactor = 0;
-		Iterator it = begin();
-		while (it != end())
+		Vector<Slot> oldSlots{ std::move(_slots) };
+		_slots.Reserve(newSize);
+		for (size_t i = 0; i < newSize; ++i)
+			_slots.EmplaceBack();
+
+		for (size_t i = 0; i < oldSlots.Size(); ++i)
 		{
-			size_t hashCode = _hashFunctor((*it).first) % newVector.Capacity();
-			ChainType& list = newVector[hashCode];
-			
-			if (list.IsEmpty())
-				++_loadFactor;
-
-			list.PushBack(*it);
-			++it;
+			if (oldSlots[i].Distance != 0)
+				PlaceSlot(oldSlots[i]);
 		}
+	}
 
-		_vector = newVector;
+	template <typename TKey, typename TValue>
+	void HashMap<TKey, TValue>::Reserve(std::size_t count)
+	{
+		_entries.Reserve(count);
+		if (RequiredCapacity(count) > _slots.Size())
+			Resize(RequiredCapacity(count));
 	}
 
 	template<typename TKey, typename TValue>
-	size_t HashMap<TKey, TValue>::GetIndex(const TKey& key) const
+	inline std::size_t HashMap<TKey, TValue>::RequiredCapacity(std::size_t count) const
 	{
-		return _hashFunctor(key) % _vector.Size();
+		return static_cast<std::size_t>(std::ceil(count / _maxLoadFactor));
 	}
 
-	template <typename TKey, typename TValue>
-	typename HashMap<TKey, TValue>::Iterator HashMap<TKey, TValue>::begin()
+	template<typename TKey, typename TValue>
+	inline std::size_t HashMap<TKey, TValue>::GetIndex(std::size_t hash) const
 	{
-		if (_size == 0)
-			return end();
+		return hash % _slots.Size();
+	}
 
-		typename Vector<ChainType>::Iterator it = _vector.begin();
-		while ((*it).IsEmpty())
-			++it;
-		return Iterator{ *this, it, (*it).begin() };
+	template<typename TKey, typename TValue>
+	inline std::size_t HashMap<TKey, TValue>::FindSlot(const TKey& key) const
+	{
+		return FindSlot(key, _hashFunctor, _keyComparator);
 	}
 
-	template <typename TKey, typename TValue>
-	typename HashMap<TKey, TValue>::Iterator HashMap<TKey, TValue>::end()
+	template<typename TKey, typename TValue>
+	template<typename TLookup, typename LookupHash, typename LookupComparator>
+	std::size_t HashMap<TKey, TValue>::FindSlot(const TLookup& key, LookupHash& lookupHash, LookupComparator& lookupComparator) const
+	{
+		const std::size_t capacity = _slots.Size();
+		if (_entries.IsEmpty())
+			return capacity;
+
+		const std::size_t hash = lookupHash(key);
+		std::size_t index = GetIndex(hash);
+
+		for (std::size_t distance = 1; distance <= capacity; ++distance)
+		{
+			const Slot& slot = _slots[index];
+			if (slot.Distance < distance)
+				break;
+
+			if (slot.Hash == hash && lookupComparator(_entries[slot.Entry].first, key))
+				return index;
+
+			if (++index == capacity)
+				index = 0;
+		}
+
+		return capacity;
+	}
+
+	template<typename TKey, typename TValue>
+	void HashMap<TKey, TValue>::PlaceSlot(Slot slot)
+	{
+		const std::size_t capacity = _slots.Size();
+		std::size_t index = GetIndex(slot.Hash);
+		slot.Distance = 1;
+
+		while (true)
+		{
+			Slot& current = _slots[index];
+			if (current.Distance == 0)
+			{
+				current = slot;
+				return;
+			}
+
+			if (current.Distance < slot.Distance)
+				std::swap(current, slot);
+
+			++slot.Distance;
+			if (++index == capacity)
+				index = 0;
+		}
+	}
+
+	template<typename TKey, typename TValue>
+	void HashMap<TKey, TValue>::EraseSlot(std::size_t index)
 	{
-		return Iterator{ *this, _vector.end(), {} };
+		const std::size_t capacity = _slots.Size();
+		std::size_t next = index + 1 == capacity ? 0 : index + 1;
+
+		while (_slots[next].Distance > 1)
+		{
+			_slots[index] = _slots[next];
+			--_slots[index].Distance;
+
+			index = next;
+			if (++next == capacity)
+				next = 0;
+		}
+
+		_slots[index] = Slot{};
 	}
 
 	template <typename TKey, typename TValue>
-	typename HashMap<TKey, TValue>::ConstIterator HashMap<TKey, TValue>::begin() const
+	inline typename HashMap<TKey, TValue>::Iterator HashMap<TKey, TValue>::begin()
 	{
-		if (_size == 0)
-			return end();
+		return Iterator{ *this, 0 };
+	}
 
-		typename Vector<ChainType>::ConstIterator it = _vector.begin();
-		while ((*it).IsEmpty())
-			++it;
-		return ConstIterator{ *this, it, (*it).begin() };
+	template <typename TKey, typename TValue>
+	inline typename HashMap<TKey, TValue>::Iterator HashMap<TKey, TValue>::end()
+	{
+		return Iterator{ *this, _entries.Size() };
 	}
 
 	template <typename TKey, typename TValue>
-	typename HashMap<TKey, TValue>::ConstIterator HashMap<TKey, TValue>::end() const
+	inline typename HashMap<TKey, TValue>::ConstIterator HashMap<TKey, TValue>::begin() const
 	{
-		return ConstIterator{ *this, _vector.end(), {} };
+		return ConstIterator{ *this, 0 };
 	}
 
 	template <typename TKey, typename TValue>
-	typename HashMap<TKey, TValue>::ConstIterator HashMap<TKey, TValue>::cbegin()
+	inline typename HashMap<TKey, TValue>::ConstIterator HashMap<TKey, TValue>::end() const
 	{
-		if (_size == 0)
-			return cend();
+		return ConstIterator{ *this, _entries.Size() };
+	}
 
-		typename Vector<ChainType>::ConstIterator it = _vector.cbegin();
-		while ((*it).IsEmpty())
-			++it;
-		return ConstIterator{ *this, it, (*it).begin() };
+	template <typename TKey, typename TValue>
+	inline typename HashMap<TKey, TValue>::ConstIterator HashMap<TKey, TValue>::cbegin()
+	{
+		return ConstIterator{ *this, 0 };
 	}
 
 	template <typename TKey, typename TValue>
-	typename HashMap<TKey, TValue>::ConstIterator HashMap<TKey, TValue>::cend()
+	inline typename HashMap<TKey, TValue>::ConstIterator HashMap<TKey, TValue>::cend()
 	{
-		return ConstIterator{ *this, _vector.cend(), {} };
+		return ConstIterator{ *this, _entries.Size() };
 	}
 
 
 	template <typename TKey, typename TValue>
 	typename HashMap<TKey, TValue>::PairType& HashMap<TKey, TValue>::Iterator::operator*() const
 	{
-		return *_listIt;
+		if (_owner == nullptr)
+			throw std::runtime_error("Iterator does not belong to any container.");
+		if (_index >= _owner->_entries.Size())
+			throw std::runtime_error("Iterator does not point to a valid element.");
+
+		return _owner->_entries[_index];
 	}
 
 	template <typename TKey, typename TValue>
-	typename HashMap<TKey, TValue>::PairType* HashMap<TKey, TValue>::Iterator::operator->() const
+	inline typename HashMap<TKey, TValue>::PairType* HashMap<TKey, TValue>::Iterator::operator->() const
 	{
-		return &(*_listIt);
+		return &(operator*());
 	}
 
 	template <typename TKey, typename TValue>
 	typename HashMap<TKey, TValue>::Iterator& HashMap<TKey, TValue>::Iterator::operator++()
 	{
-		if (++_listIt == (*_vecIt).end())
-		{
-			while (typename Vector<ChainType>::ConstIterator{ ++_vecIt } != _owner->_vector.end())
-			{
-				if (!(*_vecIt).IsEmpty())
-				{
-					_listIt = (*_vecIt).begin();
-					return *this;
-				}
-			}
-			_listIt = {};
-		}
+		if (_owner == nullptr)
+			throw std::runtime_error("Iterator not associated with a container.");
+		if (_index >= _owner->_entries.Size())
+			throw std::out_of_range("Iterator cannot be incremented.");
+
+		++_index;
 		return *this;
 	}
 
@@ -301,7 +439,7 @@ namespace FieaGameEngine
 	template <typename TKey, typename TValue>
 	inline bool HashMap<TKey, TValue>::Iterator::operator!=(const Iterator& rhs) const
 	{
-		return _listIt != rhs._listIt || _vecIt != rhs._vecIt || _owner != rhs._owner;
+		return _index != rhs._index || _owner != rhs._owner;
 	}
 
 	template <typename TKey, typename TValue>
@@ -313,30 +451,29 @@ namespace FieaGameEngine
 	template <typename TKey, typename TValue>
 	const typename HashMap<TKey, TValue>::PairType& HashMap<TKey, TValue>::ConstIterator::operator*() const
 	{
-		return *_listIt;
+		if (_owner == nullptr)
+			throw std::runtime_error("Iterator does not belong to any container.");
+		if (_index >= _owner->_entries.Size())
+			throw std::runtime_error("Iterator does not point to a valid element.");
+
+		return _owner->_entries[_index];
 	}
 
 	template <typename TKey, typename TValue>
-	const typename HashMap<TKey, TValue>::PairType* HashMap<TKey, TValue>::ConstIterator::operator->() const
+	inline const typename HashMap<TKey, TValue>::PairType* HashMap<TKey, TValue>::ConstIterator::operator->() const
 	{
-		return &(*_listIt);
+		return &(operator*());
 	}
 
 	template <typename TKey, typename TValue>
 	typename HashMap<TKey, TValue>::ConstIterator& HashMap<TKey, TValue>::ConstIterator::operator++()
 	{
-		if (++_listIt == (*_vecIt).end())
-		{
-			while (++_vecIt!= _owner->_vector.end())
-			{
-				if (!(*_vecIt).IsEmpty())
-				{
-					_listIt = (*_vecIt).begin();
-					return *this;
-				}
-			}
-			_listIt = {};
-		}
+		if (_owner == nullptr)
+			throw std::runtime_error("Iterator not associated with a container.");
+		if (_index >= _owner->_entries.Size())
+			throw std::out_of_range("Iterator cannot be incremented.");
+
+		++_index;
 		return *this;
 	}
 
@@ -351,7 +488,7 @@ namespace FieaGameEngine
 	template <typename TKey, typename TValue>
 	inline bool HashMap<TKey, TValue>::ConstIterator::operator!=(const ConstIterator& rhs) const
 	{
-		return _listIt != rhs._listIt || _vecIt != rhs._vecIt || _owner != rhs._owner;
+		return _index != rhs._index || _owner != rhs._owner;
 	}
 
 	template <typename TKey, typename TValue>
@@ -359,4 +496,4 @@ namespace FieaGameEngine
 	{
 		return !operator!=(rhs);
 	}
-}
\ No newline at end of file
+}
@@ -0,0 +1,39 @@
+#pragma once
+#include "pch.h"
+#include "IAllocator.h"
+
+namespace FieaGameEngine
+{
+	namespace
+	{
+		class HeapAllocator final : public IAllocator
+		{
+		public:
+			void* Allocate(std::size_t size) override
+			{
+				return size == 0 ? nullptr : malloc(size);
+			}
+
+			void* Reallocate(void* block, std::size_t, std::size_t newSize) override
+			{
+				if (newSize == 0)
+				{
+					free(block);
+					return nullptr;
+				}
+				return realloc(block, newSize);
+			}
+
+			void Deallocate(void* block, std::size_t) override
+			{
+				free(block);
+			}
+		};
+	}
+
+	IAllocator& IAllocator::Default()
+	{
+		static HeapAllocator allocator;
+		return allocator;
+	}
+}
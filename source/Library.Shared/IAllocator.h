@@ -0,0 +1,53 @@
+#pragma once
+#include <cstddef>
+
+namespace FieaGameEngine
+{
+	/// <summary>
+	/// Interface for the memory sources used by the engine's containers. Blocks are aligned for any engine data type, and callers always hand back the size they asked for.
+	/// </summary>
+	class IAllocator
+	{
+	public:
+		/// <summary>
+		/// Alignment, in bytes, of every block handed out by an allocator.
+		/// </summary>
+		static constexpr std::size_t Alignment = 16;
+
+		IAllocator() = default;
+		IAllocator(const IAllocator& other) = default;
+		IAllocator& operator=(const IAllocator& rhs) = default;
+		IAllocator(IAllocator&& other) noexcept = default;
+		IAllocator& operator=(IAllocator&& rhs) noexcept = default;
+		virtual ~IAllocator() = default;
+
+		/// <summary>
+		/// Function to allocate a block of memory.
+		/// </summary>
+		/// <param name="size"> The size of the block in bytes. </param>
+		/// <returns> The new block, or nullptr if size is zero. </returns>
+		virtual void* Allocate(std::size_t size) = 0;
+
+		/// <summary>
+		/// Function to grow or shrink a block, keeping the leading bytes it shares with the new size. The block may move.
+		/// </summary>
+		/// <param name="block"> The block to be resized. May be nullptr, in which case a new block is allocated. </param>
+		/// <param name="size"> The size the block was allocated or last resized with. </param>
+		/// <param name="newSize"> The new size of the block in bytes. Zero releases the block. </param>
+		/// <returns> The resized block, or nullptr if newSize is zero. </returns>
+		virtual void* Reallocate(void* block, std::size_t size, std::size_t newSize) = 0;
+
+		/// <summary>
+		/// Function to release a block back to the allocator.
+		/// </summary>
+		/// <param name="block"> The block to be released. May be nullptr. </param>
+		/// <param name="size"> The size the block was allocated or last resized with. </param>
+		virtual void Deallocate(void* block, std::size_t size) = 0;
+
+		/// <summary>
+		/// Function to get the allocator used by containers that are not given one explicitly. It forwards to the C runtime heap.
+		/// </summary>
+		/// <returns> A reference to the default allocator, which lives for the rest of the program. </returns>
+		static IAllocator& Default();
+	};
+}
@@ -1,15 +1,6 @@
 #include "IEventPublisher.h"
-#include "IEventSubscriber.h"
-
-using namespace std;
 
 namespace FieaGameEngine
 {
 	RTTI_DEFINITIONS(IEventPublisher);
-
-	void IEventPublisher::Deliver()
-	{
-		for (auto subscriber : _subscribers)
-			subscriber->Notify(this);
-	}
 }
\ No newline at end of file
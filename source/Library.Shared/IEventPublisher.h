@@ -19,11 +19,8 @@ namespace FieaGameEngine
 		virtual ~IEventPublisher() = default;
 
 		/// <summary>
-		/// Calss notify on all instances subscribed to the event of this type.
+		/// Calls Notify on all instances subscribed to events of this type, and to the channel the event was published on.
 		/// </summary>
-		void Deliver();
-
-	protected:
-		inline static Vector<IEventSubscriber*> _subscribers{17};
+		virtual void Deliver() = 0;
 	};
 }
\ No newline at end of file
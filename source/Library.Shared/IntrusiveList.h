@@ -0,0 +1,214 @@
+#pragma once
+#include <cstddef>
+#include <iterator>
+
+namespace FieaGameEngine
+{
+	template <typename T, typename Tag>
+	class IntrusiveList;
+
+	/// <summary>
+	/// Links embedded in an object so that it can sit in an IntrusiveList without the list allocating anything.
+	/// An object joins one list per hook, so derive from IntrusiveListHook once per list with a distinct Tag for each.
+	/// Hooks unlink themselves when destroyed, and copying an object never copies its membership.
+	/// </summary>
+	/// <typeparam name="Tag"> Distinguishes several hooks on the same object. </typeparam>
+	template <typename Tag = void>
+	class IntrusiveListHook
+	{
+		template <typename, typename>
+		friend class IntrusiveList;
+
+	public:
+		IntrusiveListHook() = default;
+		IntrusiveListHook(const IntrusiveListHook&);
+		IntrusiveListHook& operator=(const IntrusiveListHook&);
+		~IntrusiveListHook();
+
+		/// <summary>
+		/// Function to check if the object is in a list.
+		/// </summary>
+		/// <returns> True if the hook is linked into a list, false otherwise. </returns>
+		bool IsLinked() const;
+
+		/// <summary>
+		/// Function to take the object out of whichever list it is in, in constant time. Does nothing if the hook is not linked.
+		/// </summary>
+		void Unlink();
+
+	private:
+		/// <summary>
+		/// Function to link the hook in front of another hook.
+		/// </summary>
+		/// <param name="position"> The hook "this" hook is to be placed in front of. </param>
+		void LinkBefore(IntrusiveListHook& position);
+
+		IntrusiveListHook* _previous{ nullptr };
+		IntrusiveListHook* _next{ nullptr };
+	};
+
+	/// <summary>
+	/// Doubly linked list over objects that carry their own links. The list never owns, copies or allocates; objects must outlive
+	/// their membership, which their hooks guarantee by unlinking on destruction. Insertion and removal are constant time.
+	/// </summary>
+	/// <typeparam name="T"> The type of the elements, which must derive from IntrusiveListHook&lt;Tag&gt;. </typeparam>
+	/// <typeparam name="Tag"> Selects which of T's hooks this list uses. </typeparam>
+	template <typename T, typename Tag = void>
+	class IntrusiveList final
+	{
+		using Hook = IntrusiveListHook<Tag>;
+
+	public:
+		/// <summary>
+		/// Bidirectional iterator over the elements of an IntrusiveList. Unlinking the element an Iterator points at invalidates it.
+		/// Dereferencing end() throws, since the root hook it points at is not part of any element.
+		/// </summary>
+		template <typename TValue>
+		class IteratorType final
+		{
+			friend IntrusiveList;
+
+		public:
+			using iterator_category = std::bidirectional_iterator_tag;
+			using difference_type = std::ptrdiff_t;
+			using value_type = T;
+			using pointer = TValue*;
+			using reference = TValue&;
+
+			IteratorType() = default;
+
+			/// <summary>
+			/// Type-cast constructor that lets an Iterator be used where a ConstIterator is expected.
+			/// </summary>
+			template <typename TOther, typename = std::enable_if_t<std::is_const_v<TValue> && !std::is_const_v<TOther>>>
+			IteratorType(const IteratorType<TOther>& other) : _hook{ other._hook }, _root{ other._root } {}
+
+			reference operator*() const;
+			pointer operator->() const;
+			IteratorType& operator++();
+			IteratorType operator++(int);
+			IteratorType& operator--();
+			IteratorType operator--(int);
+			bool operator==(const IteratorType& rhs) const;
+			bool operator!=(const IteratorType& rhs) const;
+
+		private:
+			template <typename>
+			friend class IteratorType;
+
+			IteratorType(const Hook* hook, const Hook* root);
+
+			const Hook* _hook{ nullptr };
+
+			/// <summary>
+			/// The root hook of the list, which end() points at and which has no element around it.
+			/// </summary>
+			const Hook* _root{ nullptr };
+		};
+
+		using Iterator = IteratorType<T>;
+		using ConstIterator = IteratorType<const T>;
+
+		/// <summary>
+		/// Default constructor for IntrusiveList. Creates an empty list.
+		/// </summary>
+		IntrusiveList();
+
+		/// <summary>
+		/// Move constructor for IntrusiveList. The elements are relinked into "this" list, leaving the other one empty.
+		/// </summary>
+		IntrusiveList(IntrusiveList&& other) noexcept;
+
+		/// <summary>
+		/// Move assignment operator for IntrusiveList. The current elements are unlinked first.
+		/// </summary>
+		IntrusiveList& operator=(IntrusiveList&& rhs) noexcept;
+
+		IntrusiveList(const IntrusiveList&) = delete;
+		IntrusiveList& operator=(const IntrusiveList&) = delete;
+
+		/// <summary>
+		/// Destructor for IntrusiveList, which unlinks every element.
+		/// </summary>
+		~IntrusiveList();
+
+		/// <summary>
+		/// Function to link an element at the front of the list. An element that is already in a list is moved out of it first.
+		/// </summary>
+		/// <param name="value"> The element to be linked. </param>
+		void PushFront(T& value);
+
+		/// <summary>
+		/// Function to link an element at the back of the list. An element that is already in a list is moved out of it first.
+		/// </summary>
+		/// <param name="value"> The element to be linked. </param>
+		void PushBack(T& value);
+
+		/// <summary>
+		/// Function to link an element in front of the element an Iterator points to.
+		/// </summary>
+		/// <param name="position"> The element to insert in front of, or end() to insert at the back. </param>
+		/// <param name="value"> The element to be linked. </param>
+		/// <returns> An Iterator to the inserted element. </returns>
+		Iterator Insert(ConstIterator position, T& value);
+
+		/// <summary>
+		/// Function to unlink the element at the front of the list.
+		/// </summary>
+		/// <exception cref="runtime_error"> Throws if the list is empty. </exception>
+		void PopFront();
+
+		/// <summary>
+		/// Function to unlink the element at the back of the list.
+		/// </summary>
+		/// <exception cref="runtime_error"> Throws if the list is empty. </exception>
+		void PopBack();
+
+		/// <summary>
+		/// Function to unlink an element, which must be in this list.
+		/// </summary>
+		/// <param name="value"> The element to be unlinked. </param>
+		/// <returns> An Iterator to the element that followed the unlinked one. </returns>
+		Iterator Remove(T& value);
+
+		/// <summary>
+		/// Function to unlink every element.
+		/// </summary>
+		void Clear();
+
+		[[nodiscard]] T& Front();
+		[[nodiscard]] const T& Front() const;
+		[[nodiscard]] T& Back();
+		[[nodiscard]] const T& Back() const;
+
+		/// <summary>
+		/// Function to check if the list is empty. Runs in constant time.
+		/// </summary>
+		/// <returns> True if the list has no elements, false otherwise. </returns>
+		bool IsEmpty() const;
+
+		/// <summary>
+		/// Function to count the elements. Elements can leave the list by unlinking themselves, so the count is not cached and this walks the list.
+		/// </summary>
+		/// <returns> The number of elements in the list. </returns>
+		std::size_t Size() const;
+
+		Iterator begin();
+		ConstIterator begin() const;
+		ConstIterator cbegin() const;
+		Iterator end();
+		ConstIterator end() const;
+		ConstIterator cend() const;
+
+	private:
+		static T& ToValue(Hook& hook);
+		static const T& ToValue(const Hook& hook);
+
+		/// <summary>
+		/// Sentinel that closes the ring; its next hook is the front of the list and its previous hook the back.
+		/// </summary>
+		Hook _root;
+	};
+}
+
+#include "IntrusiveList.inl"
@@ -0,0 +1,327 @@
+#include "IntrusiveList.h"
+#include <cassert>
+#include <stdexcept>
+#include <type_traits>
+
+namespace FieaGameEngine
+{
+	template <typename Tag>
+	inline IntrusiveListHook<Tag>::IntrusiveListHook(const IntrusiveListHook&)
+	{
+	}
+
+	template <typename Tag>
+	inline IntrusiveListHook<Tag>& IntrusiveListHook<Tag>::operator=(const IntrusiveListHook&)
+	{
+		return *this;
+	}
+
+	template <typename Tag>
+	inline IntrusiveListHook<Tag>::~IntrusiveListHook()
+	{
+		Unlink();
+	}
+
+	template <typename Tag>
+	inline bool IntrusiveListHook<Tag>::IsLinked() const
+	{
+		return _next != nullptr;
+	}
+
+	template <typename Tag>
+	inline void IntrusiveListHook<Tag>::Unlink()
+	{
+		if (!IsLinked())
+			return;
+
+		_previous->_next = _next;
+		_next->_previous = _previous;
+		_previous = nullptr;
+		_next = nullptr;
+	}
+
+	template <typename Tag>
+	inline void IntrusiveListHook<Tag>::LinkBefore(IntrusiveListHook& position)
+	{
+		Unlink();
+		_previous = position._previous;
+		_next = &position;
+		_previous->_next = this;
+		position._previous = this;
+	}
+
+	template <typename T, typename Tag>
+	template <typename TValue>
+	inline IntrusiveList<T, Tag>::IteratorType<TValue>::IteratorType(const Hook* hook, const Hook* root)
+		: _hook{ hook }, _root{ root }
+	{
+	}
+
+	template <typename T, typename Tag>
+	template <typename TValue>
+	inline typename IntrusiveList<T, Tag>::template IteratorType<TValue>::reference IntrusiveList<T, Tag>::IteratorType<TValue>::operator*() const
+	{
+		if (_hook == nullptr)
+			throw std::runtime_error("Iterator does not belong to any container.");
+		if (_hook == _root)
+			throw std::runtime_error("Iterator does not point to valid item.");
+
+		return const_cast<TValue&>(ToValue(*_hook));
+	}
+
+	template <typename T, typename Tag>
+	template <typename TValue>
+	inline typename IntrusiveList<T, Tag>::template IteratorType<TValue>::pointer IntrusiveList<T, Tag>::IteratorType<TValue>::operator->() const
+	{
+		return &operator*();
+	}
+
+	template <typename T, typename Tag>
+	template <typename TValue>
+	inline typename IntrusiveList<T, Tag>::template IteratorType<TValue>& IntrusiveList<T, Tag>::IteratorType<TValue>::operator++()
+	{
+		if (_hook == nullptr)
+			throw std::runtime_error("Iterator does not belong to any container.");
+
+		_hook = _hook->_next;
+		return *this;
+	}
+
+	template <typename T, typename Tag>
+	template <typename TValue>
+	inline typename IntrusiveList<T, Tag>::template IteratorType<TValue> IntrusiveList<T, Tag>::IteratorType<TValue>::operator++(int)
+	{
+		IteratorType it = *this;
+		++(*this);
+		return it;
+	}
+
+	template <typename T, typename Tag>
+	template <typename TValue>
+	inline typename IntrusiveList<T, Tag>::template IteratorType<TValue>& IntrusiveList<T, Tag>::IteratorType<TValue>::operator--()
+	{
+		if (_hook == nullptr)
+			throw std::runtime_error("Iterator does not belong to any container.");
+
+		_hook = _hook->_previous;
+		return *this;
+	}
+
+	template <typename T, typename Tag>
+	template <typename TValue>
+	inline typename IntrusiveList<T, Tag>::template IteratorType<TValue> IntrusiveList<T, Tag>::IteratorType<TValue>::operator--(int)
+	{
+		IteratorType it = *this;
+		--(*this);
+		return it;
+	}
+
+	template <typename T, typename Tag>
+	template <typename TValue>
+	inline bool IntrusiveList<T, Tag>::IteratorType<TValue>::operator==(const IteratorType& rhs) const
+	{
+		return _hook == rhs._hook;
+	}
+
+	template <typename T, typename Tag>
+	template <typename TValue>
+	inline bool IntrusiveList<T, Tag>::IteratorType<TValue>::operator!=(const IteratorType& rhs) const
+	{
+		return _hook != rhs._hook;
+	}
+
+	template <typename T, typename Tag>
+	IntrusiveList<T, Tag>::IntrusiveList()
+	{
+		static_assert(std::is_base_of_v<Hook, T>, "IntrusiveList elements must derive from the IntrusiveListHook for the list's Tag.");
+		_root._previous = &_root;
+		_root._next = &_root;
+	}
+
+	template <typename T, typename Tag>
+	IntrusiveList<T, Tag>::IntrusiveList(IntrusiveList&& other) noexcept
+		: IntrusiveList()
+	{
+		operator=(std::move(other));
+	}
+
+	template <typename T, typename Tag>
+	IntrusiveList<T, Tag>& IntrusiveList<T, Tag>::operator=(IntrusiveList&& rhs) noexcept
+	{
+		if (this != &rhs)
+		{
+			Clear();
+			if (!rhs.IsEmpty())
+			{
+				_root._next = rhs._root._next;
+				_root._previous = rhs._root._previous;
+				_root._next->_previous = &_root;
+				_root._previous->_next = &_root;
+				rhs._root._next = &rhs._root;
+				rhs._root._previous = &rhs._root;
+			}
+		}
+		return *this;
+	}
+
+	template <typename T, typename Tag>
+	IntrusiveList<T, Tag>::~IntrusiveList()
+	{
+		Clear();
+	}
+
+	template <typename T, typename Tag>
+	inline void IntrusiveList<T, Tag>::PushFront(T& value)
+	{
+		static_cast<Hook&>(value).LinkBefore(*_root._next);
+	}
+
+	template <typename T, typename Tag>
+	inline void IntrusiveList<T, Tag>::PushBack(T& value)
+	{
+		static_cast<Hook&>(value).LinkBefore(_root);
+	}
+
+	template <typename T, typename Tag>
+	typename IntrusiveList<T, Tag>::Iterator IntrusiveList<T, Tag>::Insert(ConstIterator position, T& value)
+	{
+		assert(position._hook != nullptr);
+		Hook& hook = static_cast<Hook&>(value);
+		hook.LinkBefore(*const_cast<Hook*>(position._hook));
+		return Iterator{ &hook, &_root };
+	}
+
+	template <typename T, typename Tag>
+	void IntrusiveList<T, Tag>::PopFront()
+	{
+		if (IsEmpty())
+			throw std::runtime_error("List is empty");
+
+		_root._next->Unlink();
+	}
+
+	template <typename T, typename Tag>
+	void IntrusiveList<T, Tag>::PopBack()
+	{
+		if (IsEmpty())
+			throw std::runtime_error("List is empty");
+
+		_root._previous->Unlink();
+	}
+
+	template <typename T, typename Tag>
+	typename IntrusiveList<T, Tag>::Iterator IntrusiveList<T, Tag>::Remove(T& value)
+	{
+		Hook& hook = static_cast<Hook&>(value);
+		assert(hook.IsLinked());
+		Hook* next = hook._next;
+		hook.Unlink();
+		return Iterator{ next, &_root };
+	}
+
+	template <typename T, typename Tag>
+	void IntrusiveList<T, Tag>::Clear()
+	{
+		while (!IsEmpty())
+			_root._next->Unlink();
+	}
+
+	template <typename T, typename Tag>
+	inline T& IntrusiveList<T, Tag>::Front()
+	{
+		if (IsEmpty())
+			throw std::runtime_error("List is empty");
+
+		return ToValue(*_root._next);
+	}
+
+	template <typename T, typename Tag>
+	inline const T& IntrusiveList<T, Tag>::Front() const
+	{
+		if (IsEmpty())
+			throw std::runtime_error("List is empty");
+
+		return ToValue(*_root._next);
+	}
+
+	template <typename T, typename Tag>
+	inline T& IntrusiveList<T, Tag>::Back()
+	{
+		if (IsEmpty())
+			throw std::runtime_error("List is empty");
+
+		return ToValue(*_root._previous);
+	}
+
+	template <typename T, typename Tag>
+	inline const T& IntrusiveList<T, Tag>::Back() const
+	{
+		if (IsEmpty())
+			throw std::runtime_error("List is empty");
+
+		return ToValue(*_root._previous);
+	}
+
+	template <typename T, typename Tag>
+	inline bool IntrusiveList<T, Tag>::IsEmpty() const
+	{
+		return _root._next == &_root;
+	}
+
+	template <typename T, typename Tag>
+	std::size_t IntrusiveList<T, Tag>::Size() const
+	{
+		std::size_t size = 0;
+		for (const Hook* hook = _root._next; hook != &_root; hook = hook->_next)
+			++size;
+		return size;
+	}
+
+	template <typename T, typename Tag>
+	inline typename IntrusiveList<T, Tag>::Iterator IntrusiveList<T, Tag>::begin()
+	{
+		return Iterator{ _root._next, &_root };
+	}
+
+	template <typename T, typename Tag>
+	inline typename IntrusiveList<T, Tag>::ConstIterator IntrusiveList<T, Tag>::begin() const
+	{
+		return ConstIterator{ _root._next, &_root };
+	}
+
+	template <typename T, typename Tag>
+	inline typename IntrusiveList<T, Tag>::ConstIterator IntrusiveList<T, Tag>::cbegin() const
+	{
+		return ConstIterator{ _root._next, &_root };
+	}
+
+	template <typename T, typename Tag>
+	inline typename IntrusiveList<T, Tag>::Iterator IntrusiveList<T, Tag>::end()
+	{
+		return Iterator{ &_root, &_root };
+	}
+
+	template <typename T, typename Tag>
+	inline typename IntrusiveList<T, Tag>::ConstIterator IntrusiveList<T, Tag>::end() const
+	{
+		return ConstIterator{ &_root, &_root };
+	}
+
+	template <typename T, typename Tag>
+	inline typename IntrusiveList<T, Tag>::ConstIterator IntrusiveList<T, Tag>::cend() const
+	{
+		return ConstIterator{ &_root, &_root };
+	}
+
+	template <typename T, typename Tag>
+	inline T& IntrusiveList<T, Tag>::ToValue(Hook& hook)
+	{
+		return static_cast<T&>(hook);
+	}
+
+	template <typename T, typename Tag>
+	inline const T& IntrusiveList<T, Tag>::ToValue(const Hook& hook)
+	{
+		return static_cast<const T&>(hook);
+	}
+}
@@ -0,0 +1,19 @@
+#pragma once
+#include <type_traits>
+#include <utility>
+
+namespace FieaGameEngine
+{
+	/// <summary>
+	/// Trait that says whether an object can be moved to a new address with a plain memcpy, leaving nothing behind to destroy.
+	/// Containers relocate such types in bulk and move construct everything else. Specialize it for types that hold no pointers into themselves.
+	/// </summary>
+	template <typename T>
+	struct IsTriviallyRelocatable : std::is_trivially_copyable<T> {};
+
+	template <typename T>
+	struct IsTriviallyRelocatable<const T> : IsTriviallyRelocatable<T> {};
+
+	template <typename TFirst, typename TSecond>
+	struct IsTriviallyRelocatable<std::pair<TFirst, TSecond>> : std::conjunction<IsTriviallyRelocatable<TFirst>, IsTriviallyRelocatable<TSecond>> {};
+}
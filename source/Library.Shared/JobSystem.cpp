@@ -0,0 +1,164 @@
+#include "pch.h"
+#include "JobSystem.h"
+
+using namespace std;
+
+namespace FieaGameEngine
+{
+	namespace
+	{
+		/// <summary>
+		/// The pool the calling thread works for, if any, and the index of its queue in that pool.
+		/// </summary>
+		thread_local const JobSystem* CurrentJobSystem{ nullptr };
+		thread_local size_t CurrentQueue{ 0 };
+	}
+
+	bool JobSystem::Counter::IsDone() const
+	{
+		return _pending.load(memory_order_acquire) == 0;
+	}
+
+	JobSystem::JobSystem(size_t workerCount)
+	{
+		_queues.Reserve(workerCount + 1);
+		for (size_t i = 0; i < workerCount + 1; ++i)
+			_queues.EmplaceBack(make_unique<WorkQueue>());
+
+		_workers.Reserve(workerCount);
+		for (size_t i = 0; i < workerCount; ++i)
+			_workers.EmplaceBack(&JobSystem::WorkerLoop, this, i + 1);
+	}
+
+	JobSystem::~JobSystem()
+	{
+		{
+			lock_guard<mutex> lock{ _sleepMutex };
+			_stopping = true;
+		}
+		_wake.notify_all();
+
+		for (thread& worker : _workers)
+			worker.join();
+	}
+
+	void JobSystem::Schedule(Job job, Counter& counter)
+	{
+		counter._pending.fetch_add(1, memory_order_relaxed);
+
+		WorkQueue& queue = *_queues[CurrentQueueIndex()];
+		{
+			lock_guard<mutex> lock{ queue.Mutex };
+			queue.Tasks.push_back(Task{ std::move(job), &counter });
+		}
+
+		_queuedTasks.fetch_add(1, memory_order_release);
+		{
+			lock_guard<mutex> lock{ _sleepMutex };
+		}
+		_wake.notify_one();
+	}
+
+	void JobSystem::Wait(Counter& counter)
+	{
+		const size_t queueIndex = CurrentQueueIndex();
+		while (!counter.IsDone())
+		{
+			if (!TryRunOne(queueIndex))
+				this_thread::yield();
+		}
+
+		if (counter._exception != nullptr)
+		{
+			exception_ptr exception = counter._exception;
+			counter._exception = nullptr;
+			rethrow_exception(exception);
+		}
+	}
+
+	size_t JobSystem::WorkerCount() const
+	{
+		return _workers.Size();
+	}
+
+	size_t JobSystem::DefaultWorkerCount()
+	{
+		const size_t hardwareThreads = thread::hardware_concurrency();
+		return hardwareThreads > 0 ? hardwareThreads - 1 : 0;
+	}
+
+	void JobSystem::WorkerLoop(size_t queueIndex)
+	{
+		CurrentJobSystem = this;
+		CurrentQueue = queueIndex;
+
+		while (true)
+		{
+			if (TryRunOne(queueIndex))
+				continue;
+
+			unique_lock<mutex> lock{ _sleepMutex };
+			_wake.wait(lock, [this]() { return _stopping || _queuedTasks.load(memory_order_acquire) > 0; });
+			if (_stopping && _queuedTasks.load(memory_order_acquire) == 0)
+				return;
+		}
+	}
+
+	bool JobSystem::TryRunOne(size_t queueIndex)
+	{
+		Task task;
+		bool found = false;
+
+		{
+			WorkQueue& own = *_queues[queueIndex];
+			lock_guard<mutex> lock{ own.Mutex };
+			if (!own.Tasks.empty())
+			{
+				task = std::move(own.Tasks.back());
+				own.Tasks.pop_back();
+				found = true;
+			}
+		}
+
+		for (size_t i = 1; !found && i < _queues.Size(); ++i)
+		{
+			WorkQueue& victim = *_queues[(queueIndex + i) % _queues.Size()];
+			lock_guard<mutex> lock{ victim.Mutex };
+			if (!victim.Tasks.empty())
+			{
+				task = std::move(victim.Tasks.front());
+				victim.Tasks.pop_front();
+				found = true;
+			}
+		}
+
+		if (!found)
+			return false;
+
+		_queuedTasks.fetch_sub(1, memory_order_relaxed);
+		Run(task);
+		return true;
+	}
+
+	size_t JobSystem::CurrentQueueIndex() const
+	{
+		return CurrentJobSystem == this ? CurrentQueue : 0;
+	}
+
+	void JobSystem::Run(Task& task)
+	{
+		try
+		{
+			task.Work();
+		}
+		catch (...)
+		{
+			lock_guard<mutex> lock{ task.Owner->_exceptionMutex };
+			if (task.Owner->_exception == nullptr)
+				task.Owner->_exception = current_exception();
+		}
+
+		// The waiting thread may destroy the Counter as soon as this lands, so it is the last thing touched.
+		task.Owner->_pending.fetch_sub(1, memory_order_acq_rel);
+	}
+}
@@ -0,0 +1,138 @@
+#pragma once
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include "Vector.h"
+
+namespace FieaGameEngine
+{
+	/// <summary>
+	/// Work-stealing thread pool. Every worker owns a queue that it pops from the back, so it keeps working on the jobs it
+	/// scheduled most recently; idle workers steal from the front of the other queues. Threads outside the pool share one extra queue.
+	/// Waiting on a Counter runs queued jobs instead of blocking, so jobs can schedule and wait on jobs of their own without deadlocking.
+	/// </summary>
+	class JobSystem final
+	{
+	public:
+		using Job = std::function<void()>;
+
+		/// <summary>
+		/// Tracks a batch of jobs so that they can be joined with Wait. The first exception thrown by a job in the batch is kept and rethrown by Wait.
+		/// A Counter must outlive the jobs scheduled against it, which Wait guarantees.
+		/// </summary>
+		class Counter final
+		{
+			friend JobSystem;
+
+		public:
+			Counter() = default;
+			Counter(const Counter&) = delete;
+			Counter(Counter&&) = delete;
+			Counter& operator=(const Counter&) = delete;
+			Counter& operator=(Counter&&) = delete;
+			~Counter() = default;
+
+			/// <summary>
+			/// Function to check if every job scheduled against the Counter has finished.
+			/// </summary>
+			/// <returns> True if no jobs are outstanding, false otherwise. </returns>
+			bool IsDone() const;
+
+		private:
+			std::atomic<std::size_t> _pending{ 0 };
+			std::mutex _exceptionMutex;
+			std::exception_ptr _exception;
+		};
+
+		/// <summary>
+		/// Constructor for JobSystem which starts the worker threads.
+		/// </summary>
+		/// <param name="workerCount"> The number of worker threads. With none, jobs run on whichever thread waits for them. </param>
+		explicit JobSystem(std::size_t workerCount = DefaultWorkerCount());
+
+		JobSystem(const JobSystem&) = delete;
+		JobSystem(JobSystem&&) = delete;
+		JobSystem& operator=(const JobSystem&) = delete;
+		JobSystem& operator=(JobSystem&&) = delete;
+
+		/// <summary>
+		/// Destructor for JobSystem, which lets the workers drain their queues and joins them.
+		/// </summary>
+		~JobSystem();
+
+		/// <summary>
+		/// Function to queue a job. The job goes to the calling worker's own queue, or to the shared queue if called from outside the pool.
+		/// </summary>
+		/// <param name="job"> The job to be run. </param>
+		/// <param name="counter"> The Counter the job is counted against until it finishes. </param>
+		void Schedule(Job job, Counter& counter);
+
+		/// <summary>
+		/// Function to wait until every job scheduled against a Counter has finished, running queued jobs on the calling thread in the meantime.
+		/// </summary>
+		/// <param name="counter"> The Counter to wait on. </param>
+		/// <exception cref="exception"> Rethrows the first exception thrown by a job scheduled against the Counter. </exception>
+		void Wait(Counter& counter);
+
+		/// <summary>
+		/// Function to get the number of worker threads.
+		/// </summary>
+		/// <returns> The number of worker threads. </returns>
+		std::size_t WorkerCount() const;
+
+		/// <summary>
+		/// Function to get the default number of worker threads, which leaves one hardware thread for the thread that schedules work.
+		/// </summary>
+		/// <returns> One less than the number of hardware threads, or zero if that is unknown. </returns>
+		static std::size_t DefaultWorkerCount();
+
+	private:
+		struct Task final
+		{
+			Job Work;
+			Counter* Owner{ nullptr };
+		};
+
+		struct WorkQueue final
+		{
+			std::mutex Mutex;
+			std::deque<Task> Tasks;
+		};
+
+		/// <summary>
+		/// Worker thread body: runs jobs until the pool is stopping and nothing is left, sleeping while there is no work.
+		/// </summary>
+		void WorkerLoop(std::size_t queueIndex);
+
+		/// <summary>
+		/// Pops a job from the given queue, or steals one from another queue, and runs it.
+		/// </summary>
+		/// <returns> True if a job was run, false if every queue was empty. </returns>
+		bool TryRunOne(std::size_t queueIndex);
+
+		/// <summary>
+		/// Gets the index of the queue belonging to the calling thread.
+		/// </summary>
+		std::size_t CurrentQueueIndex() const;
+
+		/// <summary>
+		/// Runs a job and counts it as finished against its Counter.
+		/// </summary>
+		static void Run(Task& task);
+
+		/// <summary>
+		/// Queue 0 is shared by threads outside the pool; queue i + 1 belongs to worker i.
+		/// </summary>
+		Vector<std::unique_ptr<WorkQueue>> _queues;
+		Vector<std::thread> _workers;
+		std::atomic<std::size_t> _queuedTasks{ 0 };
+		std::atomic<bool> _stopping{ false };
+		std::mutex _sleepMutex;
+		std::condition_variable _wake;
+	};
+}
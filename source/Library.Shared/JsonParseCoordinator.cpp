@@ -12,13 +12,13 @@ namespace FieaGameEngine
 {
 	RTTI_DEFINITIONS(JsonParseCoordinator::Wrapper);
 
-	JsonParseCoordinator::JsonParseCoordinator(shared_ptr<Wrapper> wrapper)
-		: _wrapper{ move(wrapper)}
+	JsonParseCoordinator::JsonParseCoordinator(shared_ptr<Wrapper> wrapper, IAllocator& allocator)
+		: _wrapper{ move(wrapper)}, _allocator{ &allocator }
 	{
 	}
 
 	JsonParseCoordinator::JsonParseCoordinator(JsonParseCoordinator&& other) noexcept
-		: _helpers { move(other._helpers) }, _wrapper{ move(other._wrapper) }
+		: _helpers { move(other._helpers) }, _wrapper{ move(other._wrapper) }, _allocator{ other._allocator }
 	{
 	}
 
@@ -28,13 +28,14 @@ namespace FieaGameEngine
 		{
 			_helpers = move(rhs._helpers);
 			_wrapper = move(rhs._wrapper);
+			_allocator = rhs._allocator;
 		}
 		return *this;
 	}
 
 	gsl::owner<JsonParseCoordinator*> JsonParseCoordinator::Clone() const
 	{
-		JsonParseCoordinator* newParser = new JsonParseCoordinator{ _wrapper->Create() };
+		JsonParseCoordinator* newParser = new JsonParseCoordinator{ _wrapper->Create(), *_allocator };
 		for (auto& helper : _helpers)
 			newParser->AddHelper(helper->Create());
 
@@ -70,10 +71,21 @@ namespace FieaGameEngine
 		_wrapper = wrapper;
 	}
 
+	IAllocator& JsonParseCoordinator::GetAllocator() const
+	{
+		return *_allocator;
+	}
+
+	void JsonParseCoordinator::SetAllocator(IAllocator& allocator)
+	{
+		_allocator = &allocator;
+	}
+
 	void JsonParseCoordinator::DeserializeObject(istream& stream)
 	{
 		Json::Value jsonValue;
 		stream >> jsonValue;
+		_wrapper->_allocator = _allocator;
 		ParseMembers(jsonValue);
 		for (auto& helper : _helpers)
 		{
@@ -171,4 +183,9 @@ namespace FieaGameEngine
 	{
 		return _nestingDepth; 
 	}
+
+	IAllocator& JsonParseCoordinator::Wrapper::GetAllocator() const
+	{
+		return *_allocator;
+	}
 }
\ No newline at end of file
@@ -1,6 +1,7 @@
 #pragma once
 #include "RTTI.h"
 #include "Vector.h"
+#include "IAllocator.h"
 #include <iostream>
 #include <json/json.h>
 #include <gsl/gsl>
@@ -38,6 +39,12 @@ namespace FieaGameEngine
 			/// <returns> The current nesting depth of the Wrapper. </returns>
 			std::uint32_t Depth() const;
 
+			/// <summary>
+			/// Function to get the allocator that data loaded into the Wrapper should take its memory from. It is set by the ParseCoordinator before each parse.
+			/// </summary>
+			/// <returns> A reference to the allocator. </returns>
+			IAllocator& GetAllocator() const;
+
 		protected:
 			/// <summary>
 			/// Function to increment the nesting depth of the Wrapper.
@@ -50,13 +57,18 @@ namespace FieaGameEngine
 			void DecrementDepth();
 
 			std::uint32_t _nestingDepth{ 0 };
+
+			IAllocator* _allocator{ &IAllocator::Default() };
 		};
 
 		/// <summary>
 		/// Constructor to construct a ParseCoordinator object by passing in a shared_ptr to a Wrapper.
 		/// </summary>
 		/// <param name="wrapper"> shared_ptr to a Wrapper. </param>
-		explicit JsonParseCoordinator(std::shared_ptr<Wrapper> wrapper);
+		/// <param name="allocator"> The allocator that parsed data takes its memory from. Passing an arena keeps a document's Scopes and Datum buffers together,
+		/// so that unloading it frees nothing piecemeal. Unloading still runs the destructors of the tree, and std::string keys and values longer than
+		/// the small-string buffer still live on the heap. </param>
+		explicit JsonParseCoordinator(std::shared_ptr<Wrapper> wrapper, IAllocator& allocator = IAllocator::Default());
 
 		JsonParseCoordinator(const JsonParseCoordinator& other) = delete;
 
@@ -104,6 +116,18 @@ namespace FieaGameEngine
 		/// <param name="wrapper"> shared_ptr to the Wrapper to set. </param>
 		void SetWrapper(std::shared_ptr<Wrapper> wrapper);
 
+		/// <summary>
+		/// Gets the allocator that parsed data takes its memory from.
+		/// </summary>
+		/// <returns> A reference to the allocator. </returns>
+		IAllocator& GetAllocator() const;
+
+		/// <summary>
+		/// Sets the allocator that data parsed from now on takes its memory from.
+		/// </summary>
+		/// <param name="allocator"> The allocator to be used. </param>
+		void SetAllocator(IAllocator& allocator);
+
 		/// <summary>
 		/// Function to deserialize an object with a given input stream.
 		/// </summary>
@@ -149,5 +173,7 @@ namespace FieaGameEngine
 		std::shared_ptr<Wrapper> _wrapper{ nullptr };
 
 		Vector<std::shared_ptr<IJsonParseHelper>> _helpers{ 17 };
+
+		IAllocator* _allocator{ &IAllocator::Default() };
 	};
 }
\ No newline at end of file
@@ -0,0 +1,164 @@
+#pragma once
+#include "pch.h"
+#include "PoolAllocator.h"
+
+namespace FieaGameEngine
+{
+	PoolAllocator::PoolAllocator(std::size_t chunkSize, IAllocator& upstream)
+		: _upstream{ &upstream }, _chunkSize{ std::max(chunkSize, ChunkHeaderSize + MaxPooledSize) }
+	{
+	}
+
+	PoolAllocator::~PoolAllocator()
+	{
+		Release();
+	}
+
+	void* PoolAllocator::Allocate(std::size_t size)
+	{
+		if (size == 0)
+			return nullptr;
+
+		if (size > MaxPooledSize)
+		{
+			LargeBlock* header = reinterpret_cast<LargeBlock*>(_upstream->Allocate(LargeHeaderSize + size));
+			assert(header != nullptr);
+			header->Previous = nullptr;
+			header->Next = _largeBlocks;
+			header->Size = LargeHeaderSize + size;
+			if (_largeBlocks != nullptr)
+				_largeBlocks->Previous = header;
+			_largeBlocks = header;
+
+			++_activeAllocations;
+			return reinterpret_cast<std::byte*>(header) + LargeHeaderSize;
+		}
+
+		std::size_t sizeClass = SizeClass(size);
+		if (_freeLists[sizeClass] == nullptr)
+			Refill(sizeClass);
+
+		FreeBlock* block = _freeLists[sizeClass];
+		_freeLists[sizeClass] = block->Next;
+
+		++_activeAllocations;
+		return block;
+	}
+
+	void* PoolAllocator::Reallocate(void* block, std::size_t size, std::size_t newSize)
+	{
+		if (block == nullptr)
+			return Allocate(newSize);
+
+		if (newSize == 0)
+		{
+			Deallocate(block, size);
+			return nullptr;
+		}
+
+		if (size <= MaxPooledSize && newSize <= MaxPooledSize && SizeClass(size) == SizeClass(newSize))
+			return block;
+
+		void* newBlock = Allocate(newSize);
+		std::memcpy(newBlock, block, std::min(size, newSize));
+		Deallocate(block, size);
+		return newBlock;
+	}
+
+	void PoolAllocator::Deallocate(void* block, std::size_t size)
+	{
+		if (block == nullptr)
+			return;
+
+		assert(_activeAllocations > 0);
+		--_activeAllocations;
+
+		if (size > MaxPooledSize)
+		{
+			LargeBlock* header = reinterpret_cast<LargeBlock*>(reinterpret_cast<std::byte*>(block) - LargeHeaderSize);
+			if (header->Previous != nullptr)
+				header->Previous->Next = header->Next;
+			else
+				_largeBlocks = header->Next;
+			if (header->Next != nullptr)
+				header->Next->Previous = header->Previous;
+
+			_upstream->Deallocate(header, header->Size);
+			return;
+		}
+
+		std::size_t sizeClass = SizeClass(size);
+		FreeBlock* freeBlock = reinterpret_cast<FreeBlock*>(block);
+		freeBlock->Next = _freeLists[sizeClass];
+		_freeLists[sizeClass] = freeBlock;
+	}
+
+	void PoolAllocator::Release()
+	{
+		while (_chunks != nullptr)
+		{
+			Chunk* next = _chunks->Next;
+			_upstream->Deallocate(_chunks, _chunks->Size);
+			_chunks = next;
+		}
+
+		while (_largeBlocks != nullptr)
+		{
+			LargeBlock* next = _largeBlocks->Next;
+			_upstream->Deallocate(_largeBlocks, _largeBlocks->Size);
+			_largeBlocks = next;
+		}
+
+		for (std::size_t i = 0; i < SizeClassCount; ++i)
+			_freeLists[i] = nullptr;
+
+		_chunkCount = 0;
+		_activeAllocations = 0;
+	}
+
+	std::size_t PoolAllocator::ActiveAllocations() const
+	{
+		return _activeAllocations;
+	}
+
+	std::size_t PoolAllocator::ChunkCount() const
+	{
+		return _chunkCount;
+	}
+
+	std::size_t PoolAllocator::SizeClass(std::size_t size)
+	{
+		assert(size <= MaxPooledSize);
+
+		std::size_t sizeClass = 0;
+		while (BlockSize(sizeClass) < size)
+			++sizeClass;
+		return sizeClass;
+	}
+
+	std::size_t PoolAllocator::BlockSize(std::size_t sizeClass)
+	{
+		return Alignment << sizeClass;
+	}
+
+	void PoolAllocator::Refill(std::size_t sizeClass)
+	{
+		Chunk* chunk = reinterpret_cast<Chunk*>(_upstream->Allocate(_chunkSize));
+		assert(chunk != nullptr);
+		chunk->Next = _chunks;
+		chunk->Size = _chunkSize;
+		_chunks = chunk;
+		++_chunkCount;
+
+		// Thread the chunk's blocks onto the free list back to front, so that they are handed out in address order.
+		std::size_t blockSize = BlockSize(sizeClass);
+		std::size_t blockCount = (_chunkSize - ChunkHeaderSize) / blockSize;
+		std::byte* first = reinterpret_cast<std::byte*>(chunk) + ChunkHeaderSize;
+		for (std::size_t i = blockCount; i > 0; --i)
+		{
+			FreeBlock* block = reinterpret_cast<FreeBlock*>(first + (i - 1) * blockSize);
+			block->Next = _freeLists[sizeClass];
+			_freeLists[sizeClass] = block;
+		}
+	}
+}
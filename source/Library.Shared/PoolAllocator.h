@@ -0,0 +1,93 @@
+#pragma once
+#include "IAllocator.h"
+
+namespace FieaGameEngine
+{
+	/// <summary>
+	/// Size-class pool for the many small blocks that Scope trees are made of. Small blocks are carved out of large chunks and recycled through per-class free lists, and
+	/// larger blocks are forwarded to an upstream allocator. Everything the pool ever handed out can be returned to the upstream allocator at once with Release.
+	/// The pool is not thread-safe.
+	/// </summary>
+	class PoolAllocator final : public IAllocator
+	{
+	public:
+		/// <summary>
+		/// Size of the largest block served from the pool's own chunks. Larger blocks come from the upstream allocator.
+		/// </summary>
+		static constexpr std::size_t MaxPooledSize = 512;
+
+		/// <summary>
+		/// Constructor for PoolAllocator.
+		/// </summary>
+		/// <param name="chunkSize"> The number of bytes requested from the upstream allocator whenever a size class runs out of blocks. </param>
+		/// <param name="upstream"> The allocator that chunks and large blocks are taken from. </param>
+		explicit PoolAllocator(std::size_t chunkSize = 16384, IAllocator& upstream = IAllocator::Default());
+
+		PoolAllocator(const PoolAllocator& other) = delete;
+		PoolAllocator& operator=(const PoolAllocator& rhs) = delete;
+		PoolAllocator(PoolAllocator&& other) noexcept = delete;
+		PoolAllocator& operator=(PoolAllocator&& rhs) noexcept = delete;
+
+		/// <summary>
+		/// Destructor for PoolAllocator. Releases all memory back to the upstream allocator.
+		/// </summary>
+		~PoolAllocator();
+
+		void* Allocate(std::size_t size) override;
+		void* Reallocate(void* block, std::size_t size, std::size_t newSize) override;
+		void Deallocate(void* block, std::size_t size) override;
+
+		/// <summary>
+		/// Function to return every chunk and large block to the upstream allocator in one pass, without visiting individual blocks.
+		/// Destructors are not run, so anything still living in the pool must either have been destroyed already or not need destruction.
+		/// </summary>
+		void Release();
+
+		/// <summary>
+		/// Function to get the number of blocks that have been handed out and not yet deallocated.
+		/// </summary>
+		/// <returns> The number of live blocks. </returns>
+		std::size_t ActiveAllocations() const;
+
+		/// <summary>
+		/// Function to get the number of chunks taken from the upstream allocator for small blocks.
+		/// </summary>
+		/// <returns> The number of chunks currently held by the pool. </returns>
+		std::size_t ChunkCount() const;
+
+	private:
+		struct FreeBlock final
+		{
+			FreeBlock* Next;
+		};
+
+		struct Chunk final
+		{
+			Chunk* Next;
+			std::size_t Size;
+		};
+
+		struct LargeBlock final
+		{
+			LargeBlock* Previous;
+			LargeBlock* Next;
+			std::size_t Size;
+		};
+
+		static constexpr std::size_t SizeClassCount = 6;
+		static constexpr std::size_t ChunkHeaderSize = (sizeof(Chunk) + Alignment - 1) / Alignment * Alignment;
+		static constexpr std::size_t LargeHeaderSize = (sizeof(LargeBlock) + Alignment - 1) / Alignment * Alignment;
+
+		static std::size_t SizeClass(std::size_t size);
+		static std::size_t BlockSize(std::size_t sizeClass);
+		void Refill(std::size_t sizeClass);
+
+		FreeBlock* _freeLists[SizeClassCount]{};
+		Chunk* _chunks{ nullptr };
+		LargeBlock* _largeBlocks{ nullptr };
+		IAllocator* _upstream;
+		std::size_t _chunkSize;
+		std::size_t _chunkCount{ 0 };
+		std::size_t _activeAllocations{ 0 };
+	};
+}
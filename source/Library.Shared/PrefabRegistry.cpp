@@ -0,0 +1,79 @@
+#pragma once
+#include "pch.h"
+#include "PrefabRegistry.h"
+
+using namespace std;
+
+namespace FieaGameEngine
+{
+	PrefabRegistry::~PrefabRegistry()
+	{
+		Clear();
+	}
+
+	Scope& PrefabRegistry::Register(string_view name, const Scope& prototype)
+	{
+		if (_prefabs.ContainsKey(name))
+			throw runtime_error("Prefab is already registered with given name.");
+
+		gsl::owner<Scope*> copy = prototype.Clone();
+		_prefabs.Insert(make_pair(string{ name }, copy));
+		return *copy;
+	}
+
+	bool PrefabRegistry::Unregister(string_view name)
+	{
+		HashMap<string, gsl::owner<Scope*>>::Iterator it = _prefabs.Find(name);
+		if (it == _prefabs.end())
+			return false;
+
+		delete it->second;
+		_prefabs.Remove(name);
+		return true;
+	}
+
+	bool PrefabRegistry::IsRegistered(string_view name) const
+	{
+		return _prefabs.ContainsKey(name);
+	}
+
+	const Scope& PrefabRegistry::Prototype(string_view name) const
+	{
+		return *_prefabs.At(name);
+	}
+
+	gsl::owner<Scope*> PrefabRegistry::Instantiate(string_view name) const
+	{
+		return _prefabs.At(name)->Clone();
+	}
+
+	void PrefabRegistry::Instantiate(string_view name, size_t count, Scope& parent, string_view key) const
+	{
+		const Scope& prototype = *_prefabs.At(name);
+
+		Datum& datum = parent.Append(key);
+		if (datum.Type() != Datum::DatumTypes::Unknown && datum.Type() != Datum::DatumTypes::Table)
+			throw runtime_error("Datum for specified key already exists with incompatible type.");
+
+		datum.SetType(Datum::DatumTypes::Table);
+		datum.Reserve(datum.Size() + count);
+		for (size_t i = 0; i < count; ++i)
+		{
+			Scope* newScope = prototype.Clone();
+			newScope->_parent = &parent;
+			datum.PushBackScope(newScope);
+		}
+	}
+
+	size_t PrefabRegistry::Size() const
+	{
+		return _prefabs.Size();
+	}
+
+	void PrefabRegistry::Clear()
+	{
+		for (HashMap<string, gsl::owner<Scope*>>::Iterator it = _prefabs.begin(); it != _prefabs.end(); ++it)
+			delete it->second;
+		_prefabs.Clear();
+	}
+}
@@ -0,0 +1,87 @@
+#pragma once
+#include "Scope.h"
+
+namespace FieaGameEngine
+{
+	/// <summary>
+	/// Registry of named, fully populated prototype Scopes. Instantiating a prefab copies the prototype's map layout wholesale and rebinds its external storage in one pass,
+	/// instead of populating and appending every attribute of a new object one key at a time.
+	/// </summary>
+	class PrefabRegistry final
+	{
+	public:
+		PrefabRegistry() = default;
+		PrefabRegistry(const PrefabRegistry& other) = delete;
+		PrefabRegistry(PrefabRegistry&& other) noexcept = delete;
+		PrefabRegistry& operator=(const PrefabRegistry& rhs) = delete;
+		PrefabRegistry& operator=(PrefabRegistry&& rhs) noexcept = delete;
+
+		/// <summary>
+		/// Destructor for PrefabRegistry, which deletes every registered prototype.
+		/// </summary>
+		~PrefabRegistry();
+
+		/// <summary>
+		/// Function to register a prefab. The registry keeps its own copy of the prototype, so later changes to the passed in Scope do not affect the prefab.
+		/// </summary>
+		/// <param name="name"> The name the prefab is to be registered under. </param>
+		/// <param name="prototype"> The Scope to be copied as the prefab's template. </param>
+		/// <returns> Reference to the registry's copy of the prototype. </returns>
+		/// <exception cref="runtime_error"> Throws if a prefab is already registered under the given name. </exception>
+		Scope& Register(std::string_view name, const Scope& prototype);
+
+		/// <summary>
+		/// Function to remove a prefab from the registry. Objects already instantiated from it are unaffected.
+		/// </summary>
+		/// <param name="name"> The name of the prefab to be removed. </param>
+		/// <returns> True if a prefab was removed, false if none was registered under the given name. </returns>
+		bool Unregister(std::string_view name);
+
+		/// <summary>
+		/// Function to check if a prefab is registered under the given name.
+		/// </summary>
+		/// <param name="name"> The name to check for. </param>
+		/// <returns> True if the prefab is registered, false if it is not. </returns>
+		bool IsRegistered(std::string_view name) const;
+
+		/// <summary>
+		/// Function to get the prototype of a registered prefab.
+		/// </summary>
+		/// <param name="name"> The name of the prefab. </param>
+		/// <returns> Const reference to the prototype. </returns>
+		/// <exception cref="runtime_error"> Throws if no prefab is registered under the given name. </exception>
+		const Scope& Prototype(std::string_view name) const;
+
+		/// <summary>
+		/// Function to create a new object from a registered prefab.
+		/// </summary>
+		/// <param name="name"> The name of the prefab. </param>
+		/// <returns> Pointer to the new, parentless object. Calling context is now responsible for deleting the pointer. </returns>
+		/// <exception cref="runtime_error"> Throws if no prefab is registered under the given name. </exception>
+		gsl::owner<Scope*> Instantiate(std::string_view name) const;
+
+		/// <summary>
+		/// Function to create several objects from a registered prefab and append them all to a nested Scope Datum of a parent, growing the Datum once.
+		/// </summary>
+		/// <param name="name"> The name of the prefab. </param>
+		/// <param name="count"> The number of objects to be created. </param>
+		/// <param name="parent"> The Scope that is to own the new objects. </param>
+		/// <param name="key"> The key of the Datum within the parent that the new objects are appended to. </param>
+		/// <exception cref="runtime_error"> Throws if no prefab is registered under the given name, or if the Datum for the key exists with a type other than Table. </exception>
+		void Instantiate(std::string_view name, std::size_t count, Scope& parent, std::string_view key) const;
+
+		/// <summary>
+		/// Function to get the number of registered prefabs.
+		/// </summary>
+		/// <returns> The number of registered prefabs. </returns>
+		std::size_t Size() const;
+
+		/// <summary>
+		/// Function to delete every registered prototype.
+		/// </summary>
+		void Clear();
+
+	private:
+		HashMap<std::string, gsl::owner<Scope*>> _prefabs;
+	};
+}
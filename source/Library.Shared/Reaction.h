@@ -10,6 +10,6 @@ namespace FieaGameEngine
 		/// <summary>
 		/// Protected constructor for Reaction that calls ActionList constructor with the child typeId.
 		/// </summary>
-		Reaction(RTTI::IdType typeId) : ActionList(typeId) {};
+		Reaction(RTTI::IdType typeId, IAllocator& allocator = IAllocator::Default()) : ActionList(typeId, allocator) {};
 	};
 }
\ No newline at end of file
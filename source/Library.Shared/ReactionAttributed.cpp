@@ -1,5 +1,6 @@
 #include "ReactionAttributed.h"
 #include "Event.h"
+#include "ReactionMessage.h"
 #include "ActionIncrement.h"
 
 namespace FieaGameEngine
@@ -7,21 +8,169 @@ namespace FieaGameEngine
 	RTTI_DEFINITIONS(ReactionAttributed);
 
 	ReactionAttributed::ReactionAttributed()
-		: Reaction(ReactionAttributed::TypeIdClass())
+		: ReactionAttributed(IAllocator::Default())
 	{
-		Event<ReactionMessageAttributed>::Subscribe(this);
+	}
+
+	ReactionAttributed::ReactionAttributed(IAllocator& allocator)
+		: Reaction(ReactionAttributed::TypeIdClass(), allocator)
+	{
+		Register();
+	}
+
+	ReactionAttributed::ReactionAttributed(const ReactionAttributed& other)
+		: Reaction{ other }, _subtype{ other._subtype }
+	{
+		Register();
+	}
+
+	ReactionAttributed& ReactionAttributed::operator=(const ReactionAttributed& rhs)
+	{
+		if (this != &rhs)
+		{
+			Reaction::operator=(rhs);
+			_subtype = rhs._subtype;
+			MarkDirty();
+		}
+		return *this;
 	}
 
 	ReactionAttributed::~ReactionAttributed()
 	{
-		Event<ReactionMessageAttributed>::Unsubscribe(this);
+		std::lock_guard lock{ _registryMutex };
+		if (_isSubscribed)
+			Unsubscribe();
+
+		if (_isDirty)
+		{
+			auto it = _dirty.Find(this);
+			assert(it != _dirty.end());
+			*it = _dirty.Back();
+			_dirty.PopBack();
+			if (_dirty.IsEmpty())
+			{
+				_dirty.ShrinkToFit();
+				_hasDirty.store(false, std::memory_order_release);
+			}
+		}
+
+		ReactionAttributed* last = _registry.Back();
+		_registry[_registryIndex] = last;
+		last->_registryIndex = _registryIndex;
+		_registry.PopBack();
+		if (_registry.IsEmpty())
+			_registry.ShrinkToFit();
 	}
 
 	ReactionAttributed* ReactionAttributed::Clone() const
 	{
-		auto clone = new ReactionAttributed{ *this };
-		Event<ReactionMessageAttributed>::Subscribe(clone);
-		return clone;
+		return new ReactionAttributed{ *this };
+	}
+
+	void ReactionAttributed::Update(GameState& gameState)
+	{
+		ActionList::Update(gameState);
+	}
+
+	ReactionSubtypes ReactionAttributed::GetSubtype() const
+	{
+		return _subtype;
+	}
+
+	void ReactionAttributed::SetSubtype(ReactionSubtypes subtype)
+	{
+		_subtype = subtype;
+		MarkDirty();
+	}
+
+	void ReactionAttributed::PostLoad()
+	{
+		Reaction::PostLoad();
+		MarkDirty();
+	}
+
+	void ReactionAttributed::SyncSubscriptions()
+	{
+		// Both checks are lock-free, so a delivery with nothing to bring up to date costs two atomic loads.
+		const std::uint64_t updateCount = EventQueue::UpdateCount();
+		const bool isNewUpdate = _syncedUpdateCount.load(std::memory_order_acquire) != updateCount;
+		if (!isNewUpdate && !_hasDirty.load(std::memory_order_acquire))
+			return;
+
+		std::lock_guard lock{ _registryMutex };
+		if (isNewUpdate && _syncedUpdateCount.load(std::memory_order_relaxed) != updateCount)
+		{
+			// Once per EventQueue update, catch the subtypes written straight through the "Subtype" Datum.
+			for (ReactionAttributed* reaction : _registry)
+				reaction->SyncSubscription();
+			_syncedUpdateCount.store(updateCount, std::memory_order_release);
+		}
+
+		for (ReactionAttributed* reaction : _dirty)
+		{
+			reaction->_isDirty = false;
+			reaction->SyncSubscription();
+		}
+		_dirty.Clear();
+		_hasDirty.store(false, std::memory_order_release);
+	}
+
+	void ReactionAttributed::SyncSubscription()
+	{
+		if (_isSubscribed && _subscribedSubtype == _subtype)
+			return;
+
+		if (_isSubscribed)
+			Unsubscribe();
+		_subscribedSubtype = _subtype;
+		Subscribe();
+		_isSubscribed = true;
+	}
+
+	void ReactionAttributed::Register()
+	{
+		std::lock_guard lock{ _registryMutex };
+		_registryIndex = _registry.Size();
+		_registry.PushBack(this);
+		QueueDirty();
+	}
+
+	void ReactionAttributed::MarkDirty()
+	{
+		std::lock_guard lock{ _registryMutex };
+		QueueDirty();
+	}
+
+	void ReactionAttributed::QueueDirty()
+	{
+		if (_isDirty)
+			return;
+
+		_isDirty = true;
+		_dirty.PushBack(this);
+		_hasDirty.store(true, std::memory_order_release);
+	}
+
+	void ReactionAttributed::Subscribe()
+	{
+		Event<ReactionMessageAttributed>::Subscribe(this, size_t(_subscribedSubtype));
+		Event<ReactionMessage>::Subscribe(this, size_t(_subscribedSubtype));
+	}
+
+	void ReactionAttributed::Unsubscribe()
+	{
+		Event<ReactionMessageAttributed>::Unsubscribe(this, size_t(_subscribedSubtype));
+		Event<ReactionMessage>::Unsubscribe(this, size_t(_subscribedSubtype));
+	}
+
+	void EventRouting<ReactionMessageAttributed>::BeforeDeliver()
+	{
+		ReactionAttributed::SyncSubscriptions();
+	}
+
+	void EventRouting<ReactionMessage>::BeforeDeliver()
+	{
+		ReactionAttributed::SyncSubscriptions();
 	}
 
 	Vector<Signature> ReactionAttributed::Signatures()
@@ -32,6 +181,22 @@ namespace FieaGameEngine
 	void ReactionAttributed::Notify(IEventPublisher* eventPublisher)
 	{
 		assert(eventPublisher != nullptr);
+		if (eventPublisher->Is(Event<ReactionMessage>::TypeIdClass()))
+		{
+			Event<ReactionMessage>* reactionEvent = static_cast<Event<ReactionMessage>*>(eventPublisher);
+			if (reactionEvent->Message().GetSubtype() == _subtype)
+			{
+				for (size_t i = 0; i < Actions().Size(); ++i)
+				{
+					assert(Actions()[i].Is(Action::TypeIdClass()));
+					Action& action = static_cast<Action&>(Actions()[i]);
+					action.ExtractArguments(reactionEvent->Message());
+				}
+				UpdateActions(reactionEvent->Message().GetGameState());
+			}
+			return;
+		}
+
 		assert(eventPublisher->Is(Event<ReactionMessageAttributed>::TypeIdClass()));
 		Event<ReactionMessageAttributed>* reactionEvent = static_cast<Event<ReactionMessageAttributed>*>(eventPublisher);
 		if (reactionEvent->Message().GetSubtype() == _subtype)
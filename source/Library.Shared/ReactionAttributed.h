@@ -1,6 +1,9 @@
 #pragma once
 #include "Reaction.h"
 #include "ReactionMessageAttributed.h"
+#include <atomic>
+#include <limits>
+#include <mutex>
 
 namespace FieaGameEngine
 {
@@ -11,6 +14,25 @@ namespace FieaGameEngine
 	public:
 		ReactionAttributed();
 
+		/// <summary>
+		/// Constructor for ReactionAttributed that takes its storage from the given allocator, as factories do when creating it in one.
+		/// </summary>
+		/// <param name="allocator"> The allocator the ReactionAttributed takes its storage from. </param>
+		explicit ReactionAttributed(IAllocator& allocator);
+
+		/// <summary>
+		/// Copy constructor for ReactionAttributed. The copy is registered for subscription on its own.
+		/// </summary>
+		/// <param name="other"> The ReactionAttributed to be copied. </param>
+		ReactionAttributed(const ReactionAttributed& other);
+
+		/// <summary>
+		/// Copy assignment operator for ReactionAttributed. "This" keeps its own registration, and picks up the subtype of rhs before the next delivery.
+		/// </summary>
+		/// <param name="rhs"> The ReactionAttributed to be copied. </param>
+		/// <returns> A reference to "this". </returns>
+		ReactionAttributed& operator=(const ReactionAttributed& rhs);
+
 		virtual ~ReactionAttributed();
 
 		/// <summary>
@@ -21,19 +43,109 @@ namespace FieaGameEngine
 
 		/// <summary>
 		/// Notify method that responds to published events "this" object is subscribed.
+		/// "this" is only subscribed to the channel of its subtype, so it is only notified of ReactionMessageAttributed and ReactionMessage events published for that subtype.
+		/// Subscriptions are made by SyncSubscriptions, on the delivering thread, so a reaction constructed or retargeted since is picked up before the next delivery.
 		/// </summary>
 		/// <param name="eventPublisher"> The EventPublisher that calls this event. </param>
 		void Notify(IEventPublisher* eventPublisher) override;
 
+		/// <summary>
+		/// Virtual Update function that updates the contained Actions. It does not touch the subscriptions, which are shared by every
+		/// reaction, so it is safe to run from the jobs of a parallel GameObject update.
+		/// </summary>
+		/// <param name="gameState"> A reference to a GameState instance. </param>
+		void Update(GameState& gameState) override;
+
+		/// <summary>
+		/// Getter for the subtype of events "this" reacts to.
+		/// </summary>
+		/// <returns> The reaction subtype of this reaction. </returns>
+		ReactionSubtypes GetSubtype() const;
+
+		/// <summary>
+		/// Function to set the subtype of events "this" reacts to. The subscription follows before the next delivery. A write straight to the
+		/// "Subtype" attribute is only noticed once per EventQueue update, before the first reaction message that update delivers.
+		/// </summary>
+		/// <param name="subtype"> The reaction subtype to react to. </param>
+		void SetSubtype(ReactionSubtypes subtype);
+
 		/// <summary>
 		/// Static function to get the Signatures of attributed this type.
 		/// </summary>
 		/// <returns> Vector of the Attribute signatures of this type. </returns>
 		static Vector<Signature> Signatures();
 
+		/// <summary>
+		/// Function that queues "this" to have its subscription brought up to date, once a JSON document has set its subtype.
+		/// </summary>
+		void PostLoad() override;
+
+		/// <summary>
+		/// Static function that moves reactions subscribed elsewhere, or not yet at all, to the channel of their current subtype.
+		/// Event::Deliver calls it before delivering a reaction message, so it runs on the delivering thread and never inside a parallel update.
+		/// Only the reactions constructed, copied, loaded or given a subtype with SetSubtype since the last call are visited, except that the
+		/// first call after each EventQueue update compares the subtype of every live reaction, to catch writes through the "Subtype" Datum.
+		/// When there is nothing to do it takes no lock.
+		/// </summary>
+		static void SyncSubscriptions();
+
 	protected:
-		ReactionSubtypes _subtype;
+		ReactionSubtypes _subtype{};
+
+	private:
+		/// <summary>
+		/// Subscribes "this" to both kinds of reaction message on the channel of the subtype it is subscribed with.
+		/// </summary>
+		void Subscribe();
+
+		/// <summary>
+		/// Unsubscribes "this" from both kinds of reaction message on the channel of the subtype it is subscribed with.
+		/// </summary>
+		void Unsubscribe();
+
+		/// <summary>
+		/// Adds "this" to the registry and queues its first subscription.
+		/// </summary>
+		void Register();
+
+		/// <summary>
+		/// Moves the subscription of "this" to the channel of its current subtype. Called with the registry mutex held.
+		/// </summary>
+		void SyncSubscription();
+
+		/// <summary>
+		/// Queues "this" for the next SyncSubscriptions, taking the registry mutex.
+		/// </summary>
+		void MarkDirty();
+
+		/// <summary>
+		/// Queues "this" for the next SyncSubscriptions. Called with the registry mutex held.
+		/// </summary>
+		void QueueDirty();
+
+		ReactionSubtypes _subscribedSubtype{};
+		bool _isSubscribed{ false };
+		bool _isDirty{ false };
+		std::size_t _registryIndex{ 0 };
+
+		/// <summary>
+		/// Every live reaction, so that subscriptions can be brought up to date on the delivering thread. Reactions may be constructed and
+		/// destroyed from jobs, so the registry and the Event subscriber lists it feeds are only touched with the mutex held.
+		/// </summary>
+		inline static std::mutex _registryMutex;
+		inline static Vector<ReactionAttributed*> _registry;
+
+		/// <summary>
+		/// Reactions waiting for SyncSubscriptions, with a flag that lets deliveries see there are none without taking the mutex.
+		/// </summary>
+		inline static Vector<ReactionAttributed*> _dirty;
+		inline static std::atomic<bool> _hasDirty{ false };
+
+		/// <summary>
+		/// The EventQueue::UpdateCount at the last full sweep, or the maximum if there has not been one.
+		/// </summary>
+		inline static std::atomic<std::uint64_t> _syncedUpdateCount{ std::numeric_limits<std::uint64_t>::max() };
 	};
 
-	ConcreteFactory(ReactionAttributed, Scope);
+	ConcreteScopeFactory(ReactionAttributed);
 }
\ No newline at end of file
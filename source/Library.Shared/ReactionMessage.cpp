@@ -0,0 +1,70 @@
+#include "ReactionMessage.h"
+
+using namespace std;
+
+namespace FieaGameEngine
+{
+	ReactionMessage::ReactionMessage(ReactionSubtypes subtype, GameState& gameState)
+		: _subtype{ subtype }, _gameState{ &gameState }
+	{
+	}
+
+	ReactionSubtypes ReactionMessage::GetSubtype() const
+	{
+		return _subtype;
+	}
+
+	void ReactionMessage::SetSubtype(ReactionSubtypes subtype)
+	{
+		_subtype = subtype;
+	}
+
+	GameState& ReactionMessage::GetGameState() const
+	{
+		return *_gameState;
+	}
+
+	void ReactionMessage::SetGameState(GameState& gameState)
+	{
+		_gameState = &gameState;
+	}
+
+	size_t ReactionMessage::ArgumentCount() const
+	{
+		return _argumentCount;
+	}
+
+	const ReactionMessage::Argument& ReactionMessage::GetArgument(size_t index) const
+	{
+		if (index >= _argumentCount)
+			throw out_of_range("Index is out of bounds");
+
+		return _arguments[index];
+	}
+
+	void ReactionMessage::AppendArgument(Symbol name, const Datum& value)
+	{
+		if (_argumentCount == Capacity)
+			throw runtime_error("ReactionMessage is full.");
+		if (!CanCarry(value))
+			throw runtime_error("ReactionMessage can only carry single integers and floats.");
+
+		Argument& argument = _arguments[_argumentCount++];
+		argument.Name = name;
+		argument.Type = value.Type();
+		if (argument.Type == Datum::DatumTypes::Integer)
+			argument.Integer = value.Get<int32_t>();
+		else
+			argument.Float = value.Get<float>();
+	}
+
+	void ReactionMessage::ClearArguments()
+	{
+		_argumentCount = 0;
+	}
+
+	bool ReactionMessage::CanCarry(const Datum& value)
+	{
+		return value.Size() == 1 && (value.Type() == Datum::DatumTypes::Integer || value.Type() == Datum::DatumTypes::Float);
+	}
+}
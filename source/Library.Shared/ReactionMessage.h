@@ -0,0 +1,117 @@
+#pragma once
+#include <array>
+#include <cstdint>
+#include <type_traits>
+#include "ReactionMessageAttributed.h"
+
+namespace FieaGameEngine
+{
+	/// <summary>
+	/// Compact alternative to ReactionMessageAttributed, for events whose arguments are all single integers or floats.
+	/// Arguments are named by Symbols resolved when the sender binds its arguments, and their values are stored inline,
+	/// so the message is a small trivially copyable record: filling, copying and recycling it never touches the heap or hashes a string.
+	/// </summary>
+	class ReactionMessage final
+	{
+	public:
+		static constexpr std::size_t Capacity = 8;
+
+		/// <summary>
+		/// A named argument carried by the message. Type is either Integer or Float, and picks the member of the union that holds the value.
+		/// </summary>
+		struct Argument final
+		{
+			Symbol Name;
+			Datum::DatumTypes Type;
+			union
+			{
+				std::int32_t Integer;
+				float Float;
+			};
+		};
+
+		/// <summary>
+		/// Constructor for ReactionMessage, which creates a message with no arguments.
+		/// </summary>
+		/// <param name="subtype"> The reaction subtype of this message. </param>
+		/// <param name="gameState"> The game state being used by the game loop. </param>
+		ReactionMessage(ReactionSubtypes subtype, GameState& gameState);
+
+		/// <summary>
+		/// Getter for this message's reaction subtype.
+		/// </summary>
+		/// <returns> The reaction subtype of this message. </returns>
+		ReactionSubtypes GetSubtype() const;
+
+		/// <summary>
+		/// Function to set the reaction subtype of this message.
+		/// </summary>
+		/// <param name="subtype"> The value of reaction subtype to assign to this message. </param>
+		void SetSubtype(ReactionSubtypes subtype);
+
+		/// <summary>
+		/// Function to get the game state from this message.
+		/// </summary>
+		/// <returns> Reference to the game state instance. </returns>
+		GameState& GetGameState() const;
+
+		/// <summary>
+		/// Function to set the game state carried by this message.
+		/// </summary>
+		/// <param name="gameState"> The game state being used by the game loop. </param>
+		void SetGameState(GameState& gameState);
+
+		/// <summary>
+		/// Function to get the number of arguments carried by the message.
+		/// </summary>
+		/// <returns> The number of arguments. </returns>
+		std::size_t ArgumentCount() const;
+
+		/// <summary>
+		/// Function to get the argument in a given slot.
+		/// </summary>
+		/// <param name="index"> The slot of the argument, in the order the arguments were appended. </param>
+		/// <returns> Const reference to the argument. </returns>
+		/// <exception cref="out_of_range"> Throws if the index is greater than or equal to the number of arguments. </exception>
+		const Argument& GetArgument(std::size_t index) const;
+
+		/// <summary>
+		/// Function to append an argument, copying the value of a Datum into the next slot.
+		/// </summary>
+		/// <param name="name"> The name of the argument. </param>
+		/// <param name="value"> The Datum holding the value of the argument. </param>
+		/// <exception cref="runtime_error"> Throws if the message is full, or if the Datum cannot be carried. </exception>
+		void AppendArgument(Symbol name, const Datum& value);
+
+		/// <summary>
+		/// Function to remove every argument, so that the message can be refilled.
+		/// </summary>
+		void ClearArguments();
+
+		/// <summary>
+		/// Function to check if the value of a Datum can be carried as an argument.
+		/// </summary>
+		/// <param name="value"> The Datum to check. </param>
+		/// <returns> True if the Datum holds a single integer or float, false if not. </returns>
+		static bool CanCarry(const Datum& value);
+
+	private:
+		ReactionSubtypes _subtype;
+		GameState* _gameState;
+		std::size_t _argumentCount{ 0 };
+		std::array<Argument, Capacity> _arguments;
+	};
+
+	static_assert(std::is_trivially_copyable_v<ReactionMessage>, "ReactionMessage must stay a plain record so that it can be copied with memcpy.");
+
+	/// <summary>
+	/// Reaction messages travel on the channel of their subtype, even when published without one. Reactions subscribe to the channel
+	/// of their subtype, which may have been written since; see ReactionAttributed::SyncSubscriptions.
+	/// </summary>
+	template <>
+	struct EventRouting<ReactionMessage> final
+	{
+		static std::size_t Channel(const ReactionMessage& message) { return std::size_t(message.GetSubtype()); }
+		static void BeforeDeliver();
+	};
+}
@@ -31,6 +31,11 @@ namespace FieaGameEngine
 		_subtype = type;
 	}
 
+	void ReactionMessageAttributed::SetGameState(GameState& gameState)
+	{
+		_gameState = &gameState;
+	}
+
 	Vector<Signature> ReactionMessageAttributed::Signatures()
 	{
 		return Vector{ 
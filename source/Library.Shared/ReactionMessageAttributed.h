@@ -2,6 +2,7 @@
 #include "Attributed.h"
 #include "TypeManager.h"
 #include "GameState.h"
+#include "Event.h"
 
 namespace FieaGameEngine
 {
@@ -46,6 +47,12 @@ namespace FieaGameEngine
 		/// <returns> Reference to the game state instance. </returns>
 		GameState& GetGameState() const;
 
+		/// <summary>
+		/// Function to set the game state carried by this message.
+		/// </summary>
+		/// <param name="gameState"> The game state being used by the game loop. </param>
+		void SetGameState(GameState& gameState);
+
 		/// <summary>
 		/// Static function that returns the Signatures of all Attributes of ReactionMessageAttributed.
 		/// </summary>
@@ -57,4 +64,15 @@ namespace FieaGameEngine
 
 		GameState* _gameState;
 	};
+
+	/// <summary>
+	/// Reaction messages travel on the channel of their subtype, even when published without one. Reactions subscribe to the channel
+	/// of their subtype, which may have been written since; see ReactionAttributed::SyncSubscriptions.
+	/// </summary>
+	template <>
+	struct EventRouting<ReactionMessageAttributed> final
+	{
+		static std::size_t Channel(const ReactionMessageAttributed& message) { return std::size_t(message.GetSubtype()); }
+		static void BeforeDeliver();
+	};
 }
\ No newline at end of file
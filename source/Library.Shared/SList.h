@@ -1,10 +1,14 @@
 #pragma once
 #include <stdio.h>
+#include "IAllocator.h"
+#include "IsTriviallyRelocatable.h"
 
 namespace FieaGameEngine
 {
 	/// <summary>
 	/// Templated class for a singly forward linked list.
+	/// Nodes that are popped or removed are kept on a free list and reused by later pushes, so a list that repeatedly grows and shrinks
+	/// only goes to its allocator while it is growing past its largest size so far. ShrinkToFit returns the kept nodes.
 	/// </summary>
 	template <typename T>
 	class SList final
@@ -188,7 +192,13 @@ namespace FieaGameEngine
 		SList(std::initializer_list<T> list);
 
 		/// <summary>
-		/// Copy constructor for SList that constructs an SList by deep-copying another SList onto "this" one.
+		/// Parameterized constructor for SList that takes in the allocator its nodes are taken from.
+		/// </summary>
+		/// <param name="allocator"> The allocator the nodes of the SList are taken from. </param>
+		explicit SList(IAllocator& allocator);
+
+		/// <summary>
+		/// Copy constructor for SList that constructs an SList by deep-copying another SList onto "this" one. The copy takes its nodes from the default allocator.
 		/// </summary>
 		/// <param name="other"> The SList from which "this" SList is to be initialized. </param>
 		SList(const SList& other);
@@ -238,10 +248,15 @@ namespace FieaGameEngine
 		void PopBack();
 
 		/// <summary>
-		/// A function to clear the entire SList.
+		/// A function to clear the entire SList. The nodes are kept for reuse.
 		/// </summary>
 		void Clear();
 
+		/// <summary>
+		/// A function to return the nodes kept for reuse to the allocator.
+		/// </summary>
+		void ShrinkToFit();
+
 		/// <summary>
 		/// A function that returns a reference to the item at the front of the SList.
 		/// </summary>
@@ -278,6 +293,12 @@ namespace FieaGameEngine
 		/// <returns> A boolean that is true if the SList is empty, false if it is not. </returns>
 		bool IsEmpty() const;
 
+		/// <summary>
+		/// A function to get the allocator the nodes of the SList are taken from.
+		/// </summary>
+		/// <returns> A reference to the allocator. </returns>
+		IAllocator& GetAllocator() const;
+
 		/// <summary>
 		/// A function that returns an Iterator that points to the beginning of the non-const SList.
 		/// </summary>
@@ -358,10 +379,27 @@ namespace FieaGameEngine
 		bool Remove(const T& value, EqualityFunctor equalityFunctor = EqualityFunctor{});
 
 	private:
+		/// <summary>
+		/// A destroyed node waiting on the free list to be reused.
+		/// </summary>
+		struct FreeNode final
+		{
+			FreeNode* _next;
+		};
+
+		template <typename... Args>
+		Node* CreateNode(Args&&... args);
+		void DestroyNode(Node* node);
+
 		Node* _front { nullptr };
 		Node* _back { nullptr };
 		std::size_t _size { 0 };
+		IAllocator* _allocator{ &IAllocator::Default() };
+		FreeNode* _freeNodes{ nullptr };
 	};
+
+	template <typename T>
+	struct IsTriviallyRelocatable<SList<T>> : std::true_type {};
 }
 
 #include "SList.inl"
\ No newline at end of file
@@ -34,6 +34,7 @@ namespace FieaGameEngine
 	inline SList<T>::~SList()
 	{
 		Clear();
+		ShrinkToFit();
 	}
 
 	template <typename T>
@@ -48,13 +49,20 @@ namespace FieaGameEngine
 		}
 	}
 
+	template <typename T>
+	SList<T>::SList(IAllocator& allocator)
+		: _allocator{ &allocator }
+	{
+	}
+
 	template <typename T>
 	SList<T>::SList(SList&& other) noexcept
-		: _front { other._front}, _back {other._back}, _size{other._size}
+		: _front { other._front}, _back {other._back}, _size{other._size}, _allocator{ other._allocator }, _freeNodes{ other._freeNodes }
 	{
 		other._front = nullptr;
 		other._back = nullptr;
 		other._size = 0;
+		other._freeNodes = nullptr;
 	}
 
 	template <typename T>
@@ -84,7 +92,7 @@ namespace FieaGameEngine
 	template <typename T>
 	inline void SList<T>::PushFront(const T& data)
 	{
-		Node* newNode =  new Node(data);
+		Node* newNode = CreateNode(data);
 
 		if (IsEmpty())
 			_back = newNode;
@@ -105,7 +113,7 @@ namespace FieaGameEngine
 	template <typename... Args>
 	typename SList<T>::Iterator SList<T>::EmplaceBack(Args... args)
 	{
-		Node* newNode = new Node(std::forward<Args>(args)...);
+		Node* newNode = CreateNode(std::forward<Args>(args)...);
 
 		if (IsEmpty())
 			_front = newNode;
@@ -125,7 +133,7 @@ namespace FieaGameEngine
 			throw std::runtime_error("List is empty");
 
 		Node front = *_front;
-		delete(_front);
+		DestroyNode(_front);
 		_size--;
 
 		_front = front._next;
@@ -147,7 +155,7 @@ namespace FieaGameEngine
 			prev = cur;
 			cur = cur->_next;
 		}
-		delete(cur);
+		DestroyNode(cur);
 		_size--;
 
 		if(prev != nullptr)
@@ -158,6 +166,46 @@ namespace FieaGameEngine
 			_front = nullptr;
 	}
 
+	template <typename T>
+	inline IAllocator& SList<T>::GetAllocator() const
+	{
+		return *_allocator;
+	}
+
+	template <typename T>
+	template <typename... Args>
+	typename SList<T>::Node* SList<T>::CreateNode(Args&&... args)
+	{
+		void* block;
+		if (_freeNodes != nullptr)
+		{
+			block = _freeNodes;
+			_freeNodes = _freeNodes->_next;
+		}
+		else
+			block = _allocator->Allocate(sizeof(Node));
+		assert(block != nullptr);
+		return new (block) Node(std::forward<Args>(args)...);
+	}
+
+	template <typename T>
+	void SList<T>::DestroyNode(Node* node)
+	{
+		node->~Node();
+		_freeNodes = new (node) FreeNode{ _freeNodes };
+	}
+
+	template <typename T>
+	void SList<T>::ShrinkToFit()
+	{
+		while (_freeNodes != nullptr)
+		{
+			FreeNode* next = _freeNodes->_next;
+			_allocator->Deallocate(_freeNodes, sizeof(Node));
+			_freeNodes = next;
+		}
+	}
+
 	template <typename T>
 	inline bool SList<T>::IsEmpty() const
 	{
@@ -206,7 +254,7 @@ namespace FieaGameEngine
 		while (_front != nullptr)
 		{
 			Node* next = _front->_next;
-			delete(_front);
+			DestroyNode(_front);
 			--_size;
 			_front = next;
 		}
@@ -368,7 +416,7 @@ namespace FieaGameEngine
 		else if (it._node == nullptr)
 			throw std::runtime_error("Iterator does not point to a valid item.");
 
-		Node* newNode = new Node{ value, it._node->_next };
+		Node* newNode = CreateNode(value, it._node->_next);
 		it._node->_next = newNode;
 		Iterator newIterator{ *this, newNode };
 		_back = newNode->_next == nullptr ? newNode : _back;
@@ -391,7 +439,7 @@ namespace FieaGameEngine
 		else if (it._node == nullptr)
 			throw std::runtime_error("Iterator does not point to a valid item.");
 
-		Node* newNode = new Node{ value, it._node->_next };
+		Node* newNode = CreateNode(value, it._node->_next);
 		it._node->_next = newNode;
 		ConstIterator newIterator{ *this, newNode };
 		_back = newNode->_next == nullptr ? newNode : _back;
@@ -441,7 +489,7 @@ namespace FieaGameEngine
 					_front = it._node->_next;
 				if (it._node == _back)
 					_back = prevIt._node;
-				delete(it._node);
+				DestroyNode(it._node);
 				--_size;
 				return true;
 			}
@@ -10,40 +10,26 @@ namespace FieaGameEngine
 	RTTI_DEFINITIONS(Scope);
 
 	Scope::Scope(size_t capacity)
-		: _map{ capacity }, _orderVector{ capacity }
+		: Scope{ IAllocator::Default(), capacity }
 	{
 	}
 
-	Scope::Scope(const Scope& other)
-		: _map{ other._map.Capacity() }, _orderVector{ other.Size() }
+	Scope::Scope(IAllocator& allocator, size_t capacity)
+		: _map{ capacity, allocator }, _orderVector{ allocator }, _symbolMap{ capacity, allocator }, _allocator{ &allocator }
 	{
-		Vector<HashMap<string, Datum>::PairType*>::ConstIterator it = other._orderVector.begin();
-		while (it != other._orderVector.end())
-		{
-			HashMap<string, Datum>::PairType* pair = *it;
-
-			Datum& currentDatum = Append(pair->first);
-
-			if (pair->second.Type() == Datum::DatumTypes::Table)
-			{
-				currentDatum.Reserve(pair->second.Size());
+	}
 
-				for (size_t i = 0; i < pair->second.Size(); ++i)
-				{
-					Scope* newScope = pair->second[i].Clone();
-					newScope->_parent = this;
-					currentDatum.PushBackScope(newScope);
-				}
-			}
-			else
-				currentDatum = pair->second;
-			++it;
-		}
+	Scope::Scope(const Scope& other)
+		: _map{ other._map }, _symbolMap{ other._symbolMap }
+	{
+		CloneCopiedEntries();
 	}
 
 	Scope::Scope(Scope&& other) noexcept
-		: _map{ move(other._map) }, _orderVector{ move(other._orderVector) }
+		: _map{ move(other._map) }, _orderVector{ move(other._orderVector) }, _symbolMap{ move(other._symbolMap) }, _allocator{ other._allocator }
 	{
+		// The Datums left with other have moved here.
+		other.BumpLayoutGeneration();
 		for (auto it = _orderVector.begin(); it != _orderVector.end(); ++it)
 		{
 			Datum& currentDatum = (*it)->second;
@@ -63,30 +49,11 @@ namespace FieaGameEngine
 		if (this != &rhs)
 		{
 			Clear();
+			BumpLayoutGeneration();
 
-			Vector<HashMap<string, Datum>::PairType*>::ConstIterator it = rhs._orderVector.begin();
-			while (it != rhs._orderVector.end())
-			{
-				HashMap<string, Datum>::PairType* pair = *it;
-
-				Append(pair->first);
-				Datum& currentDatum = _map[pair->first];
-
-				if (pair->second.Type() == Datum::DatumTypes::Table)
-				{
-					currentDatum.Reserve(pair->second.Size());
-
-					for (size_t i = 0; i < pair->second.Size(); ++i)
-					{
-						Scope* newScope = pair->second[i].Clone();
-						newScope->_parent = this;
-						currentDatum.PushBackScope(newScope);
-					}
-				}
-				else
-					currentDatum = pair->second;
-				++it;
-			}
+			_map = rhs._map;
+			_symbolMap = rhs._symbolMap;
+			CloneCopiedEntries();
 		}
 		return *this;
 	}
@@ -96,9 +63,13 @@ namespace FieaGameEngine
 		if (this != &rhs)
 		{
 			Clear();
+			BumpLayoutGeneration();
 
 			_map = move(rhs._map);
 			_orderVector = move(rhs._orderVector);
+			_symbolMap = move(rhs._symbolMap);
+			_allocator = rhs._allocator;
+			rhs.BumpLayoutGeneration();
 			if (rhs._parent != nullptr)
 				delete(rhs.Orphan());
 		}
@@ -120,6 +91,7 @@ namespace FieaGameEngine
 		if (Size() == 0)
 			return;
 
+		BumpLayoutGeneration();
 		ForEachNestedScope([](Datum& datum)
 			{
 				for (size_t i = 0; i < datum.Size(); ++i)
@@ -128,20 +100,43 @@ namespace FieaGameEngine
 
 		_map.Clear();
 		_orderVector.Clear();
+		_symbolMap.Clear();
 	}
 
-	Datum& Scope::Append(const string& key)
+	Datum& Scope::Append(string_view key)
 	{
-		HashMap<string, Datum>::PairType newPair = make_pair(key, Datum{});
-		pair<HashMap<string, Datum>::Iterator, bool> insertResult = _map.Insert(newPair);
+		HashMap<string, Datum>::Iterator it = _map.Find(key);
+		if (it != _map.end())
+			return it->second;
+
+		return AppendNew(key, Symbol::Intern(key));
+	}
 
-		if (insertResult.second)
-			_orderVector.PushBack(&*(insertResult.first));
+	Datum& Scope::Append(Symbol key)
+	{
+		assert(key.IsValid());
 
-		return insertResult.first->second;
+		HashMap<Symbol, size_t>::Iterator it = _symbolMap.Find(key);
+		if (it != _symbolMap.end())
+			return _orderVector[it->second]->second;
+
+		return AppendNew(key.Name(), key);
 	}
 
-	Scope& Scope::AppendScope(const string& key, const string& concreteType)
+	Datum& Scope::AppendNew(string_view key, Symbol symbol)
+	{
+		BumpLayoutGeneration();
+		HashMap<string, Datum>::Iterator it = _map.Insert(make_pair(string{ key }, Datum{})).first;
+		it->second._allocator = _allocator;
+
+		RelinkOrderVector();
+		_symbolMap.Insert(make_pair(symbol, _orderVector.Size()));
+		_orderVector.PushBack(&*it);
+
+		return it->second;
+	}
+
+	Scope& Scope::AppendScope(string_view key, const string& concreteType)
 	{
 		Datum& appendedDatum = Append(key);
 		if (appendedDatum.Type() != Datum::DatumTypes::Unknown && appendedDatum.Type() != Datum::DatumTypes::Table)
@@ -149,16 +144,16 @@ namespace FieaGameEngine
 
 		Scope* newScope;
 		if (concreteType == "Scope"s)
-			newScope = new Scope{};
+			newScope = new (*_allocator) Scope{ *_allocator };
 		else
-			newScope = Factory<Scope>::Create(concreteType);
+			newScope = Factory<Scope>::Create(concreteType, *_allocator);
 
 		newScope->_parent = this;
 		appendedDatum.PushBackScope(newScope);
 		return *newScope;
 	}
 
-	Datum* Scope::Find(const string& key)
+	Datum* Scope::Find(string_view key)
 	{
 		HashMap<string, Datum>::Iterator it = _map.Find(key);
 		if (it == _map.end())
@@ -167,7 +162,7 @@ namespace FieaGameEngine
 			return &it->second;
 	}
 
-	const Datum* Scope::Find(const string& key) const
+	const Datum* Scope::Find(string_view key) const
 	{
 		HashMap<string, Datum>::ConstIterator it = _map.Find(key);
 		if (it == _map.end())
@@ -176,6 +171,24 @@ namespace FieaGameEngine
 			return &it->second;
 	}
 
+	Datum* Scope::Find(Symbol key)
+	{
+		HashMap<Symbol, size_t>::Iterator it = _symbolMap.Find(key);
+		if (it == _symbolMap.end())
+			return nullptr;
+		else
+			return &_orderVector[it->second]->second;
+	}
+
+	const Datum* Scope::Find(Symbol key) const
+	{
+		HashMap<Symbol, size_t>::ConstIterator it = _symbolMap.Find(key);
+		if (it == _symbolMap.end())
+			return nullptr;
+		else
+			return &_orderVector[it->second]->second;
+	}
+
 	pair<Datum*, size_t> Scope::FindContainedScope(const Scope* scope)
 	{
 		assert(scope != nullptr);
@@ -183,13 +196,17 @@ namespace FieaGameEngine
 		Datum* parentDatum = nullptr;
 		size_t index = 0;
 
-		ForEachNestedScope([&parentDatum, &index, &scope](Datum& datum) 
-			{ 
-				parentDatum = &datum;
-				index = datum.Find(scope); 
-				if (index < datum.Size()) 
-					return;
-				parentDatum = nullptr; 
+		ForEachNestedScope([&parentDatum, &index, &scope](Datum& datum)
+			{
+				// Children are matched by identity; Find would compare them by value.
+				for (size_t i = 0; parentDatum == nullptr && i < datum.Size(); ++i)
+				{
+					if (datum.Get<Scope*>(i) == scope)
+					{
+						parentDatum = &datum;
+						index = i;
+					}
+				}
 			});
 
 		return make_pair(parentDatum, index);
@@ -204,29 +221,49 @@ namespace FieaGameEngine
 
 		ForEachNestedScope([&parentDatum, &index, &scope](Datum& datum)
 			{
-				parentDatum = &datum;
-				index = datum.Find(scope);
-				if (index < datum.Size())
-					return;
-				parentDatum = nullptr;
+				// Children are matched by identity; Find would compare them by value.
+				for (size_t i = 0; parentDatum == nullptr && i < datum.Size(); ++i)
+				{
+					if (datum.Get<Scope*>(i) == scope)
+					{
+						parentDatum = &datum;
+						index = i;
+					}
+				}
 			});
 
 		return make_pair(parentDatum, index);
 	}
 
-	Datum* Scope::Search(const string& key)
+	Datum* Scope::Search(string_view key)
 	{
 		Scope* outScope = this;
 		return Search(key, outScope);
 	}
 
-	const Datum* Scope::Search(const string& key) const
+	const Datum* Scope::Search(string_view key) const
 	{
 		Scope* outScope = const_cast<Scope*>(this);
 		return Search(key, outScope);
 	}
 
-	Datum* Scope::Search(const string& key, Scope*& outScope)
+	Datum* Scope::Search(Symbol key)
+	{
+		Datum* result = Find(key);
+		if (result == nullptr && _parent != nullptr)
+			result = _parent->Search(key);
+		return result;
+	}
+
+	const Datum* Scope::Search(Symbol key) const
+	{
+		const Datum* result = Find(key);
+		if (result == nullptr && _parent != nullptr)
+			result = _parent->Search(key);
+		return result;
+	}
+
+	Datum* Scope::Search(string_view key, Scope*& outScope)
 	{
 		assert(outScope != nullptr);
 
@@ -240,7 +277,7 @@ namespace FieaGameEngine
 		return result;
 	}
 
-	const Datum* Scope::Search(const string& key, Scope*& outScope) const
+	const Datum* Scope::Search(string_view key, Scope*& outScope) const
 	{
 		assert(outScope != nullptr);
 
@@ -252,7 +289,7 @@ namespace FieaGameEngine
 		return result;
 	}
 
-	void Scope::Adopt(Scope& childScope, const string& key)
+	void Scope::Adopt(Scope& childScope, string_view key)
 	{
 		if (&childScope == this || IsDescendantOf(childScope))
 			throw runtime_error("Cannot adopt self or ancestor.");
@@ -263,6 +300,7 @@ namespace FieaGameEngine
 
 		Scope* child = childScope.Orphan();
 		child->_parent = this;
+		child->BumpLayoutGeneration();
 		parentDatum.PushBackScope(child);
 	}
 
@@ -270,9 +308,9 @@ namespace FieaGameEngine
 	{
 		if (_parent != nullptr)
 		{
+			BumpLayoutGeneration();
 			pair<Datum*, size_t> result = _parent->FindContainedScope(this);
 			result.first->RemoveAt(result.second);
-			_parent->_orderVector.Remove(_parent->_orderVector[result.second]);
 			_parent = nullptr;
 		}
 		return this;
@@ -280,7 +318,7 @@ namespace FieaGameEngine
 
 	void Scope::ForEachNestedScope(NestedScopeFunction func) const
 	{
-		Vector<HashMap<string, Datum>::PairType*>::ConstIterator it = _orderVector.begin();
+		OrderVector::ConstIterator it = _orderVector.begin();
 		while (it != _orderVector.end())
 		{
 			Datum& datum = (*it)->second;
@@ -311,7 +349,7 @@ namespace FieaGameEngine
 			return false;
 
 		bool result = true;
-		Vector<HashMap<string, Datum>::PairType*>::ConstIterator otherIt = otherScope->_orderVector.begin();
+		OrderVector::ConstIterator otherIt = otherScope->_orderVector.begin();
 		ForEachNestedScope([&result, &otherIt](Datum& datum) 
 			{ 
 				if (datum != (*otherIt)->second) 
@@ -339,7 +377,7 @@ namespace FieaGameEngine
 		return potentialDescendant.IsDescendantOf(*this);
 	}
 
-	Datum& Scope::operator[](const string& key)
+	Datum& Scope::operator[](string_view key)
 	{
 		return Append(key);
 	}
@@ -374,4 +412,119 @@ namespace FieaGameEngine
 	{
 		return _orderVector.Size();
 	}
+
+	void Scope::Reserve(size_t count)
+	{
+		BumpLayoutGeneration();
+		_map.Reserve(count);
+		_orderVector.Reserve(count);
+		_symbolMap.Reserve(count);
+		RelinkOrderVector();
+	}
+
+	uint64_t Scope::LayoutGeneration() const
+	{
+		return _layoutGeneration;
+	}
+
+	void Scope::BumpLayoutGeneration()
+	{
+		++_layoutGeneration;
+	}
+
+	IAllocator& Scope::GetAllocator() const
+	{
+		return *_allocator;
+	}
+
+	void* Scope::operator new(size_t size)
+	{
+		return operator new(size, IAllocator::Default());
+	}
+
+	void* Scope::operator new(size_t size, IAllocator& allocator)
+	{
+		std::byte* block = reinterpret_cast<std::byte*>(allocator.Allocate(AllocationHeaderSize + size));
+		if (block == nullptr)
+			throw bad_alloc{};
+
+		AllocationHeader* header = reinterpret_cast<AllocationHeader*>(block);
+		header->Allocator = &allocator;
+		header->Size = AllocationHeaderSize + size;
+		return block + AllocationHeaderSize;
+	}
+
+	void Scope::operator delete(void* scope)
+	{
+		if (scope == nullptr)
+			return;
+
+		AllocationHeader* header = reinterpret_cast<AllocationHeader*>(reinterpret_cast<std::byte*>(scope) - AllocationHeaderSize);
+		header->Allocator->Deallocate(header, header->Size);
+	}
+
+	void Scope::operator delete(void* scope, IAllocator&)
+	{
+		operator delete(scope);
+	}
+
+	void Scope::CloneCopiedEntries()
+	{
+		size_t entry = 0;
+		size_t index = 0;
+		try
+		{
+			_orderVector.Clear();
+			_orderVector.Reserve(_map.Size());
+
+			// Only HashMap::Remove reorders the pairs, and Scope never removes keys, so the map's pairs are already in append order.
+			for (HashMap<string, Datum>::Iterator it = _map.begin(); it != _map.end(); ++it)
+				_orderVector.PushBack(&*it);
+
+			for (; entry < _orderVector.Size(); ++entry)
+			{
+				Datum& datum = _orderVector[entry]->second;
+				if (datum.Type() != Datum::DatumTypes::Table)
+					continue;
+
+				for (index = 0; index < datum.Size(); ++index)
+				{
+					Scope* newScope = datum[index].Clone();
+					newScope->_parent = this;
+					datum.Set(newScope, index);
+				}
+			}
+		}
+		catch (...)
+		{
+			// Entries from the one that threw onwards still point at the source's children, so only the clones made so far are deleted,
+			// and "this" is left empty rather than sharing children with the source.
+			for (size_t i = 0; i <= entry && i < _orderVector.Size(); ++i)
+			{
+				Datum& datum = _orderVector[i]->second;
+				if (datum.Type() != Datum::DatumTypes::Table)
+					continue;
+
+				const size_t cloned = i < entry ? datum.Size() : index;
+				for (size_t j = 0; j < cloned; ++j)
+					delete &datum[j];
+			}
+
+			_map.Clear();
+			_orderVector.Clear();
+			_symbolMap.Clear();
+			throw;
+		}
+	}
+
+	void Scope::RelinkOrderVector()
+	{
+		if (_orderVector.IsEmpty() || _orderVector.Front() == &*_map.begin())
+			return;
+
+		// The map stores its pairs contiguously, so growing it relocated all of them. Scope never removes keys, so the map is still in append order.
+		HashMap<string, Datum>::Iterator it = _map.begin();
+		for (size_t i = 0; i < _orderVector.Size(); ++i, ++it)
+			_orderVector[i] = &*it;
+	}
 }
\ No newline at end of file
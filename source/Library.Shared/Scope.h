@@ -1,7 +1,9 @@
 #pragma once
 #include "Datum.h"
 #include "Vector.h"
+#include "SmallVector.h"
 #include "HashMap.h"
+#include "Symbol.h"
 #include <gsl/gsl>
 #include <stdio.h>
 
@@ -10,16 +12,26 @@ namespace FieaGameEngine
 	class Scope : public FieaGameEngine::RTTI
 	{
 		RTTI_DECLARATIONS(Scope, FieaGameEngine::RTTI);
+		friend class PrefabRegistry;
 
 	public:
 		using NestedScopeFunction = std::function<void(Datum&)>;
 
 		/// <summary>
-		/// Constructor for Scope.
+		/// Constructor for Scope, which takes its storage from the default allocator. A Scope placed in another allocator with new (allocator)
+		/// is given that allocator explicitly, as the factories and AppendScope do.
 		/// </summary>
 		/// <param name="capacity"> The capacity with which the Scope is to be initialized with. Defaulted to 17. </param>
 		explicit Scope(std::size_t capacity = 17);
 
+		/// <summary>
+		/// Constructor for Scope that takes its table storage, and that of the Datums appended to it, from the given allocator.
+		/// Scopes created with AppendScope take their own memory and storage from the same allocator, so a whole tree can live in one pool.
+		/// </summary>
+		/// <param name="allocator"> The allocator the Scope takes its storage from. </param>
+		/// <param name="capacity"> The capacity with which the Scope is to be initialized with. Defaulted to 17. </param>
+		explicit Scope(IAllocator& allocator, std::size_t capacity = 17);
+
 		/// <summary>
 		/// Copy constructor for Scope, to construct a Scope by copying over the contents of an existing Scope.
 		/// </summary>
@@ -56,14 +68,28 @@ namespace FieaGameEngine
 		/// </summary>
 		/// <param name="key"> The key with which the Scope is to be queried. </param>
 		/// <returns> The address of the Datum associated with the passed in keu. Returns nullptr if the key was not found. </returns>
-		Datum* Find(const std::string& key);
+		Datum* Find(std::string_view key);
 
 		/// <summary>
 		/// Find function to find the the Datum associated with a given string key. Searches for the key only in "this" Scope.
 		/// </summary>
 		/// <param name="key"> The key with which the Scope is to be queried. </param>
 		/// <returns> The const address of the Datum associated with the passed in keu. Returns nullptr if the key was not found. </returns>
-		const Datum* Find(const std::string& key) const;
+		const Datum* Find(std::string_view key) const;
+
+		/// <summary>
+		/// Find function to find the Datum associated with an interned key. Searches for the key only in "this" Scope, without hashing or comparing any characters.
+		/// </summary>
+		/// <param name="key"> The Symbol with which the Scope is to be queried. </param>
+		/// <returns> The address of the Datum associated with the passed in key. Returns nullptr if the key was not found. </returns>
+		Datum* Find(Symbol key);
+
+		/// <summary>
+		/// Find function to find the Datum associated with an interned key. Searches for the key only in "this" Scope, without hashing or comparing any characters.
+		/// </summary>
+		/// <param name="key"> The Symbol with which the Scope is to be queried. </param>
+		/// <returns> The const address of the Datum associated with the passed in key. Returns nullptr if the key was not found. </returns>
+		const Datum* Find(Symbol key) const;
 
 		/// <summary>
 		/// Function to Find the Datum and index within which the passed in Scope lies. Searches for the Scope only in "this" Scope. 
@@ -86,14 +112,28 @@ namespace FieaGameEngine
 		/// </summary>
 		/// <param name="key"> The key with which the Scope is to be queried. </param>
 		/// <returns> The address of the Datum associated with the passed in key. nullptr if the key was not found. </returns>
-		Datum* Search(const std::string& key);
+		Datum* Search(std::string_view key);
 
 		/// <summary>
 		/// Function to search the Scope for the Datum associated with the passed in key. Searches "this" Scope and all parent Scopes recursively until the key is found.
 		/// </summary>
 		/// <param name="key"> The key with which the Scope is to be queried. </param>
 		/// <returns> The const address of the Datum associated with the passed in key. nullptr if the key was not found. </returns>
-		const Datum* Search(const std::string& key) const;
+		const Datum* Search(std::string_view key) const;
+
+		/// <summary>
+		/// Function to search the Scope for the Datum associated with an interned key. Searches "this" Scope and all parent Scopes recursively until the key is found.
+		/// </summary>
+		/// <param name="key"> The Symbol with which the Scope is to be queried. </param>
+		/// <returns> The address of the Datum associated with the passed in key. nullptr if the key was not found. </returns>
+		Datum* Search(Symbol key);
+
+		/// <summary>
+		/// Function to search the Scope for the Datum associated with an interned key. Searches "this" Scope and all parent Scopes recursively until the key is found.
+		/// </summary>
+		/// <param name="key"> The Symbol with which the Scope is to be queried. </param>
+		/// <returns> The const address of the Datum associated with the passed in key. nullptr if the key was not found. </returns>
+		const Datum* Search(Symbol key) const;
 
 		/// <summary>
 		/// Function to search the Scope for the Datum associated with the passed in key. Searches "this" Scope and all parent Scopes recursively until the key is found.
@@ -101,7 +141,7 @@ namespace FieaGameEngine
 		/// <param name="key"> The key with which the Scope is to be queried. </param>
 		/// <param name="outScope"> Address of Scope to be searched. Used as an output paramater and is set to the Scope within which the given key was found. </param>
 		/// <returns> The address of the Datum associated with the passed in key. nullptr if the key was not found. </returns>
-		Datum* Search(const std::string& key, Scope*& outScope);
+		Datum* Search(std::string_view key, Scope*& outScope);
 
 		/// <summary>
 		/// Function to search the Scope for the Datum associated with the passed in key. Searches "this" Scope and all parent Scopes recursively until the key is found.
@@ -109,14 +149,25 @@ namespace FieaGameEngine
 		/// <param name="key"> The key with which the Scope is to be queried. </param>
 		/// <param name="outScope"> Address of Scope to be searched. Used as an output paramater and is set to the Scope within which the given key was found. </param>
 		/// <returns> The const address of the Datum associated with the passed in key. nullptr if the key was not found. </returns>
-		const Datum* Search(const std::string& key, Scope*& outScope) const;
+		const Datum* Search(std::string_view key, Scope*& outScope) const;
 
 		/// <summary>
 		/// Function to Append a string-Datum pair to the Scope. If the key already exists, the existing Datum associated with the key is returned.
+		/// The key is only copied into a std::string when a new Datum is created, at which point it is also interned for Symbol lookups.
+		/// Interning goes through the symbol table's lock, so code that appends new keys on a hot path should intern its names once and use Append(Symbol).
 		/// </summary>
 		/// <param name="key"> The key with which the new Datum is to be associated with. </param>
 		/// <returns> Reference to the existing/created Datum associated with the key. </returns>
-		Datum& Append(const std::string& key);
+		Datum& Append(std::string_view key);
+
+		/// <summary>
+		/// Function to Append a Datum under an already interned key. If the key already exists, the existing Datum associated with the key is returned.
+		/// Checking for the key only compares Symbols, and nothing takes a lock even when the key is new, so this is the call for hot paths
+		/// whose names were interned ahead of time.
+		/// </summary>
+		/// <param name="key"> The interned key with which the new Datum is to be associated with. Must be valid. </param>
+		/// <returns> Reference to the existing/created Datum associated with the key. </returns>
+		Datum& Append(Symbol key);
 
 		/// <summary>
 		/// Function to append a Datum and then insert a default heap constructed Scope into the Datum with the associated key.
@@ -125,7 +176,7 @@ namespace FieaGameEngine
 		/// /// <param name="concreteType"> The name of the type of the concrete Scope to be created. Defaulted to "Scope". </param>
 		/// <returns> Reference to the newly inserted Scope. </returns>
 		/// <exception cref="runtime_error"> Throws if the appended Datum is not of type Unknown or of type Table. </exception>
-		Scope& AppendScope(const std::string& key, const std::string& concreteType = "Scope");
+		Scope& AppendScope(std::string_view key, const std::string& concreteType = "Scope");
 
 		/// <summary>
 		/// Function to get the parent of the Scope.
@@ -146,7 +197,7 @@ namespace FieaGameEngine
 		/// <param name="key"> The key associated with the Datum into which the Scope is to be inserted. </param>
 		/// <exception cref="runtime_error"> Throws if the appended Datum is not of type Unknown or of type Table. </exception>
 		/// <exception cref="runtime_error"> Throws if the Scope to adopt is the "this" Scope itself, or if it's an ancestor of "this" Scope. </exception>
-		void Adopt(Scope& childScope, const std::string& key);
+		void Adopt(Scope& childScope, std::string_view key);
 
 		/// <summary>
 		/// Function to Orphan the Scope. Removes itself from the Datum of the parent Scope and sets parent to nullptr.
@@ -164,7 +215,7 @@ namespace FieaGameEngine
 		/// </summary>
 		/// <param name="key"> The key with which the Append method is to be called. </param>
 		/// <returns> Reference to the result returned from the Append call. </returns>
-		Datum& operator[](const std::string& key);
+		Datum& operator[](std::string_view key);
 
 		/// <summary>
 		/// Function which returns the Datum at the specified index.
@@ -223,6 +274,40 @@ namespace FieaGameEngine
 		/// <returns> The size of the Scope. </returns>
 		std::size_t Size() const;
 
+		/// <summary>
+		/// Function to make room for a number of keys up front, so that appending up to that many keys does not grow or relocate any storage.
+		/// </summary>
+		/// <param name="count"> The number of keys the Scope should be able to hold. </param>
+		void Reserve(std::size_t count);
+
+		/// <summary>
+		/// Function to get a count of the changes to "this" Scope that may move one of its Datums or change what Search finds through it:
+		/// appending a key, reserving, clearing, being assigned to or moved from, and being adopted or orphaned. Code that caches Datum pointers
+		/// across frames keeps the generation of every Scope along the Search chain, and compares them to know when to look the pointers up again.
+		/// </summary>
+		/// <returns> The current layout generation of "this" Scope. </returns>
+		std::uint64_t LayoutGeneration() const;
+
+		/// <summary>
+		/// Function to get the allocator the Scope takes its storage from.
+		/// </summary>
+		/// <returns> A reference to the allocator. </returns>
+		IAllocator& GetAllocator() const;
+
+		/// <summary>
+		/// Allocation function for Scopes created without an allocator. They are taken from the default allocator.
+		/// </summary>
+		static void* operator new(std::size_t size);
+
+		/// <summary>
+		/// Allocation function for Scopes created with new (allocator) Scope{ allocator, ... }. It only places the object; the allocator for its storage is
+		/// passed to the constructor. Every Scope records the allocator it came from, so deleting it through a Scope pointer always returns the memory to the right place.
+		/// </summary>
+		static void* operator new(std::size_t size, IAllocator& allocator);
+
+		static void operator delete(void* scope);
+		static void operator delete(void* scope, IAllocator& allocator);
+
 	protected:
 		/// <summary>
 		/// Clone function that returns a new heap allocated Scope object, by copy constructing it with "this" Scope.
@@ -232,8 +317,51 @@ namespace FieaGameEngine
 
 		void ForEachNestedScope(NestedScopeFunction func) const;
 
+		/// <summary>
+		/// Function to add a key that is known not to be in the Scope yet, keeping the order vector and Symbol index in step with the map.
+		/// </summary>
+		/// <param name="key"> The key to be added. </param>
+		/// <param name="symbol"> The interned form of the key. </param>
+		/// <returns> Reference to the newly created Datum. </returns>
+		Datum& AppendNew(std::string_view key, Symbol symbol);
+
+		/// <summary>
+		/// Function to finish a copy once the map and Symbol index have been copied wholesale. Rebuilds the order vector over the copied pairs,
+		/// and replaces every nested Scope pointer, which still refers to the source's children, with a clone parented to "this".
+		/// If a clone throws, the clones made so far are deleted and "this" is emptied before rethrowing, so it never shares children with the source.
+		/// </summary>
+		void CloneCopiedEntries();
+
+		/// <summary>
+		/// Function to re-point the order vector at the map's pairs after the map has relocated them.
+		/// </summary>
+		void RelinkOrderVector();
+
+		/// <summary>
+		/// Records a change to "this" Scope that may have moved one of its Datums or changed what Search finds through it.
+		/// </summary>
+		void BumpLayoutGeneration();
+
+		/// <summary>
+		/// Most Scopes hold a handful of entries, so the order vector keeps the first few pointers inline instead of allocating.
+		/// </summary>
+		using OrderVector = SmallVector<HashMap<std::string, Datum>::PairType*, 8>;
+
 		HashMap<std::string, Datum> _map;
-		Vector<HashMap<std::string, Datum>::PairType*> _orderVector;
+		OrderVector _orderVector;
+		HashMap<Symbol, std::size_t> _symbolMap;
 		Scope* _parent { nullptr };
+		IAllocator* _allocator{ &IAllocator::Default() };
+		std::uint64_t _layoutGeneration{ 0 };
+
+	private:
+
+		struct AllocationHeader final
+		{
+			IAllocator* Allocator;
+			std::size_t Size;
+		};
+
+		static constexpr std::size_t AllocationHeaderSize = (sizeof(AllocationHeader) + IAllocator::Alignment - 1) / IAllocator::Alignment * IAllocator::Alignment;
 	};
 }
\ No newline at end of file
@@ -0,0 +1,270 @@
+#pragma once
+#include <cassert>
+#include <cstddef>
+#include <initializer_list>
+#include "IAllocator.h"
+#include "DefaultIncrement.h"
+#include "IsTriviallyRelocatable.h"
+
+namespace FieaGameEngine
+{
+	/// <summary>
+	/// Vector that keeps its first N elements inside the object and only goes to its allocator once it grows past them.
+	/// Meant for the many tiny per-object collections that hold a handful of elements, where a heap allocation each would dominate.
+	/// Unlike Vector, moving a SmallVector that is still inline moves its elements, so pointers to them do not survive the move.
+	/// </summary>
+	/// <typeparam name="T"> The type of the elements. </typeparam>
+	/// <typeparam name="N"> The number of elements stored inline. </typeparam>
+	/// <typeparam name="IncrementFunctor"> Growth policy that is handed the size and capacity of a full SmallVector and returns the capacity to grow to. </typeparam>
+	template <typename T, std::size_t N, typename IncrementFunctor = DefaultIncrement>
+	class SmallVector final
+	{
+		static_assert(N > 0, "SmallVector needs room for at least one inline element.");
+
+	public:
+		using Iterator = T*;
+		using ConstIterator = const T*;
+
+		/// <summary>
+		/// Default constructor for SmallVector. Uses the inline storage and the default allocator.
+		/// </summary>
+		SmallVector() = default;
+
+		/// <summary>
+		/// Parameterized constructor for SmallVector which takes in the allocator the SmallVector spills to once it outgrows its inline storage.
+		/// </summary>
+		/// <param name="allocator"> The allocator the SmallVector takes its storage from. </param>
+		explicit SmallVector(IAllocator& allocator);
+
+		/// <summary>
+		/// Parameterized constructor for SmallVector which takes in a capacity to initialize the SmallVector with.
+		/// </summary>
+		/// <param name="capacity"> Capacity with which the SmallVector is to be initialized. Capacities up to N stay inline. </param>
+		/// <param name="allocator"> The allocator the SmallVector takes its storage from. </param>
+		SmallVector(std::size_t capacity, IAllocator& allocator);
+
+		/// <summary>
+		/// Initializer list constructor for SmallVector.
+		/// </summary>
+		/// <param name="list"> List of elements to initialize the SmallVector with. </param>
+		SmallVector(std::initializer_list<T> list);
+
+		/// <summary>
+		/// Copy constructor for SmallVector. The copy uses the default allocator.
+		/// </summary>
+		/// <param name="other"> Const reference to the SmallVector to be copied. </param>
+		SmallVector(const SmallVector& other);
+
+		/// <summary>
+		/// Move constructor for SmallVector. Heap storage is stolen; inline elements are moved one by one.
+		/// </summary>
+		/// <param name="other"> An rvalue reference to the SmallVector to be moved. </param>
+		SmallVector(SmallVector&& other) noexcept;
+
+		/// <summary>
+		/// Copy assignment operator for SmallVector. Keeps the allocator of "this" SmallVector.
+		/// </summary>
+		/// <param name="rhs"> Const reference to the SmallVector to be copied. </param>
+		/// <returns> A reference to "this" SmallVector. </returns>
+		SmallVector& operator=(const SmallVector& rhs);
+
+		/// <summary>
+		/// Move assignment operator for SmallVector.
+		/// </summary>
+		/// <param name="rhs"> An rvalue reference to the SmallVector to be moved. </param>
+		/// <returns> A reference to "this" SmallVector. </returns>
+		SmallVector& operator=(SmallVector&& rhs) noexcept;
+
+		/// <summary>
+		/// Destructor for SmallVector which destroys the elements and returns any heap storage to the allocator.
+		/// </summary>
+		~SmallVector();
+
+		/// <summary>
+		/// Function to get the number of elements in the SmallVector.
+		/// </summary>
+		/// <returns> The number of elements in the SmallVector. </returns>
+		std::size_t Size() const;
+
+		/// <summary>
+		/// Function to get the number of elements the SmallVector can hold before it has to grow.
+		/// </summary>
+		/// <returns> The capacity of the SmallVector, which is never less than N. </returns>
+		std::size_t Capacity() const;
+
+		/// <summary>
+		/// Function to check if the SmallVector is empty.
+		/// </summary>
+		/// <returns> True if the SmallVector has no elements, false otherwise. </returns>
+		bool IsEmpty() const;
+
+		/// <summary>
+		/// Function to check if the elements are still stored inside the SmallVector.
+		/// </summary>
+		/// <returns> True if no heap storage is in use, false otherwise. </returns>
+		bool IsInline() const;
+
+		/// <summary>
+		/// Function to get the allocator the SmallVector spills to.
+		/// </summary>
+		/// <returns> A reference to the allocator. </returns>
+		IAllocator& GetAllocator() const;
+
+		/// <summary>
+		/// Data method which returns a pointer to the contiguous storage of the SmallVector.
+		/// </summary>
+		/// <returns> A pointer to the first element. </returns>
+		T* Data();
+
+		/// <summary>
+		/// Data method which returns a pointer to the contiguous storage of the SmallVector.
+		/// </summary>
+		/// <returns> A const pointer to the first element. </returns>
+		const T* Data() const;
+
+		/// <summary>
+		/// Random access getter that can be used to find an element at a particular index of the SmallVector.
+		/// </summary>
+		/// <param name="index"> The index of the element that is to be accessed. </param>
+		/// <returns> A reference to the element at the specified index. </returns>
+		T& operator[](std::size_t index);
+
+		/// <summary>
+		/// Random access getter that can be used to find an element at a particular index of the SmallVector.
+		/// </summary>
+		/// <param name="index"> The index of the element that is to be accessed. </param>
+		/// <returns> A const reference to the element at the specified index. </returns>
+		const T& operator[](std::size_t index) const;
+
+		/// <summary>
+		/// Front method which returns a reference to the element at the front of the SmallVector.
+		/// </summary>
+		/// <returns> A reference to the element at the front of the SmallVector. Cannot be discarded. </returns>
+		[[nodiscard]] T& Front();
+
+		/// <summary>
+		/// Front method which returns a const reference to the element at the front of the SmallVector.
+		/// </summary>
+		/// <returns> A const reference to the element at the front of the SmallVector. Cannot be discarded. </returns>
+		[[nodiscard]] const T& Front() const;
+
+		/// <summary>
+		/// Back method which returns a reference to the element at the back of the SmallVector.
+		/// </summary>
+		/// <returns> A reference to the element at the back of the SmallVector. Cannot be discarded. </returns>
+		[[nodiscard]] T& Back();
+
+		/// <summary>
+		/// Back method which returns a const reference to the element at the back of the SmallVector.
+		/// </summary>
+		/// <returns> A const reference to the element at the back of the SmallVector. Cannot be discarded. </returns>
+		[[nodiscard]] const T& Back() const;
+
+		/// <summary>
+		/// Reserve method to make room for a number of elements. Capacities up to N never allocate.
+		/// </summary>
+		/// <param name="capacity"> The number of elements to make room for. </param>
+		void Reserve(std::size_t capacity);
+
+		/// <summary>
+		/// Push back method which appends a copy of an element to the back of the SmallVector.
+		/// </summary>
+		/// <param name="value"> Const reference to the object to be placed at the back of the SmallVector. </param>
+		void PushBack(const T& value);
+
+		/// <summary>
+		/// Push back method which moves an element to the back of the SmallVector.
+		/// </summary>
+		/// <param name="value"> An rvalue reference to the object to be placed at the back of the SmallVector. </param>
+		void PushBack(T&& value);
+
+		/// <summary>
+		/// Constructs an element in place at the back of the SmallVector.
+		/// </summary>
+		/// <param name="args"> The arguments to be forwarded to the constructor of the element. </param>
+		/// <returns> A reference to the new element. </returns>
+		template <typename... Args>
+		T& EmplaceBack(Args&&... args);
+
+		/// <summary>
+		/// PopBack method which destroys the element at the back of the SmallVector.
+		/// </summary>
+		void PopBack();
+
+		/// <summary>
+		/// Destroys every element, but does not affect capacity.
+		/// </summary>
+		void Clear();
+
+		/// <summary>
+		/// Shrinks the capacity to match the size, moving the elements back inline if they fit.
+		/// </summary>
+		void ShrinkToFit();
+
+		/// <summary>
+		/// Find method that can be used to find a specific element in the SmallVector.
+		/// </summary>
+		/// <param name="value"> The value which is to be searched for. </param>
+		/// <returns> An Iterator to the first matching element if found, end() otherwise. </returns>
+		Iterator Find(const T& value);
+
+		/// <summary>
+		/// Find method that can be used to find a specific element in the SmallVector.
+		/// </summary>
+		/// <param name="value"> The value which is to be searched for. </param>
+		/// <returns> A ConstIterator to the first matching element if found, end() otherwise. </returns>
+		ConstIterator Find(const T& value) const;
+
+		/// <summary>
+		/// Remove method which removes the first element equal to a value, shifting the later elements down.
+		/// </summary>
+		/// <param name="value"> The value to be removed. </param>
+		/// <returns> True if an element was removed, false if none matched. </returns>
+		bool Remove(const T& value);
+
+		/// <summary>
+		/// Remove method which removes every element in the range [first, last).
+		/// </summary>
+		/// <param name="first"> ConstIterator to the first element to be removed. </param>
+		/// <param name="last"> ConstIterator one past the last element to be removed. </param>
+		/// <returns> True if any elements were removed, false if the range was empty or invalid. </returns>
+		bool Remove(ConstIterator first, ConstIterator last);
+
+		Iterator begin();
+		ConstIterator begin() const;
+		ConstIterator cbegin() const;
+		Iterator end();
+		ConstIterator end() const;
+		ConstIterator cend() const;
+
+	private:
+		/// <summary>
+		/// Gets a pointer to the inline storage.
+		/// </summary>
+		T* InlineData();
+
+		/// <summary>
+		/// Moves the elements into storage of the given capacity, which is the inline storage if the capacity is N.
+		/// </summary>
+		/// <param name="capacity"> The capacity of the new storage. Must be at least the size of the SmallVector and at least N. </param>
+		void Reallocate(std::size_t capacity);
+
+		/// <summary>
+		/// Moves count elements from source into uninitialized destination storage and destroys the originals.
+		/// </summary>
+		static void Relocate(T* destination, T* source, std::size_t count);
+
+		/// <summary>
+		/// Takes over the elements of another SmallVector, leaving it empty and inline.
+		/// </summary>
+		void Steal(SmallVector& other);
+
+		T* _data{ InlineData() };
+		std::size_t _size{ 0 };
+		std::size_t _capacity{ N };
+		IAllocator* _allocator{ &IAllocator::Default() };
+		alignas(T) std::byte _inline[N * sizeof(T)];
+	};
+}
+
+#include "SmallVector.inl"
@@ -0,0 +1,387 @@
+#include "SmallVector.h"
+#include <cstring>
+#include <stdexcept>
+
+namespace FieaGameEngine
+{
+	template <typename T, std::size_t N, typename IncrementFunctor>
+	SmallVector<T, N, IncrementFunctor>::SmallVector(IAllocator& allocator)
+		: _allocator{ &allocator }
+	{
+	}
+
+	template <typename T, std::size_t N, typename IncrementFunctor>
+	SmallVector<T, N, IncrementFunctor>::SmallVector(std::size_t capacity, IAllocator& allocator)
+		: _allocator{ &allocator }
+	{
+		Reserve(capacity);
+	}
+
+	template <typename T, std::size_t N, typename IncrementFunctor>
+	SmallVector<T, N, IncrementFunctor>::SmallVector(std::initializer_list<T> list)
+	{
+		Reserve(list.size());
+		for (const auto& value : list)
+			EmplaceBack(value);
+	}
+
+	template <typename T, std::size_t N, typename IncrementFunctor>
+	SmallVector<T, N, IncrementFunctor>::SmallVector(const SmallVector& other)
+	{
+		Reserve(other._size);
+		for (std::size_t i = 0; i < other._size; ++i)
+			EmplaceBack(other._data[i]);
+	}
+
+	template <typename T, std::size_t N, typename IncrementFunctor>
+	SmallVector<T, N, IncrementFunctor>::SmallVector(SmallVector&& other) noexcept
+		: _allocator{ other._allocator }
+	{
+		Steal(other);
+	}
+
+	template <typename T, std::size_t N, typename IncrementFunctor>
+	SmallVector<T, N, IncrementFunctor>& SmallVector<T, N, IncrementFunctor>::operator=(const SmallVector& rhs)
+	{
+		if (this != &rhs)
+		{
+			Clear();
+			Reserve(rhs._size);
+			for (std::size_t i = 0; i < rhs._size; ++i)
+				EmplaceBack(rhs._data[i]);
+		}
+		return *this;
+	}
+
+	template <typename T, std::size_t N, typename IncrementFunctor>
+	SmallVector<T, N, IncrementFunctor>& SmallVector<T, N, IncrementFunctor>::operator=(SmallVector&& rhs) noexcept
+	{
+		if (this != &rhs)
+		{
+			Clear();
+			ShrinkToFit();
+			_allocator = rhs._allocator;
+			Steal(rhs);
+		}
+		return *this;
+	}
+
+	template <typename T, std::size_t N, typename IncrementFunctor>
+	SmallVector<T, N, IncrementFunctor>::~SmallVector()
+	{
+		Clear();
+		if (!IsInline())
+			_allocator->Deallocate(_data, _capacity * sizeof(T));
+	}
+
+	template <typename T, std::size_t N, typename IncrementFunctor>
+	inline std::size_t SmallVector<T, N, IncrementFunctor>::Size() const
+	{
+		return _size;
+	}
+
+	template <typename T, std::size_t N, typename IncrementFunctor>
+	inline std::size_t SmallVector<T, N, IncrementFunctor>::Capacity() const
+	{
+		return _capacity;
+	}
+
+	template <typename T, std::size_t N, typename IncrementFunctor>
+	inline bool SmallVector<T, N, IncrementFunctor>::IsEmpty() const
+	{
+		return _size == 0;
+	}
+
+	template <typename T, std::size_t N, typename IncrementFunctor>
+	inline bool SmallVector<T, N, IncrementFunctor>::IsInline() const
+	{
+		return _data == reinterpret_cast<const T*>(_inline);
+	}
+
+	template <typename T, std::size_t N, typename IncrementFunctor>
+	inline IAllocator& SmallVector<T, N, IncrementFunctor>::GetAllocator() const
+	{
+		return *_allocator;
+	}
+
+	template <typename T, std::size_t N, typename IncrementFunctor>
+	inline T* SmallVector<T, N, IncrementFunctor>::Data()
+	{
+		return _data;
+	}
+
+	template <typename T, std::size_t N, typename IncrementFunctor>
+	inline const T* SmallVector<T, N, IncrementFunctor>::Data() const
+	{
+		return _data;
+	}
+
+	template <typename T, std::size_t N, typename IncrementFunctor>
+	inline T& SmallVector<T, N, IncrementFunctor>::operator[](std::size_t index)
+	{
+		if (index >= _size)
+			throw std::out_of_range("Index out of range.");
+
+		return _data[index];
+	}
+
+	template <typename T, std::size_t N, typename IncrementFunctor>
+	inline const T& SmallVector<T, N, IncrementFunctor>::operator[](std::size_t index) const
+	{
+		if (index >= _size)
+			throw std::out_of_range("Index out of range.");
+
+		return _data[index];
+	}
+
+	template <typename T, std::size_t N, typename IncrementFunctor>
+	inline T& SmallVector<T, N, IncrementFunctor>::Front()
+	{
+		if (_size == 0)
+			throw std::runtime_error("Array is empty.");
+
+		return _data[0];
+	}
+
+	template <typename T, std::size_t N, typename IncrementFunctor>
+	inline const T& SmallVector<T, N, IncrementFunctor>::Front() const
+	{
+		if (_size == 0)
+			throw std::runtime_error("Array is empty.");
+
+		return _data[0];
+	}
+
+	template <typename T, std::size_t N, typename IncrementFunctor>
+	inline T& SmallVector<T, N, IncrementFunctor>::Back()
+	{
+		if (_size == 0)
+			throw std::runtime_error("Array is empty.");
+
+		return _data[_size - 1];
+	}
+
+	template <typename T, std::size_t N, typename IncrementFunctor>
+	inline const T& SmallVector<T, N, IncrementFunctor>::Back() const
+	{
+		if (_size == 0)
+			throw std::runtime_error("Array is empty.");
+
+		return _data[_size - 1];
+	}
+
+	template <typename T, std::size_t N, typename IncrementFunctor>
+	void SmallVector<T, N, IncrementFunctor>::Reserve(std::size_t capacity)
+	{
+		if (capacity > _capacity)
+			Reallocate(capacity);
+	}
+
+	template <typename T, std::size_t N, typename IncrementFunctor>
+	inline void SmallVector<T, N, IncrementFunctor>::PushBack(const T& value)
+	{
+		EmplaceBack(value);
+	}
+
+	template <typename T, std::size_t N, typename IncrementFunctor>
+	inline void SmallVector<T, N, IncrementFunctor>::PushBack(T&& value)
+	{
+		EmplaceBack(std::move(value));
+	}
+
+	template <typename T, std::size_t N, typename IncrementFunctor>
+	template <typename... Args>
+	T& SmallVector<T, N, IncrementFunctor>::EmplaceBack(Args&&... args)
+	{
+		if (_size == _capacity)
+			Reallocate(std::max(IncrementFunctor{}(_size, _capacity), _size + 1));
+
+		T* element = new (_data + _size) T(std::forward<Args>(args)...);
+		++_size;
+		return *element;
+	}
+
+	template <typename T, std::size_t N, typename IncrementFunctor>
+	void SmallVector<T, N, IncrementFunctor>::PopBack()
+	{
+		if (_size == 0)
+			return;
+
+		_data[--_size].~T();
+	}
+
+	template <typename T, std::size_t N, typename IncrementFunctor>
+	void SmallVector<T, N, IncrementFunctor>::Clear()
+	{
+		for (std::size_t i = 0; i < _size; ++i)
+			_data[i].~T();
+		_size = 0;
+	}
+
+	template <typename T, std::size_t N, typename IncrementFunctor>
+	void SmallVector<T, N, IncrementFunctor>::ShrinkToFit()
+	{
+		std::size_t capacity = std::max(_size, N);
+		if (capacity != _capacity)
+			Reallocate(capacity);
+	}
+
+	template <typename T, std::size_t N, typename IncrementFunctor>
+	typename SmallVector<T, N, IncrementFunctor>::Iterator SmallVector<T, N, IncrementFunctor>::Find(const T& value)
+	{
+		Iterator it = begin();
+		while (it != end() && !(*it == value))
+			++it;
+		return it;
+	}
+
+	template <typename T, std::size_t N, typename IncrementFunctor>
+	typename SmallVector<T, N, IncrementFunctor>::ConstIterator SmallVector<T, N, IncrementFunctor>::Find(const T& value) const
+	{
+		ConstIterator it = begin();
+		while (it != end() && !(*it == value))
+			++it;
+		return it;
+	}
+
+	template <typename T, std::size_t N, typename IncrementFunctor>
+	bool SmallVector<T, N, IncrementFunctor>::Remove(const T& value)
+	{
+		ConstIterator it = Find(value);
+		return it != end() && Remove(it, it + 1);
+	}
+
+	template <typename T, std::size_t N, typename IncrementFunctor>
+	bool SmallVector<T, N, IncrementFunctor>::Remove(ConstIterator first, ConstIterator last)
+	{
+		if (first >= last || first < _data || last > _data + _size)
+			return false;
+
+		std::size_t index = static_cast<std::size_t>(first - _data);
+		std::size_t count = static_cast<std::size_t>(last - first);
+
+		if constexpr (IsTriviallyRelocatable<T>::value)
+		{
+			for (std::size_t i = index; i < index + count; ++i)
+				_data[i].~T();
+			std::memmove(static_cast<void*>(_data + index), _data + index + count, sizeof(T) * (_size - index - count));
+		}
+		else
+		{
+			std::move(_data + index + count, _data + _size, _data + index);
+			for (std::size_t i = _size - count; i < _size; ++i)
+				_data[i].~T();
+		}
+		_size -= count;
+		return true;
+	}
+
+	template <typename T, std::size_t N, typename IncrementFunctor>
+	inline typename SmallVector<T, N, IncrementFunctor>::Iterator SmallVector<T, N, IncrementFunctor>::begin()
+	{
+		return _data;
+	}
+
+	template <typename T, std::size_t N, typename IncrementFunctor>
+	inline typename SmallVector<T, N, IncrementFunctor>::ConstIterator SmallVector<T, N, IncrementFunctor>::begin() const
+	{
+		return _data;
+	}
+
+	template <typename T, std::size_t N, typename IncrementFunctor>
+	inline typename SmallVector<T, N, IncrementFunctor>::ConstIterator SmallVector<T, N, IncrementFunctor>::cbegin() const
+	{
+		return _data;
+	}
+
+	template <typename T, std::size_t N, typename IncrementFunctor>
+	inline typename SmallVector<T, N, IncrementFunctor>::Iterator SmallVector<T, N, IncrementFunctor>::end()
+	{
+		return _data + _size;
+	}
+
+	template <typename T, std::size_t N, typename IncrementFunctor>
+	inline typename SmallVector<T, N, IncrementFunctor>::ConstIterator SmallVector<T, N, IncrementFunctor>::end() const
+	{
+		return _data + _size;
+	}
+
+	template <typename T, std::size_t N, typename IncrementFunctor>
+	inline typename SmallVector<T, N, IncrementFunctor>::ConstIterator SmallVector<T, N, IncrementFunctor>::cend() const
+	{
+		return _data + _size;
+	}
+
+	template <typename T, std::size_t N, typename IncrementFunctor>
+	inline T* SmallVector<T, N, IncrementFunctor>::InlineData()
+	{
+		return reinterpret_cast<T*>(_inline);
+	}
+
+	template <typename T, std::size_t N, typename IncrementFunctor>
+	void SmallVector<T, N, IncrementFunctor>::Reallocate(std::size_t capacity)
+	{
+		assert(capacity >= _size && capacity >= N);
+
+		T* data;
+		if (capacity == N)
+			data = InlineData();
+		else if (!IsInline() && IsTriviallyRelocatable<T>::value)
+		{
+			data = reinterpret_cast<T*>(_allocator->Reallocate(_data, _capacity * sizeof(T), capacity * sizeof(T)));
+			assert(data != nullptr);
+			_data = data;
+			_capacity = capacity;
+			return;
+		}
+		else
+			data = reinterpret_cast<T*>(_allocator->Allocate(capacity * sizeof(T)));
+		assert(data != nullptr);
+
+		if (data == _data)
+			return;
+
+		Relocate(data, _data, _size);
+		if (!IsInline())
+			_allocator->Deallocate(_data, _capacity * sizeof(T));
+
+		_data = data;
+		_capacity = capacity;
+	}
+
+	template <typename T, std::size_t N, typename IncrementFunctor>
+	void SmallVector<T, N, IncrementFunctor>::Relocate(T* destination, T* source, std::size_t count)
+	{
+		if constexpr (IsTriviallyRelocatable<T>::value)
+		{
+			if (count > 0)
+				std::memcpy(static_cast<void*>(destination), source, sizeof(T) * count);
+		}
+		else
+		{
+			for (std::size_t i = 0; i < count; ++i)
+			{
+				new (destination + i) T(std::move(source[i]));
+				source[i].~T();
+			}
+		}
+	}
+
+	template <typename T, std::size_t N, typename IncrementFunctor>
+	void SmallVector<T, N, IncrementFunctor>::Steal(SmallVector& other)
+	{
+		assert(IsInline() && _size == 0);
+
+		if (other.IsInline())
+			Relocate(InlineData(), other._data, other._size);
+		else
+		{
+			_data = other._data;
+			_capacity = other._capacity;
+			other._data = other.InlineData();
+			other._capacity = N;
+		}
+		_size = other._size;
+		other._size = 0;
+	}
+}
@@ -1,10 +1,16 @@
 #pragma once
-#include "SList.h"
+#include "Vector.h"
 #include <cstddef>
 
 namespace FieaGameEngine
 {
-	template <typename T>
+	/// <summary>
+	/// Last in, first out adaptor over a contiguous container, so pushes and pops reuse the same storage and Top is a single index.
+	/// The container defaults to Vector; use SmallVector&lt;T, N&gt; to keep shallow stacks free of allocations, or FixedStack for a hard bound.
+	/// </summary>
+	/// <typeparam name="T"> The type of the elements. </typeparam>
+	/// <typeparam name="Container"> Contiguous container providing EmplaceBack, PopBack, Back, Size, IsEmpty, Clear and Reserve. </typeparam>
+	template <typename T, typename Container = Vector<T>>
 	class Stack final
 	{
 	public:
@@ -15,6 +21,10 @@ namespace FieaGameEngine
 
 		void Push(T&& value);
 
+		/// <summary>
+		/// Removes the element at the top of the Stack.
+		/// </summary>
+		/// <exception cref="runtime_error"> Throws if the Stack is empty. </exception>
 		void Pop();
 
 		[[nodiscard]] T& Top();
@@ -25,8 +35,14 @@ namespace FieaGameEngine
 
 		void Clear();
 
+		/// <summary>
+		/// Makes room for a number of elements up front, so pushing up to that depth never reallocates.
+		/// </summary>
+		/// <param name="capacity"> The depth to make room for. </param>
+		void Reserve(std::size_t capacity);
+
 	private:
-		SList<T> _list;
+		Container _container;
 	};
 }
 #include "Stack.inl"
\ No newline at end of file
@@ -3,58 +3,67 @@
 
 namespace FieaGameEngine
 {
-	template<typename T>
+	template<typename T, typename Container>
 	template<typename... Args>
-	inline void Stack<T>::Emplace(Args&&... args)
+	inline void Stack<T, Container>::Emplace(Args&&... args)
 	{
-		_list.PushFront(std::forward<Args>(args)...);
+		_container.EmplaceBack(std::forward<Args>(args)...);
 	}
 
-	template<typename T>
-	inline void Stack<T>::Push(const T& value)
+	template<typename T, typename Container>
+	inline void Stack<T, Container>::Push(const T& value)
 	{
-		_list.PushFront(value);
+		_container.EmplaceBack(value);
 	}
 
-	template<typename T>
-	inline void Stack<T>::Push(T&& value)
+	template<typename T, typename Container>
+	inline void Stack<T, Container>::Push(T&& value)
 	{
-		_list.PushFront(std::move(value));
+		_container.EmplaceBack(std::move(value));
 	}
 
-	template<typename T>
-	inline void Stack<T>::Pop()
+	template<typename T, typename Container>
+	inline void Stack<T, Container>::Pop()
 	{
-		_list.PopFront();
+		if (_container.IsEmpty())
+			throw std::runtime_error("Stack is empty.");
+
+		_container.PopBack();
+	}
+
+	template<typename T, typename Container>
+	inline T& Stack<T, Container>::Top()
+	{
+		return _container.Back();
 	}
 
-	template<typename T>
-	inline T& Stack<T>::Top()
+	template<typename T, typename Container>
+	inline const T& Stack<T, Container>::Top() const
 	{
-		return _list.Front();
+		return _container.Back();
 	}
 
-	template<typename T>
-	inline const T& Stack<T>::Top() const
+	template<typename T, typename Container>
+	inline std::size_t Stack<T, Container>::Size() const
 	{
-		return _list.Front();
+		return _container.Size();
 	}
 
-	template<typename T>
-	inline std::size_t Stack<T>::Size() const
+	template<typename T, typename Container>
+	inline bool Stack<T, Container>::IsEmpty() const
 	{
-		return _list.Size();
+		return _container.IsEmpty();
 	}
 
-	template<typename T>
-	inline bool Stack<T>::IsEmpty() const
+	template<typename T, typename Container>
+	inline void Stack<T, Container>::Clear()
 	{
-		return _list.Size() == 0;
+		_container.Clear();
 	}
 
-	template<typename T>
-	inline void Stack<T>::Clear()
+	template<typename T, typename Container>
+	inline void Stack<T, Container>::Reserve(std::size_t capacity)
 	{
-		return _list.Clear();
+		_container.Reserve(capacity);
 	}
 }
\ No newline at end of file
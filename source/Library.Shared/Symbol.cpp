@@ -0,0 +1,145 @@
+#pragma once
+#include "pch.h"
+#include "Symbol.h"
+#include "SList.h"
+#include "HashMap.h"
+#include <atomic>
+#include <bit>
+#include <mutex>
+#include <shared_mutex>
+
+#if defined(_MSC_VER) && (defined(DEBUG) || defined(_DEBUG))
+#include <crtdbg.h>
+#endif
+
+using namespace std;
+
+namespace FieaGameEngine
+{
+	namespace
+	{
+		/// <summary>
+		/// Interned names live for the rest of the program, so the debug CRT is told not to track them; otherwise they would show up as leaks between memory checkpoints.
+		/// </summary>
+		struct LeakCheckExemption final
+		{
+#if defined(_MSC_VER) && (defined(DEBUG) || defined(_DEBUG))
+			LeakCheckExemption()
+				: _previousFlags{ _CrtSetDbgFlag(_CRTDBG_REPORT_FLAG) }
+			{
+				_CrtSetDbgFlag(_previousFlags & ~_CRTDBG_ALLOC_MEM_DF);
+			}
+
+			~LeakCheckExemption()
+			{
+				_CrtSetDbgFlag(_previousFlags);
+			}
+
+			int _previousFlags;
+#endif
+		};
+
+		struct SymbolTable final
+		{
+			static constexpr size_t FirstNameBlockSize = 64;
+			static constexpr size_t NameBlockCount = 26;
+
+			~SymbolTable()
+			{
+				for (atomic<string_view*>& block : NameBlocks)
+					delete[] block.load(memory_order_relaxed);
+			}
+
+			/// <summary>
+			/// Finds the entry for an ID in NameBlocks. Block k holds FirstNameBlockSize &lt;&lt; k names.
+			/// </summary>
+			string_view& NameAt(Symbol::IdType id)
+			{
+				const size_t blockIndex = static_cast<size_t>(bit_width(id / FirstNameBlockSize + 1)) - 1;
+				const size_t firstId = FirstNameBlockSize * ((size_t(1) << blockIndex) - 1);
+				return NameBlocks[blockIndex].load(memory_order_acquire)[id - firstId];
+			}
+
+			/// <summary>
+			/// Owns the interned strings. List nodes never move, so the views in Ids and NameBlocks stay valid as the table grows.
+			/// </summary>
+			SList<string> Storage;
+
+			/// <summary>
+			/// The name of every Symbol by ID, in blocks that are never moved, so that Name can read them without the lock.
+			/// A name is written before its Symbol is handed out, and is never written again.
+			/// </summary>
+			atomic<string_view*> NameBlocks[NameBlockCount]{};
+			size_t NameCount{ 0 };
+
+			HashMap<string_view, Symbol::IdType> Ids{ 61 };
+
+			/// <summary>
+			/// Held shared by readers of Ids and exclusively while a name is added, since Ids moves its contents as it grows.
+			/// </summary>
+			shared_mutex Mutex;
+		};
+
+		SymbolTable& Table()
+		{
+			[[maybe_unused]] LeakCheckExemption exemption;
+			static SymbolTable table;
+			return table;
+		}
+	}
+
+	Symbol Symbol::Intern(string_view name)
+	{
+		[[maybe_unused]] LeakCheckExemption exemption;
+		SymbolTable& table = Table();
+		{
+			shared_lock lock{ table.Mutex };
+			HashMap<string_view, IdType>::Iterator it = table.Ids.Find(name);
+			if (it != table.Ids.end())
+				return Symbol{ it->second };
+		}
+
+		// Another thread may have added the name between the two locks.
+		unique_lock lock{ table.Mutex };
+		HashMap<string_view, IdType>::Iterator it = table.Ids.Find(name);
+		if (it != table.Ids.end())
+			return Symbol{ it->second };
+
+		assert(table.NameCount < InvalidId);
+		IdType id = static_cast<IdType>(table.NameCount);
+		const size_t blockIndex = static_cast<size_t>(bit_width(id / SymbolTable::FirstNameBlockSize + 1)) - 1;
+		if (blockIndex == SymbolTable::NameBlockCount)
+			throw runtime_error("Symbol table is full.");
+		if (table.NameBlocks[blockIndex].load(memory_order_relaxed) == nullptr)
+			table.NameBlocks[blockIndex].store(new string_view[SymbolTable::FirstNameBlockSize << blockIndex], memory_order_release);
+
+		string_view storedName = *table.Storage.PushBack(string{ name });
+		table.NameAt(id) = storedName;
+		table.Ids.Insert(make_pair(storedName, id));
+		++table.NameCount;
+		return Symbol{ id };
+	}
+
+	Symbol Symbol::Lookup(string_view name)
+	{
+		SymbolTable& table = Table();
+		shared_lock lock{ table.Mutex };
+		HashMap<string_view, IdType>::ConstIterator it = table.Ids.Find(name);
+		return it == table.Ids.end() ? Symbol{} : Symbol{ it->second };
+	}
+
+	size_t Symbol::Count()
+	{
+		SymbolTable& table = Table();
+		shared_lock lock{ table.Mutex };
+		return table.NameCount;
+	}
+
+	string_view Symbol::Name() const
+	{
+		if (!IsValid())
+			return string_view{};
+
+		return Table().NameAt(_id);
+	}
+}
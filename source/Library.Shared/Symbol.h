@@ -0,0 +1,82 @@
+#pragma once
+#include "DefaultHash.h"
+#include <cstdint>
+#include <string_view>
+
+namespace FieaGameEngine
+{
+	/// <summary>
+	/// Compact handle to an interned name. Interning the same name twice yields the same Symbol, so comparing and hashing Symbols never touches the characters.
+	/// The symbol table may be read and grown from several threads at once, such as jobs of a parallel GameObject update appending new keys.
+	/// Interning and Lookup take a shared lock, and interning a name that has not been seen before an exclusive one, so names are best interned
+	/// once, while loading or registering types. Name and everything else on a Symbol that has already been interned take no lock.
+	/// </summary>
+	class Symbol final
+	{
+	public:
+		using IdType = std::uint32_t;
+
+		static constexpr IdType InvalidId = UINT32_MAX;
+
+		/// <summary>
+		/// Default constructor for Symbol. Creates an invalid Symbol that does not name anything.
+		/// </summary>
+		Symbol() = default;
+
+		/// <summary>
+		/// Function to get the Symbol for a given name, adding the name to the symbol table if it has not been seen before.
+		/// </summary>
+		/// <param name="name"> The name to be interned. </param>
+		/// <returns> The Symbol associated with the name. </returns>
+		static Symbol Intern(std::string_view name);
+
+		/// <summary>
+		/// Function to get the Symbol for a given name without adding it to the symbol table.
+		/// </summary>
+		/// <param name="name"> The name to be looked up. </param>
+		/// <returns> The Symbol associated with the name, or an invalid Symbol if the name was never interned. </returns>
+		static Symbol Lookup(std::string_view name);
+
+		/// <summary>
+		/// Function to get the number of names that have been interned.
+		/// </summary>
+		/// <returns> The number of distinct names in the symbol table. </returns>
+		static std::size_t Count();
+
+		/// <summary>
+		/// Function to get the name this Symbol was interned from. Takes no lock, so it is safe to call while other threads intern new names.
+		/// </summary>
+		/// <returns> A view of the interned name, which stays valid for the lifetime of the program. Empty if the Symbol is invalid. </returns>
+		std::string_view Name() const;
+
+		/// <summary>
+		/// Function to get the numeric ID of the Symbol. IDs are handed out densely, starting at 0.
+		/// </summary>
+		/// <returns> The ID of the Symbol. </returns>
+		inline IdType Id() const { return _id; }
+
+		/// <summary>
+		/// Function to check if the Symbol names anything.
+		/// </summary>
+		/// <returns> True if the Symbol was produced by interning a name, false if it is invalid. </returns>
+		inline bool IsValid() const { return _id != InvalidId; }
+
+		inline bool operator==(const Symbol& rhs) const { return _id == rhs._id; }
+		inline bool operator!=(const Symbol& rhs) const { return _id != rhs._id; }
+
+	private:
+		explicit Symbol(IdType id) : _id{ id } {}
+
+		IdType _id{ InvalidId };
+	};
+
+	template<>
+	struct DefaultHash<Symbol> final
+	{
+		std::size_t operator()(const Symbol& key)
+		{
+			// IDs are dense, so a Fibonacci multiply is enough to spread them over the table.
+			return static_cast<std::size_t>(key.Id() * 0x9E3779B97F4A7C15ull);
+		}
+	};
+}
@@ -1,5 +1,6 @@
 #include "TableParseHelper.h"
 #include "Factory.h"
+#include "Attributed.h"
 
 using namespace std;
 
@@ -20,6 +21,8 @@ namespace FieaGameEngine
 		if (tableWrapper == nullptr)
 			return false;
 
+		RootScope(*tableWrapper);
+
 		if (key == "type"s)
 		{
 			assert(value.isString());
@@ -60,7 +63,13 @@ namespace FieaGameEngine
 			return false;
 
 		if (_contextStack.Top().key == ""s)
+		{
+			// The table is complete, so anything derived from its attributes can now be resolved.
+			Scope* scope = _contextStack.Top().scope;
+			if (scope->Is(Attributed::TypeIdClass()))
+				static_cast<Attributed*>(scope)->PostLoad();
 			_contextStack.Pop();
+		}
 
 		if (key == _contextStack.Top().key)
 			_contextStack.Pop();
@@ -75,9 +84,6 @@ namespace FieaGameEngine
 
 	void TableParseHelper::Initialize()
 	{
-		Scope* rootScope = new Scope();
-		_contextStack.Push(TableWrapper::Context("root"s, rootScope));
-
 		_datumTypeMap.Insert(make_pair("integer"s, Datum::DatumTypes::Integer));
 		_datumTypeMap.Insert(make_pair("float"s, Datum::DatumTypes::Float));
 		_datumTypeMap.Insert(make_pair("string"s, Datum::DatumTypes::String));
@@ -86,6 +92,16 @@ namespace FieaGameEngine
 		_datumTypeMap.Insert(make_pair("table"s, Datum::DatumTypes::Table));
 	}
 
+	Scope& TableParseHelper::RootScope(TableWrapper& wrapper)
+	{
+		if (_contextStack.IsEmpty())
+		{
+			IAllocator& allocator = wrapper.GetAllocator();
+			_contextStack.Push(TableWrapper::Context("root"s, new (allocator) Scope{ allocator }));
+		}
+		return *_contextStack.Top().scope;
+	}
+
 	void TableParseHelper::SetDatumValue(Datum& datum, const Json::Value& value, size_t index)
 	{
 		switch (datum.Type())
@@ -143,13 +159,17 @@ namespace FieaGameEngine
 		if (tableWrapper == nullptr)
 			return false;
 
-		tableWrapper->Data = make_shared<Scope>(move(* _contextStack.Top().scope));
+		Scope* rootScope = &RootScope(*tableWrapper);
+		tableWrapper->Data = make_shared<Scope>(move(*rootScope));
+		delete(rootScope);
+		_contextStack.Clear();
 		return true;
 	}
 
 	TableParseHelper::~TableParseHelper()
 	{
-		delete(_contextStack.Top().scope);
+		if (!_contextStack.IsEmpty())
+			delete(_contextStack.Top().scope);
 	}
 
 }
\ No newline at end of file
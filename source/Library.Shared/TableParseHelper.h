@@ -87,6 +87,13 @@ namespace FieaGameEngine
 		bool EndHandler(JsonParseCoordinator::Wrapper& wrapper, const std::string& key) override;
 
 	private:
+		/// <summary>
+		/// Gets the Scope that the document is being loaded into, creating it in the Wrapper's allocator when a new document starts.
+		/// </summary>
+		/// <param name="wrapper"> The Wrapper the document is being loaded for. </param>
+		/// <returns> A reference to the root Scope. </returns>
+		Scope& RootScope(TableWrapper& wrapper);
+
 		/// <summary>
 		/// Sets the value of the Datum's element at the specified inde to the passed in value.
 		/// </summary>
@@ -0,0 +1,96 @@
+#include "pch.h"
+#include "TransformKernels.h"
+
+#if !defined(FIEA_NO_SIMD) && defined(__AVX__)
+#define TRANSFORM_KERNELS_AVX
+#define TRANSFORM_KERNELS_SSE
+#include <immintrin.h>
+#elif !defined(FIEA_NO_SIMD) && (defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2))
+#define TRANSFORM_KERNELS_SSE
+#include <emmintrin.h>
+#endif
+
+using namespace std;
+
+namespace FieaGameEngine
+{
+	static_assert(sizeof(glm::vec4) == 4 * sizeof(float), "TransformKernels treat a run of vec4s as a run of floats.");
+
+	void TransformKernels::Translate(span<glm::vec4> values, const glm::vec4& offset)
+	{
+		size_t i = 0;
+#if defined(TRANSFORM_KERNELS_SSE)
+		float* data = reinterpret_cast<float*>(values.data());
+#if defined(TRANSFORM_KERNELS_AVX)
+		const __m256 offset8 = _mm256_setr_ps(offset.x, offset.y, offset.z, offset.w, offset.x, offset.y, offset.z, offset.w);
+		for (; i + 2 <= values.size(); i += 2)
+			_mm256_storeu_ps(data + 4 * i, _mm256_add_ps(_mm256_loadu_ps(data + 4 * i), offset8));
+#endif
+		const __m128 offset4 = _mm_setr_ps(offset.x, offset.y, offset.z, offset.w);
+		for (; i < values.size(); ++i)
+			_mm_storeu_ps(data + 4 * i, _mm_add_ps(_mm_loadu_ps(data + 4 * i), offset4));
+#else
+		for (; i < values.size(); ++i)
+			values[i] += offset;
+#endif
+	}
+
+	void TransformKernels::Scale(span<glm::vec4> values, const glm::vec4& factor)
+	{
+		size_t i = 0;
+#if defined(TRANSFORM_KERNELS_SSE)
+		float* data = reinterpret_cast<float*>(values.data());
+#if defined(TRANSFORM_KERNELS_AVX)
+		const __m256 factor8 = _mm256_setr_ps(factor.x, factor.y, factor.z, factor.w, factor.x, factor.y, factor.z, factor.w);
+		for (; i + 2 <= values.size(); i += 2)
+			_mm256_storeu_ps(data + 4 * i, _mm256_mul_ps(_mm256_loadu_ps(data + 4 * i), factor8));
+#endif
+		const __m128 factor4 = _mm_setr_ps(factor.x, factor.y, factor.z, factor.w);
+		for (; i < values.size(); ++i)
+			_mm_storeu_ps(data + 4 * i, _mm_mul_ps(_mm_loadu_ps(data + 4 * i), factor4));
+#else
+		for (; i < values.size(); ++i)
+			values[i] *= factor;
+#endif
+	}
+
+	void TransformKernels::Integrate(span<glm::vec4> values, span<const glm::vec4> rates, float deltaSeconds)
+	{
+		if (rates.size() < values.size())
+			throw runtime_error("Every value needs a rate.");
+
+		size_t i = 0;
+#if defined(TRANSFORM_KERNELS_SSE)
+		float* data = reinterpret_cast<float*>(values.data());
+		const float* rateData = reinterpret_cast<const float*>(rates.data());
+#if defined(TRANSFORM_KERNELS_AVX)
+		const __m256 delta8 = _mm256_set1_ps(deltaSeconds);
+		for (; i + 2 <= values.size(); i += 2)
+		{
+			const __m256 step = _mm256_mul_ps(_mm256_loadu_ps(rateData + 4 * i), delta8);
+			_mm256_storeu_ps(data + 4 * i, _mm256_add_ps(_mm256_loadu_ps(data + 4 * i), step));
+		}
+#endif
+		const __m128 delta4 = _mm_set1_ps(deltaSeconds);
+		for (; i < values.size(); ++i)
+		{
+			const __m128 step = _mm_mul_ps(_mm_loadu_ps(rateData + 4 * i), delta4);
+			_mm_storeu_ps(data + 4 * i, _mm_add_ps(_mm_loadu_ps(data + 4 * i), step));
+		}
+#else
+		for (; i < values.size(); ++i)
+			values[i] += rates[i] * deltaSeconds;
+#endif
+	}
+
+	string_view TransformKernels::InstructionSet()
+	{
+#if defined(TRANSFORM_KERNELS_AVX)
+		return "AVX"sv;
+#elif defined(TRANSFORM_KERNELS_SSE)
+		return "SSE2"sv;
+#else
+		return "Scalar"sv;
+#endif
+	}
+}
@@ -0,0 +1,47 @@
+#pragma once
+#include <span>
+#include <string_view>
+#include <glm/glm.hpp>
+
+namespace FieaGameEngine
+{
+	/// <summary>
+	/// Batch operations over contiguous runs of transform components, such as the arrays of a TransformStore.
+	/// Each kernel uses AVX or SSE2 when the build targets them and falls back to plain glm arithmetic otherwise;
+	/// defining FIEA_NO_SIMD forces the fallback. Every path does the same arithmetic in the same order.
+	/// </summary>
+	class TransformKernels final
+	{
+	public:
+		TransformKernels() = delete;
+
+		/// <summary>
+		/// Adds the same offset to every value.
+		/// </summary>
+		/// <param name="values"> The values to be offset in place. </param>
+		/// <param name="offset"> The offset to add. </param>
+		static void Translate(std::span<glm::vec4> values, const glm::vec4& offset);
+
+		/// <summary>
+		/// Multiplies every value component-wise by the same factor.
+		/// </summary>
+		/// <param name="values"> The values to be scaled in place. </param>
+		/// <param name="factor"> The factor to multiply by. </param>
+		static void Scale(std::span<glm::vec4> values, const glm::vec4& factor);
+
+		/// <summary>
+		/// Advances every value by its rate of change over a time step, i.e. values[i] += rates[i] * deltaSeconds.
+		/// </summary>
+		/// <param name="values"> The values to be integrated in place, such as the positions of a TransformStore. </param>
+		/// <param name="rates"> The rate of change of each value, indexed like the values. </param>
+		/// <param name="deltaSeconds"> The length of the time step. </param>
+		/// <exception cref="runtime_error"> Throws if there are fewer rates than values. </exception>
+		static void Integrate(std::span<glm::vec4> values, std::span<const glm::vec4> rates, float deltaSeconds);
+
+		/// <summary>
+		/// Function to get the instruction set the kernels were compiled for.
+		/// </summary>
+		/// <returns> "AVX", "SSE2" or "Scalar". </returns>
+		static std::string_view InstructionSet();
+	};
+}
@@ -0,0 +1,154 @@
+#include "pch.h"
+#include "TransformStore.h"
+#include "GameObject.h"
+
+using namespace std;
+
+namespace FieaGameEngine
+{
+	TransformStore::~TransformStore()
+	{
+		while (!_owners.IsEmpty())
+			Remove(*_owners.Back());
+	}
+
+	void TransformStore::Reserve(size_t capacity)
+	{
+		if (capacity <= _owners.Capacity())
+			return;
+
+		_positions.Reserve(capacity);
+		_rotations.Reserve(capacity);
+		_scales.Reserve(capacity);
+		_owners.Reserve(capacity);
+		for (GameObject* owner : _owners)
+			owner->BindTransform();
+	}
+
+	size_t TransformStore::Size() const
+	{
+		return _owners.Size();
+	}
+
+	bool TransformStore::IsEmpty() const
+	{
+		return _owners.IsEmpty();
+	}
+
+	void TransformStore::Attach(GameObject& gameObject)
+	{
+		if (gameObject._transformStore != this)
+		{
+			if (gameObject._transformStore != nullptr)
+				gameObject._transformStore->Remove(gameObject);
+			Add(gameObject);
+		}
+
+		Datum& children = gameObject.GetChildren();
+		for (size_t i = 0; i < children.Size(); ++i)
+		{
+			assert(children[i].Is(GameObject::TypeIdClass()));
+			Attach(static_cast<GameObject&>(children[i]));
+		}
+	}
+
+	void TransformStore::Detach(GameObject& gameObject)
+	{
+		if (gameObject._transformStore == this)
+			Remove(gameObject);
+
+		Datum& children = gameObject.GetChildren();
+		for (size_t i = 0; i < children.Size(); ++i)
+		{
+			assert(children[i].Is(GameObject::TypeIdClass()));
+			Detach(static_cast<GameObject&>(children[i]));
+		}
+	}
+
+	void TransformStore::MarkTransformsDirty()
+	{
+		for (GameObject* owner : _owners)
+		{
+			if (!owner->IsTransformDirty())
+				owner->MarkTransformDirty();
+		}
+	}
+
+	span<glm::vec4> TransformStore::Positions()
+	{
+		return _positions;
+	}
+
+	span<const glm::vec4> TransformStore::Positions() const
+	{
+		return _positions;
+	}
+
+	span<glm::vec4> TransformStore::Rotations()
+	{
+		return _rotations;
+	}
+
+	span<const glm::vec4> TransformStore::Rotations() const
+	{
+		return _rotations;
+	}
+
+	span<glm::vec4> TransformStore::Scales()
+	{
+		return _scales;
+	}
+
+	span<const glm::vec4> TransformStore::Scales() const
+	{
+		return _scales;
+	}
+
+	span<GameObject* const> TransformStore::Owners() const
+	{
+		return _owners;
+	}
+
+	void TransformStore::Add(GameObject& gameObject)
+	{
+		assert(gameObject._transformStore == nullptr);
+
+		if (_owners.Size() == _owners.Capacity())
+			Reserve(DefaultIncrement{}(_owners.Size(), _owners.Capacity()));
+
+		_positions.PushBack(gameObject.Transform.Position);
+		_rotations.PushBack(gameObject.Transform.Rotation);
+		_scales.PushBack(gameObject.Transform.Scale);
+		_owners.PushBack(&gameObject);
+
+		gameObject._transformStore = this;
+		gameObject._transformIndex = _owners.Size() - 1;
+		gameObject.BindTransform();
+	}
+
+	void TransformStore::Remove(GameObject& gameObject)
+	{
+		assert(gameObject._transformStore == this);
+
+		const size_t index = gameObject._transformIndex;
+		gameObject.Transform = { _positions[index], _rotations[index], _scales[index] };
+		gameObject._transformStore = nullptr;
+		gameObject.BindTransform();
+
+		const size_t last = _owners.Size() - 1;
+		if (index != last)
+		{
+			_positions[index] = _positions[last];
+			_rotations[index] = _rotations[last];
+			_scales[index] = _scales[last];
+			_owners[index] = _owners[last];
+			_owners[index]->_transformIndex = index;
+			_owners[index]->BindTransform();
+		}
+
+		_positions.PopBack();
+		_rotations.PopBack();
+		_scales.PopBack();
+		_owners.PopBack();
+	}
+}
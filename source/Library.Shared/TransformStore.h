@@ -0,0 +1,112 @@
+#pragma once
+#include <span>
+#include <glm/glm.hpp>
+#include "Vector.h"
+
+namespace FieaGameEngine
+{
+	class GameObject;
+
+	/// <summary>
+	/// Structure-of-arrays home for the transforms of many GameObjects. Positions, Rotations and Scales each live in their own
+	/// contiguous array, and the prescribed "Position", "Rotation" and "Scale" Datums of every attached GameObject point into them,
+	/// so bulk systems can stream over every transform without walking the Scope tree.
+	/// Slots are kept dense: removing a GameObject moves the last slot into the hole, so a GameObject's index is not stable.
+	/// </summary>
+	class TransformStore final
+	{
+		friend GameObject;
+
+	public:
+		TransformStore() = default;
+		TransformStore(const TransformStore&) = delete;
+		TransformStore(TransformStore&&) = delete;
+		TransformStore& operator=(const TransformStore&) = delete;
+		TransformStore& operator=(TransformStore&&) = delete;
+
+		/// <summary>
+		/// Destructor for TransformStore, which hands every attached GameObject its transform back before the arrays go away.
+		/// </summary>
+		~TransformStore();
+
+		/// <summary>
+		/// Function to make room for a number of transforms, so that attaching that many GameObjects does not have to rebind any Datums.
+		/// </summary>
+		/// <param name="capacity"> The number of transforms to make room for. </param>
+		void Reserve(std::size_t capacity);
+
+		/// <summary>
+		/// Function to get the number of attached GameObjects.
+		/// </summary>
+		/// <returns> The number of transforms in the store. </returns>
+		std::size_t Size() const;
+
+		/// <summary>
+		/// Function to check if no GameObjects are attached.
+		/// </summary>
+		/// <returns> True if the store is empty, false otherwise. </returns>
+		bool IsEmpty() const;
+
+		/// <summary>
+		/// Function to move the transforms of a GameObject and all of its descendants into the store. A GameObject that belongs to
+		/// another store is moved out of it first. Children adopted afterwards are not attached automatically.
+		/// </summary>
+		/// <param name="gameObject"> The root of the hierarchy to be attached. </param>
+		void Attach(GameObject& gameObject);
+
+		/// <summary>
+		/// Function to hand the transforms of a GameObject and all of its descendants back to the GameObjects. Objects that are not in "this" store are left alone.
+		/// </summary>
+		/// <param name="gameObject"> The root of the hierarchy to be detached. </param>
+		void Detach(GameObject& gameObject);
+
+		/// <summary>
+		/// Function to mark the world transforms of every attached GameObject, and their descendants, out of date. Writing the arrays in place
+		/// does not need it, since GetWorldTransform compares the local transforms itself; it only makes IsTransformDirty report the change early.
+		/// </summary>
+		void MarkTransformsDirty();
+
+		/// <summary>
+		/// Function to get the positions of all attached GameObjects. Invalidated by attaching or detaching.
+		/// </summary>
+		/// <returns> A span over the contiguous positions, indexed like Owners(). </returns>
+		std::span<glm::vec4> Positions();
+		std::span<const glm::vec4> Positions() const;
+
+		/// <summary>
+		/// Function to get the rotations of all attached GameObjects. Invalidated by attaching or detaching.
+		/// </summary>
+		/// <returns> A span over the contiguous rotations, indexed like Owners(). </returns>
+		std::span<glm::vec4> Rotations();
+		std::span<const glm::vec4> Rotations() const;
+
+		/// <summary>
+		/// Function to get the scales of all attached GameObjects. Invalidated by attaching or detaching.
+		/// </summary>
+		/// <returns> A span over the contiguous scales, indexed like Owners(). </returns>
+		std::span<glm::vec4> Scales();
+		std::span<const glm::vec4> Scales() const;
+
+		/// <summary>
+		/// Function to get the GameObject each slot belongs to.
+		/// </summary>
+		/// <returns> A span over the owners of the slots. </returns>
+		std::span<GameObject* const> Owners() const;
+
+	private:
+		/// <summary>
+		/// Appends a slot for a single GameObject that is not in any store, and points its Datums at it.
+		/// </summary>
+		void Add(GameObject& gameObject);
+
+		/// <summary>
+		/// Copies a single GameObject's transform back into it and fills its slot with the last one.
+		/// </summary>
+		void Remove(GameObject& gameObject);
+
+		Vector<glm::vec4> _positions;
+		Vector<glm::vec4> _rotations;
+		Vector<glm::vec4> _scales;
+		Vector<GameObject*> _owners;
+	};
+}
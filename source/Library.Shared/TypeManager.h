@@ -3,6 +3,8 @@
 #include "Vector.h"
 #include "Datum.h"
 #include "HashMap.h"
+#include "Symbol.h"
+#include <memory>
 
 namespace FieaGameEngine
 {
@@ -27,6 +29,35 @@ namespace FieaGameEngine
 		std::size_t _offset;
 	};
 
+	/// <summary>
+	/// Flattened, immutable description of the prescribed attributes of a registered type, including the ones inherited from its parents.
+	/// Built once at registration and shared by every instance of the type.
+	/// </summary>
+	struct SignatureTable final
+	{
+		Vector<Signature> Signatures;
+
+		/// <summary>
+		/// The interned name of each signature, in the same order as Signatures.
+		/// </summary>
+		Vector<Symbol> Names;
+
+		/// <summary>
+		/// Maps the interned name of each prescribed attribute to the index of its first signature. A type that re-declares an inherited name has fewer entries here than signatures.
+		/// </summary>
+		HashMap<Symbol, std::size_t> Indices;
+
+		/// <summary>
+		/// The same as Indices, keyed by the names themselves, so that a name given as a string can be checked without going through the symbol table.
+		/// </summary>
+		HashMap<std::string, std::size_t> NameIndices;
+
+		/// <summary>
+		/// For each signature, the position in an instance's order vector of the Datum it binds to. Lets copies rebind their external storage in a single pass.
+		/// </summary>
+		Vector<std::size_t> Slots;
+	};
+
 	class TypeManager final
 	{
 	public:
@@ -47,7 +78,7 @@ namespace FieaGameEngine
 		static void DestroyInstance();
 
 		/// <summary>
-		/// Function to populate the HashMap with IdType and Vector of Signature pairs.
+		/// Function to build and register the SignatureTable of a type. Does nothing if the type is already registered.
 		/// </summary>
 		/// <param name="signatures"> Vector of signatures for the object of type "Child". </param>
 		/// <typeparam name="Child"> The type for which the map is being populated. </typeparam>
@@ -55,21 +86,52 @@ namespace FieaGameEngine
 		template<typename Child, typename Parent>
 		inline void RegisterType(const Vector<Signature>& signatures)
 		{
-			Vector<Signature> allSignatures;
+			if (_signatureMap.ContainsKey(Child::TypeIdClass()))
+				return;
+
+			const SignatureTable* parentTable = nullptr;
 			if (Parent::TypeIdClass() != Attributed::TypeIdClass())
-				allSignatures = (*_signatureMap.Find(Parent::TypeIdClass())).second;
+				parentTable = &GetSignatureTable(Parent::TypeIdClass());
+
+			const std::size_t parentSize = parentTable != nullptr ? parentTable->Signatures.Size() : 0;
+			std::shared_ptr<SignatureTable> table = std::make_shared<SignatureTable>();
+			table->Signatures.Reserve(parentSize + signatures.Size());
+			table->Names.Reserve(parentSize + signatures.Size());
+			table->Indices.Reserve(parentSize + signatures.Size());
+			table->NameIndices.Reserve(parentSize + signatures.Size());
+			table->Slots.Reserve(parentSize + signatures.Size());
+
+			for (std::size_t i = 0; i < parentSize; ++i)
+				table->Signatures.PushBack(parentTable->Signatures[i]);
+			for (std::size_t i = 0; i < signatures.Size(); ++i)
+				table->Signatures.PushBack(signatures[i]);
 
-			Vector<Signature>::ConstIterator it = signatures.begin();
-			while (it != signatures.end())
+			for (std::size_t i = 0; i < table->Signatures.Size(); ++i)
 			{
-				allSignatures.PushBack(*it);
-				++it;
+				Symbol name = Symbol::Intern(table->Signatures[i]._name);
+				table->Names.PushBack(name);
+
+				// Slot 0 holds "this", and a re-declared name binds to the Datum of its first declaration.
+				std::pair<HashMap<Symbol, std::size_t>::Iterator, bool> insertResult = table->Indices.Insert(make_pair(name, i));
+				table->Slots.PushBack(insertResult.second ? table->Indices.Size() : table->Slots[insertResult.first->second]);
+				table->NameIndices.Insert(make_pair(table->Signatures[i]._name, insertResult.first->second));
 			}
 
-			_signatureMap.Insert(make_pair(Child::TypeIdClass(), allSignatures));
+			_signatureMap.Insert(make_pair(Child::TypeIdClass(), std::shared_ptr<const SignatureTable>{ std::move(table) }));
+		}
+
+		/// <summary>
+		/// Function to get the SignatureTable of a registered type.
+		/// </summary>
+		/// <param name="typeId"> The type ID of the registered type. </param>
+		/// <returns> Const reference to the SignatureTable of the type. </returns>
+		/// <exception cref="runtime_error"> Throws if the type has not been registered. </exception>
+		inline const SignatureTable& GetSignatureTable(RTTI::IdType typeId) const
+		{
+			return *_signatureMap.At(typeId);
 		}
 
-		HashMap<RTTI::IdType, Vector<Signature>> _signatureMap;
+		HashMap<RTTI::IdType, std::shared_ptr<const SignatureTable>> _signatureMap;
 
 	private:
 		inline static TypeManager* _instance;
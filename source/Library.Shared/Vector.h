@@ -1,13 +1,20 @@
 #pragma once
 #include <stdio.h>
 #include <cassert>
+#include <iterator>
+#include <span>
+#include "IAllocator.h"
+#include "DefaultIncrement.h"
+#include "IsTriviallyRelocatable.h"
 
 namespace FieaGameEngine
 {
 	/// <summary>
 	/// Templated Vector class.
 	/// </summary>
-	template <typename T>
+	/// <typeparam name="T"> The type of the elements. </typeparam>
+	/// <typeparam name="IncrementFunctor"> Growth policy that is handed the size and capacity of a full Vector and returns the capacity to grow to. </typeparam>
+	template <typename T, typename IncrementFunctor = DefaultIncrement>
 	class Vector final
 	{
 	public:
@@ -18,6 +25,13 @@ namespace FieaGameEngine
 		{
 			friend Vector;
 
+			using iterator_category = std::random_access_iterator_tag;
+			using iterator_concept = std::contiguous_iterator_tag;
+			using difference_type = std::ptrdiff_t;
+			using value_type = T;
+			using pointer = T*;
+			using reference = T&;
+
 			/// <summary>
 			/// Default constructor for Iterator.
 			/// </summary>
@@ -54,6 +68,100 @@ namespace FieaGameEngine
 			/// </summary>
 			/// <returns> A reference to the object stored at the location the Iterator is currently pointing to. </returns>
 			T& operator*() const;
+
+			/// <summary>
+			/// Member access operator for Iterator. Unlike dereferencing, it does not check the position, so that std::to_address works
+			/// on end(), as it must for a contiguous iterator.
+			/// </summary>
+			/// <returns> A pointer to the location the Iterator is currently pointing to, which may be one past the last element. </returns>
+			T* operator->() const;
+
+			/// <summary>
+			/// Prefix decrement operator which makes the Iterator point to the previous element in the Vector.
+			/// </summary>
+			/// <returns> A reference to "this" Iterator after decrementing. </returns>
+			Iterator& operator--();
+
+			/// <summary>
+			/// Postfix decrement operator which makes the Iterator point to the previous element in the Vector.
+			/// </summary>
+			/// <returns> A copy of "this" Iterator before decrementing. </returns>
+			Iterator operator--(int);
+
+			/// <summary>
+			/// Compound addition operator which moves the Iterator forward by a number of elements. The offset is not range checked.
+			/// </summary>
+			/// <param name="offset"> The number of elements to move by. May be negative. </param>
+			/// <returns> A reference to "this" Iterator after moving. </returns>
+			Iterator& operator+=(difference_type offset);
+
+			/// <summary>
+			/// Compound subtraction operator which moves the Iterator backward by a number of elements. The offset is not range checked.
+			/// </summary>
+			/// <param name="offset"> The number of elements to move by. May be negative. </param>
+			/// <returns> A reference to "this" Iterator after moving. </returns>
+			Iterator& operator-=(difference_type offset);
+
+			/// <summary>
+			/// Addition operator for Iterator.
+			/// </summary>
+			/// <param name="offset"> The number of elements to move by. May be negative. </param>
+			/// <returns> A Iterator pointing offset elements after "this" Iterator. </returns>
+			Iterator operator+(difference_type offset) const;
+
+			/// <summary>
+			/// Subtraction operator for Iterator.
+			/// </summary>
+			/// <param name="offset"> The number of elements to move by. May be negative. </param>
+			/// <returns> A Iterator pointing offset elements before "this" Iterator. </returns>
+			Iterator operator-(difference_type offset) const;
+
+			/// <summary>
+			/// Difference operator for Iterator.
+			/// </summary>
+			/// <param name="rhs"> A const reference to the Iterator to measure the distance from. Both Iterators must belong to the same Vector. </param>
+			/// <returns> The number of elements between rhs and "this" Iterator. </returns>
+			difference_type operator-(const Iterator& rhs) const;
+
+			/// <summary>
+			/// Subscript operator for Iterator. The offset is not range checked.
+			/// </summary>
+			/// <param name="offset"> The offset from "this" Iterator of the element to be accessed. </param>
+			/// <returns> A reference to the element offset elements after "this" Iterator. </returns>
+			T& operator[](difference_type offset) const;
+
+			/// <summary>
+			/// Less than operator for Iterator.
+			/// </summary>
+			/// <param name="rhs"> A const reference to the Iterator we want to compare "this" Iterator to. </param>
+			/// <returns> True if the passed in Iterator points to a location further than "this" Iterator, false if not. </returns>
+			bool operator<(const Iterator& rhs) const;
+
+			/// <summary>
+			/// Greater than operator for Iterator.
+			/// </summary>
+			/// <param name="rhs"> A const reference to the Iterator we want to compare "this" Iterator to. </param>
+			/// <returns> True if "this" Iterator points to a location further than the passed in Iterator, false if not. </returns>
+			bool operator>(const Iterator& rhs) const;
+
+			/// <summary>
+			/// Less than or equal operator for Iterator.
+			/// </summary>
+			/// <param name="rhs"> A const reference to the Iterator we want to compare "this" Iterator to. </param>
+			/// <returns> True if "this" Iterator does not point to a location further than the passed in Iterator, false if it does. </returns>
+			bool operator<=(const Iterator& rhs) const;
+
+			/// <summary>
+			/// Greater than or equal operator for Iterator.
+			/// </summary>
+			/// <param name="rhs"> A const reference to the Iterator we want to compare "this" Iterator to. </param>
+			/// <returns> True if the passed in Iterator does not point to a location further than "this" Iterator, false if it does. </returns>
+			bool operator>=(const Iterator& rhs) const;
+
+			/// <summary>
+			/// Addition operator for Iterator with the offset on the left hand side.
+			/// </summary>
+			friend Iterator operator+(difference_type offset, const Iterator& it) { return it + offset; }
 		private:
 			/// <summary>
 			/// Parameterized constructor for Iterator.
@@ -71,7 +179,15 @@ namespace FieaGameEngine
 		/// </summary>
 		struct ConstIterator final
 		{
-			friend Vector; 
+			friend Vector;
+
+			using iterator_category = std::random_access_iterator_tag;
+			using iterator_concept = std::contiguous_iterator_tag;
+			using difference_type = std::ptrdiff_t;
+			using value_type = T;
+			using pointer = const T*;
+			using reference = const T&;
+
 			/// <summary>
 			/// Default constructor for ConstIterator.
 			/// </summary>
@@ -116,18 +232,99 @@ namespace FieaGameEngine
 			const T& operator*() const;
 
 			/// <summary>
-			/// Greater than operator for ConstIterator.
+			/// Member access operator for ConstIterator. Unlike dereferencing, it does not check the position, so that std::to_address works
+			/// on end(), as it must for a contiguous iterator.
+			/// </summary>
+			/// <returns> A pointer to the location the ConstIterator is currently pointing to, which may be one past the last element. </returns>
+			const T* operator->() const;
+
+			/// <summary>
+			/// Prefix decrement operator which makes the ConstIterator point to the previous element in the Vector.
+			/// </summary>
+			/// <returns> A reference to "this" ConstIterator after decrementing. </returns>
+			ConstIterator& operator--();
+
+			/// <summary>
+			/// Postfix decrement operator which makes the ConstIterator point to the previous element in the Vector.
+			/// </summary>
+			/// <returns> A copy of "this" ConstIterator before decrementing. </returns>
+			ConstIterator operator--(int);
+
+			/// <summary>
+			/// Compound addition operator which moves the ConstIterator forward by a number of elements. The offset is not range checked.
+			/// </summary>
+			/// <param name="offset"> The number of elements to move by. May be negative. </param>
+			/// <returns> A reference to "this" ConstIterator after moving. </returns>
+			ConstIterator& operator+=(difference_type offset);
+
+			/// <summary>
+			/// Compound subtraction operator which moves the ConstIterator backward by a number of elements. The offset is not range checked.
+			/// </summary>
+			/// <param name="offset"> The number of elements to move by. May be negative. </param>
+			/// <returns> A reference to "this" ConstIterator after moving. </returns>
+			ConstIterator& operator-=(difference_type offset);
+
+			/// <summary>
+			/// Addition operator for ConstIterator.
+			/// </summary>
+			/// <param name="offset"> The number of elements to move by. May be negative. </param>
+			/// <returns> A ConstIterator pointing offset elements after "this" ConstIterator. </returns>
+			ConstIterator operator+(difference_type offset) const;
+
+			/// <summary>
+			/// Subtraction operator for ConstIterator.
+			/// </summary>
+			/// <param name="offset"> The number of elements to move by. May be negative. </param>
+			/// <returns> A ConstIterator pointing offset elements before "this" ConstIterator. </returns>
+			ConstIterator operator-(difference_type offset) const;
+
+			/// <summary>
+			/// Difference operator for ConstIterator.
+			/// </summary>
+			/// <param name="rhs"> A const reference to the ConstIterator to measure the distance from. Both ConstIterators must belong to the same Vector. </param>
+			/// <returns> The number of elements between rhs and "this" ConstIterator. </returns>
+			difference_type operator-(const ConstIterator& rhs) const;
+
+			/// <summary>
+			/// Subscript operator for ConstIterator. The offset is not range checked.
+			/// </summary>
+			/// <param name="offset"> The offset from "this" ConstIterator of the element to be accessed. </param>
+			/// <returns> A const reference to the element offset elements after "this" ConstIterator. </returns>
+			const T& operator[](difference_type offset) const;
+
+			/// <summary>
+			/// Less than operator for ConstIterator.
 			/// </summary>
 			/// <param name="rhs"> A const reference to the ConstIterator we want to compare "this" ConstIterator to. </param>
-			/// <returns> True if the passed in ConstIterator points to a location furthur than "this" ConstIterator, false if not. </returns>
+			/// <returns> True if the passed in ConstIterator points to a location further than "this" ConstIterator, false if not. </returns>
 			bool operator<(const ConstIterator& rhs) const;
 
 			/// <summary>
-			/// Less than operator for ConstIterator.
+			/// Greater than operator for ConstIterator.
 			/// </summary>
 			/// <param name="rhs"> A const reference to the ConstIterator we want to compare "this" ConstIterator to. </param>
-			/// <returns> False if the passed in ConstIterator points to a location furthur than "this" ConstIterator, true if not. </returns>
+			/// <returns> True if "this" ConstIterator points to a location further than the passed in ConstIterator, false if not. </returns>
 			bool operator>(const ConstIterator& rhs) const;
+
+			/// <summary>
+			/// Less than or equal operator for ConstIterator.
+			/// </summary>
+			/// <param name="rhs"> A const reference to the ConstIterator we want to compare "this" ConstIterator to. </param>
+			/// <returns> True if "this" ConstIterator does not point to a location further than the passed in ConstIterator, false if it does. </returns>
+			bool operator<=(const ConstIterator& rhs) const;
+
+			/// <summary>
+			/// Greater than or equal operator for ConstIterator.
+			/// </summary>
+			/// <param name="rhs"> A const reference to the ConstIterator we want to compare "this" ConstIterator to. </param>
+			/// <returns> True if the passed in ConstIterator does not point to a location further than "this" ConstIterator, false if it does. </returns>
+			bool operator>=(const ConstIterator& rhs) const;
+
+			/// <summary>
+			/// Addition operator for ConstIterator with the offset on the left hand side.
+			/// </summary>
+			friend ConstIterator operator+(difference_type offset, const ConstIterator& it) { return it + offset; }
+
 		private:
 			/// <summary>
 			/// Parameterized constructor for ConstIterator.
@@ -149,7 +346,14 @@ namespace FieaGameEngine
 		/// Parameterized constructor for Vector which takes in a capacity to initialize the Vector with.
 		/// </summary>
 		/// <param name="list"> Capacity with which the Vector is to be initialized. </param>
-		Vector(std::size_t capacity);
+		/// <param name="allocator"> The allocator the Vector takes its storage from. </param>
+		Vector(std::size_t capacity, IAllocator& allocator = IAllocator::Default());
+
+		/// <summary>
+		/// Parameterized constructor for Vector which takes in the allocator the Vector takes its storage from.
+		/// </summary>
+		/// <param name="allocator"> The allocator the Vector takes its storage from. </param>
+		explicit Vector(IAllocator& allocator);
 
 		/// <summary>
 		/// Parameterized constructor for Vector which takes in an initializer list.
@@ -158,13 +362,13 @@ namespace FieaGameEngine
 		Vector(std::initializer_list<T> list);
 
 		/// <summary>
-		/// Copy constructor for Vector.
+		/// Copy constructor for Vector. The copy takes its storage from the default allocator.
 		/// </summary>
 		/// <param name="other"> A const reference to the Vector which we want to deep-copy onto "this" Vector. </param>
 		Vector(const Vector& other);
 
 		/// <summary>
-		/// Move constructor for Vector.
+		/// Move constructor for Vector. The storage is taken over along with the allocator that owns it.
 		/// </summary>
 		/// <param name="other"> rvalue reference to the Vector we wish to move onto "this" one. </param>
 		Vector(Vector&& other) noexcept;
@@ -316,6 +520,28 @@ namespace FieaGameEngine
 		/// <returns> A const reference to the element at the specified index. </returns>
 		const T& operator[](size_t index) const;
 
+		/// <summary>
+		/// Data method which returns a pointer to the contiguous storage of the Vector.
+		/// </summary>
+		/// <returns> A pointer to the first element, or nullptr if no storage has been allocated. </returns>
+		T* Data();
+
+		/// <summary>
+		/// Data method which returns a pointer to the contiguous storage of the Vector.
+		/// </summary>
+		/// <returns> A const pointer to the first element, or nullptr if no storage has been allocated. </returns>
+		const T* Data() const;
+
+		/// <summary>
+		/// Conversion operator that views the elements of the Vector as a span. The span is invalidated by anything that reallocates the Vector.
+		/// </summary>
+		operator std::span<T>();
+
+		/// <summary>
+		/// Conversion operator that views the elements of the Vector as a span. The span is invalidated by anything that reallocates the Vector.
+		/// </summary>
+		operator std::span<const T>() const;
+
 		/// <summary>
 		/// Find method that can be used to find a specific element in the Vector.
 		/// </summary>
@@ -369,14 +595,37 @@ namespace FieaGameEngine
 		/// <returns> True if the Vector is empty, false if not. </returns>
 		const bool IsEmpty() const;
 
+		/// <summary>
+		/// Function to get the allocator the Vector takes its storage from.
+		/// </summary>
+		/// <returns> A reference to the allocator. </returns>
+		IAllocator& GetAllocator() const;
+
 		bool operator!=(const Vector& rhs) const;
 		bool operator==(const Vector& rhs) const;
 
 	private:
+		/// <summary>
+		/// Moves the elements into a new block of the given capacity. Trivially relocatable elements are moved in bulk by the allocator, the rest are move constructed and destroyed one at a time.
+		/// </summary>
+		/// <param name="capacity"> The capacity of the new block. Must be at least the size of the Vector. </param>
+		void Reallocate(std::size_t capacity);
+
+		/// <summary>
+		/// Destroys a run of elements and shifts the elements after it down to close the gap.
+		/// </summary>
+		/// <param name="index"> The index of the first element to be removed. </param>
+		/// <param name="count"> The number of elements to be removed. </param>
+		void Erase(std::size_t index, std::size_t count);
+
 		T* _data{ nullptr };
 		std::size_t _size{ 0 };
 		std::size_t _capacity{ 0 };
+		IAllocator* _allocator{ &IAllocator::Default() };
 	};
+
+	template <typename T, typename IncrementFunctor>
+	struct IsTriviallyRelocatable<Vector<T, IncrementFunctor>> : std::true_type {};
 }
 
 #include "Vector.inl"
\ No newline at end of file
@@ -2,30 +2,37 @@
 
 namespace FieaGameEngine
 {
-	template <typename T>
-	Vector<T>::Vector(std::size_t capacity)
+	template <typename T, typename IncrementFunctor>
+	Vector<T, IncrementFunctor>::Vector(std::size_t capacity, IAllocator& allocator)
+		: _allocator{ &allocator }
 	{
 		Reserve(capacity);
 	}
 
-	template <typename T>
-	Vector<T>::Vector(std::initializer_list<T> list)
+	template <typename T, typename IncrementFunctor>
+	Vector<T, IncrementFunctor>::Vector(IAllocator& allocator)
+		: _allocator{ &allocator }
+	{
+	}
+
+	template <typename T, typename IncrementFunctor>
+	Vector<T, IncrementFunctor>::Vector(std::initializer_list<T> list)
 	{
 		for (const auto& value : list)
 			PushBack(value);
 	}
 
-	template <typename T>
-	Vector<T>::Vector(Vector&& other) noexcept
-		: _data{other._data}, _size { other._size }, _capacity { other._capacity}
+	template <typename T, typename IncrementFunctor>
+	Vector<T, IncrementFunctor>::Vector(Vector&& other) noexcept
+		: _data{other._data}, _size { other._size }, _capacity { other._capacity}, _allocator{ other._allocator }
 	{
 		other._data = nullptr;
 		other._size = 0;
 		other._capacity = 0;
 	}
 
-	template <typename T>
-	Vector<T>::Vector(const Vector& other)
+	template <typename T, typename IncrementFunctor>
+	Vector<T, IncrementFunctor>::Vector(const Vector& other)
 	{
 		Reserve(other.Size());
 
@@ -34,8 +41,8 @@ namespace FieaGameEngine
 			PushBack(*it++);
 	}
 
-	template <typename T>
-	Vector<T>& Vector<T>::operator=(const Vector& rhs)
+	template <typename T, typename IncrementFunctor>
+	Vector<T, IncrementFunctor>& Vector<T, IncrementFunctor>::operator=(const Vector& rhs)
 	{
 		if (this != &rhs)
 		{
@@ -49,8 +56,8 @@ namespace FieaGameEngine
 		return *this;
 	}
 
-	template<typename T>
-	Vector<T>& Vector<T>::operator=(Vector&& rhs) noexcept
+	template <typename T, typename IncrementFunctor>
+	Vector<T, IncrementFunctor>& Vector<T, IncrementFunctor>::operator=(Vector&& rhs) noexcept
 	{
 		if (this != &rhs)
 		{
@@ -60,6 +67,7 @@ namespace FieaGameEngine
 			_data = rhs._data;
 			_size = rhs._size;
 			_capacity = rhs._capacity;
+			_allocator = rhs._allocator;
 
 			rhs._data = nullptr;
 			rhs._size = 0;
@@ -68,79 +76,79 @@ namespace FieaGameEngine
 		return *this;
 	}
 
-	template <typename T>
-	Vector<T>::~Vector()
+	template <typename T, typename IncrementFunctor>
+	Vector<T, IncrementFunctor>::~Vector()
 	{
 		Clear();
 		ShrinkToFit();
 	}
 
-	template <typename T>
-	inline Vector<T>::Iterator::Iterator(const Vector& owner, T* item) 
+	template <typename T, typename IncrementFunctor>
+	inline Vector<T, IncrementFunctor>::Iterator::Iterator(const Vector& owner, T* item) 
 		: _owner{ &owner }, _item{ item }
 	{
 
 	}
 
-	template <typename T>
-	inline Vector<T>::ConstIterator::ConstIterator(const Vector& owner, T* item)
+	template <typename T, typename IncrementFunctor>
+	inline Vector<T, IncrementFunctor>::ConstIterator::ConstIterator(const Vector& owner, T* item)
 		: _owner{ &owner }, _item{ item }
 	{
 
 	}
 
-	template <typename T>
-	inline Vector<T>::ConstIterator::ConstIterator(const Iterator& it)
+	template <typename T, typename IncrementFunctor>
+	inline Vector<T, IncrementFunctor>::ConstIterator::ConstIterator(const Iterator& it)
 		: _owner{ it._owner }, _item{ it._item }
 	{
 
 	}
 
-	template <typename T>
-	inline const std::size_t Vector<T>::Size() const
+	template <typename T, typename IncrementFunctor>
+	inline const std::size_t Vector<T, IncrementFunctor>::Size() const
 	{
 		return _size;
 	}
 
-	template <typename T>
-	inline const std::size_t Vector<T>::Capacity() const
+	template <typename T, typename IncrementFunctor>
+	inline const std::size_t Vector<T, IncrementFunctor>::Capacity() const
 	{
 		return _capacity;
 	}
 
-	template <typename T>
-	inline const bool Vector<T>::IsEmpty() const
+	template <typename T, typename IncrementFunctor>
+	inline const bool Vector<T, IncrementFunctor>::IsEmpty() const
 	{
 		return _size == 0;
 	}
 
-	template <typename T>
-	void Vector<T>::Reserve(std::size_t capacity)
+	template <typename T, typename IncrementFunctor>
+	inline IAllocator& Vector<T, IncrementFunctor>::GetAllocator() const
 	{
-		if (capacity > _capacity)
-		{
-			T* data = reinterpret_cast<T*>(realloc(_data, capacity * sizeof(T)));
-			assert(data != nullptr);
+		return *_allocator;
+	}
 
-			_data = data;
-			_capacity = capacity;
-		}
+	template <typename T, typename IncrementFunctor>
+	void Vector<T, IncrementFunctor>::Reserve(std::size_t capacity)
+	{
+		if (capacity > _capacity)
+			Reallocate(capacity);
 	}
 
-	template <typename T>
-	inline T& Vector<T>::operator[](size_t index)
+	template <typename T, typename IncrementFunctor>
+	inline T& Vector<T, IncrementFunctor>::operator[](size_t index)
 	{
 		return at(index);
 	}
 
-	template <typename T>
-	inline const T& Vector<T>::operator[](size_t index) const
+	template <typename T, typename IncrementFunctor>
+	inline const T& Vector<T, IncrementFunctor>::operator[](size_t index) const
 	{
 		return at(index);
 	}
 
-	template <typename T>
-	inline T& Vector<T>::at(size_t index)
+	template <typename T, typename IncrementFunctor>
+	inline T& Vector<T, IncrementFunctor>::at(size_t index)
 	{
 		if (index >= _size)
 			throw std::out_of_range("Index out of range.");
@@ -148,8 +156,8 @@ namespace FieaGameEngine
 		return _data[index];
 	}
 
-	template <typename T>
-	inline const T& Vector<T>::at(size_t index) const
+	template <typename T, typename IncrementFunctor>
+	inline const T& Vector<T, IncrementFunctor>::at(size_t index) const
 	{
 		if (index >= _size)
 			throw std::out_of_range("Index out of range.");
@@ -157,31 +165,55 @@ namespace FieaGameEngine
 		return _data[index];
 	}
 
-	template<typename T>
-	void Vector<T>::PushBack(const T& value)
+	template <typename T, typename IncrementFunctor>
+	void Vector<T, IncrementFunctor>::PushBack(const T& value)
 	{
 		EmplaceBack(value);
 	}
 
-	template<typename T>
-	void Vector<T>::PushBack(T&& value)
+	template <typename T, typename IncrementFunctor>
+	void Vector<T, IncrementFunctor>::PushBack(T&& value)
 	{
 		EmplaceBack(std::move(value));
 	}
 
-	template<typename T>
+	template <typename T, typename IncrementFunctor>
 	template<typename... Args>
-	void Vector<T>::EmplaceBack(Args&&... args)
+	void Vector<T, IncrementFunctor>::EmplaceBack(Args&&... args)
 	{
 		if (_size == _capacity)
-			Reserve(std::max(_capacity + _size, size_t(1)));
+			Reserve(std::max(IncrementFunctor{}(_size, _capacity), _size + 1));
 
 		new (_data + _size) T(std::forward<Args>(args)...);
 		++_size;
 	}
 
-	template<typename T>
-	inline T& Vector<T>::Front()
+	template <typename T, typename IncrementFunctor>
+	inline T* Vector<T, IncrementFunctor>::Data()
+	{
+		return _data;
+	}
+
+	template <typename T, typename IncrementFunctor>
+	inline const T* Vector<T, IncrementFunctor>::Data() const
+	{
+		return _data;
+	}
+
+	template <typename T, typename IncrementFunctor>
+	inline Vector<T, IncrementFunctor>::operator std::span<T>()
+	{
+		return std::span<T>{ _data, _size };
+	}
+
+	template <typename T, typename IncrementFunctor>
+	inline Vector<T, IncrementFunctor>::operator std::span<const T>() const
+	{
+		return std::span<const T>{ _data, _size };
+	}
+
+	template <typename T, typename IncrementFunctor>
+	inline T& Vector<T, IncrementFunctor>::Front()
 	{
 		if (_size == 0)
 			throw std::runtime_error("Array is empty.");
@@ -189,8 +221,8 @@ namespace FieaGameEngine
 		return _data[0];
 	}
 
-	template<typename T>
-	inline const T& Vector<T>::Front() const
+	template <typename T, typename IncrementFunctor>
+	inline const T& Vector<T, IncrementFunctor>::Front() const
 	{
 		if (_size == 0)
 			throw std::runtime_error("Array is empty.");
@@ -198,8 +230,8 @@ namespace FieaGameEngine
 		return _data[0];
 	}
 
-	template<typename T>
-	inline T& Vector<T>::Back()
+	template <typename T, typename IncrementFunctor>
+	inline T& Vector<T, IncrementFunctor>::Back()
 	{
 		if (_size == 0)
 			throw std::runtime_error("Array is empty.");
@@ -207,8 +239,8 @@ namespace FieaGameEngine
 		return _data[_size - 1];
 	}
 
-	template<typename T>
-	inline const T& Vector<T>::Back() const
+	template <typename T, typename IncrementFunctor>
+	inline const T& Vector<T, IncrementFunctor>::Back() const
 	{
 		if (_size == 0)
 			throw std::runtime_error("Array is empty.");
@@ -216,8 +248,8 @@ namespace FieaGameEngine
 		return _data[_size - 1];
 	}
 
-	template <typename T>
-	void Vector<T>::Clear()
+	template <typename T, typename IncrementFunctor>
+	void Vector<T, IncrementFunctor>::Clear()
 	{
 		if (_size == 0)
 			return;
@@ -228,29 +260,51 @@ namespace FieaGameEngine
 		_size = 0;
 	}
 
-	template <typename T>
-	void Vector<T>::ShrinkToFit()
+	template <typename T, typename IncrementFunctor>
+	void Vector<T, IncrementFunctor>::ShrinkToFit()
 	{
 		if (_capacity == _size)
 			return;
 
-		_capacity = _size;
-
-		if (_capacity == size_t(0))
+		if (_size == size_t(0))
 		{
-			free(_data);
+			_allocator->Deallocate(_data, _capacity * sizeof(T));
 			_data = nullptr;
+			_capacity = 0;
 		}
+		else
+			Reallocate(_size);
+	}
+
+	template <typename T, typename IncrementFunctor>
+	void Vector<T, IncrementFunctor>::Reallocate(std::size_t capacity)
+	{
+		assert(capacity >= _size);
+
+		T* data;
+		if constexpr (IsTriviallyRelocatable<T>::value)
+			data = reinterpret_cast<T*>(_allocator->Reallocate(_data, _capacity * sizeof(T), capacity * sizeof(T)));
 		else
 		{
-			T* data = reinterpret_cast<T*>(realloc(_data, _capacity * sizeof(T)));
-			assert(data != nullptr);
-			_data = data;
+			data = reinterpret_cast<T*>(_allocator->Allocate(capacity * sizeof(T)));
+			if (data != nullptr && _data != nullptr)
+			{
+				for (std::size_t i = 0; i < _size; ++i)
+				{
+					new (data + i) T(std::move(_data[i]));
+					_data[i].~T();
+				}
+				_allocator->Deallocate(_data, _capacity * sizeof(T));
+			}
 		}
+		assert(data != nullptr);
+
+		_data = data;
+		_capacity = capacity;
 	}
 
-	template <typename T>
-	void Vector<T>::PopBack()
+	template <typename T, typename IncrementFunctor>
+	void Vector<T, IncrementFunctor>::PopBack()
 	{
 		if (_size == 0)
 			return;
@@ -259,9 +313,9 @@ namespace FieaGameEngine
 		--_size;
 	}
 
-	template<typename T>
+	template <typename T, typename IncrementFunctor>
 	template<typename EqualityFunctor>
-	typename Vector<T>::Iterator Vector<T>::Find(const T& value, EqualityFunctor equalityFunctor)
+	typename Vector<T, IncrementFunctor>::Iterator Vector<T, IncrementFunctor>::Find(const T& value, EqualityFunctor equalityFunctor)
 	{
 		Iterator it;
 		for ( it = begin(); it != end(); ++it)
@@ -272,9 +326,9 @@ namespace FieaGameEngine
 		return it;
 	}
 
-	template<typename T>
+	template <typename T, typename IncrementFunctor>
 	template<typename EqualityFunctor>
-	typename Vector<T>::ConstIterator Vector<T>::Find(const T& value, EqualityFunctor equalityFunctor) const
+	typename Vector<T, IncrementFunctor>::ConstIterator Vector<T, IncrementFunctor>::Find(const T& value, EqualityFunctor equalityFunctor) const
 	{
 		ConstIterator it;
 		for (it = begin(); it != end(); ++it)
@@ -285,23 +339,20 @@ namespace FieaGameEngine
 		return it;
 	}
 
-	template<typename T>
+	template <typename T, typename IncrementFunctor>
 	template <typename EqualityFunctor>
-	bool Vector<T>::Remove(const T& value, EqualityFunctor equalityFunctor)
+	bool Vector<T, IncrementFunctor>::Remove(const T& value, EqualityFunctor equalityFunctor)
 	{
 		Iterator it = Find(value, equalityFunctor);
 		if(it == end())
 			return false;
 		
-		size_t offset = it._item - _data;
-		it._item->~T();
-		std::memmove(_data + offset, _data + offset + 1, sizeof(T) * (end()._item - it._item));
-		--_size;
+		Erase(static_cast<std::size_t>(it._item - _data), 1);
 		return true;
 	}
 
-	template<typename T>
-	bool Vector<T>::Remove(ConstIterator begin, ConstIterator end)
+	template <typename T, typename IncrementFunctor>
+	bool Vector<T, IncrementFunctor>::Remove(ConstIterator begin, ConstIterator end)
 	{
 		if (begin._item == end._item || begin._owner != end._owner)
 			return false;
@@ -309,57 +360,68 @@ namespace FieaGameEngine
 		if (begin > end)
 			return false;
 
-		size_t offsetFromStart = begin._item - _data;
-		size_t offset = end._item - begin._item;
+		Erase(static_cast<std::size_t>(begin._item - _data), static_cast<std::size_t>(end._item - begin._item));
+		return true;
+	}
+
+	template <typename T, typename IncrementFunctor>
+	void Vector<T, IncrementFunctor>::Erase(std::size_t index, std::size_t count)
+	{
+		assert(index + count <= _size);
 
-		while (begin != end)
+		if constexpr (IsTriviallyRelocatable<T>::value)
 		{
-			begin._item->~T();
-			++begin;
-			--_size;
+			for (std::size_t i = index; i < index + count; ++i)
+				_data[i].~T();
+			std::memmove(_data + index, _data + index + count, sizeof(T) * (_size - index - count));
 		}
-		memmove(_data + offsetFromStart, _data + offsetFromStart + offset, sizeof(T) * offset);
-		return true;
+		else
+		{
+			std::move(_data + index + count, _data + _size, _data + index);
+			for (std::size_t i = _size - count; i < _size; ++i)
+				_data[i].~T();
+		}
+		_size -= count;
 	}
 
-	template<typename T>
-	inline typename Vector<T>::Iterator Vector<T>::begin()
+	template <typename T, typename IncrementFunctor>
+	inline typename Vector<T, IncrementFunctor>::Iterator Vector<T, IncrementFunctor>::begin()
 	{
 		return Iterator{ *this, _data};
 	}
 
-	template<typename T>
-	inline typename Vector<T>::ConstIterator Vector<T>::begin() const
+	template <typename T, typename IncrementFunctor>
+	inline typename Vector<T, IncrementFunctor>::ConstIterator Vector<T, IncrementFunctor>::begin() const
 	{
 		return ConstIterator{ *this, _data};
 	}
 
-	template<typename T>
-	inline typename Vector<T>::ConstIterator Vector<T>::cbegin()
+	template <typename T, typename IncrementFunctor>
+	inline typename Vector<T, IncrementFunctor>::ConstIterator Vector<T, IncrementFunctor>::cbegin()
 	{
 		return ConstIterator{ *this, _data};
 	}
 
-	template<typename T>
-	inline typename Vector<T>::Iterator Vector<T>::end()
+	template <typename T, typename IncrementFunctor>
+	inline typename Vector<T, IncrementFunctor>::Iterator Vector<T, IncrementFunctor>::end()
 	{
 		return Iterator{ *this, _data + _size };
 	}
 
-	template<typename T>
-	inline typename Vector<T>::ConstIterator Vector<T>::end() const
+	template <typename T, typename IncrementFunctor>
+	inline typename Vector<T, IncrementFunctor>::ConstIterator Vector<T, IncrementFunctor>::end() const
 	{
 		return ConstIterator{ *this, _data + _size };
 	}
 
-	template<typename T>
-	inline typename Vector<T>::ConstIterator Vector<T>::cend()
+	template <typename T, typename IncrementFunctor>
+	inline typename Vector<T, IncrementFunctor>::ConstIterator Vector<T, IncrementFunctor>::cend()
 	{
 		return ConstIterator{ *this, _data + _size };
 	}
 
-	template<typename T>
-	bool Vector<T>::operator!=(const Vector& rhs) const
+	template <typename T, typename IncrementFunctor>
+	bool Vector<T, IncrementFunctor>::operator!=(const Vector& rhs) const
 	{
 		if (_size != rhs._size)
 			return true;
@@ -372,15 +434,15 @@ namespace FieaGameEngine
 		return false;
 	}
 
-	template<typename T>
-	bool Vector<T>::operator==(const Vector& rhs) const
+	template <typename T, typename IncrementFunctor>
+	bool Vector<T, IncrementFunctor>::operator==(const Vector& rhs) const
 	{
 		return !operator!=(rhs);
 	}
 
 
-	template<typename T>
-	T& Vector<T>::Iterator::operator*() const
+	template <typename T, typename IncrementFunctor>
+	T& Vector<T, IncrementFunctor>::Iterator::operator*() const
 	{
 		if (_owner == nullptr)
 			throw std::runtime_error("Iterator does not belong to any container.");
@@ -391,20 +453,20 @@ namespace FieaGameEngine
 		return *_item;
 	}
 
-	template<typename T>
-	inline bool Vector<T>::Iterator::operator!=(const Iterator& rhs) const
+	template <typename T, typename IncrementFunctor>
+	inline bool Vector<T, IncrementFunctor>::Iterator::operator!=(const Iterator& rhs) const
 	{
 		return _item != rhs._item || _owner != rhs._owner;
 	}
 
-	template<typename T>
-	inline bool Vector<T>::Iterator::operator==(const Iterator& rhs) const
+	template <typename T, typename IncrementFunctor>
+	inline bool Vector<T, IncrementFunctor>::Iterator::operator==(const Iterator& rhs) const
 	{
 		return !operator!=(rhs);
 	}
 
-	template<typename T>
-	typename Vector<T>::Iterator& Vector<T>::Iterator::operator++()
+	template <typename T, typename IncrementFunctor>
+	typename Vector<T, IncrementFunctor>::Iterator& Vector<T, IncrementFunctor>::Iterator::operator++()
 	{
 		if (_owner == nullptr)
 			throw std::runtime_error("Iterator does not belong to any container.");
@@ -416,8 +478,8 @@ namespace FieaGameEngine
 		return *this;
 	}
 
-	template<typename T>
-	typename Vector<T>::Iterator Vector<T>::Iterator::operator++(int)
+	template <typename T, typename IncrementFunctor>
+	typename Vector<T, IncrementFunctor>::Iterator Vector<T, IncrementFunctor>::Iterator::operator++(int)
 	{
 		Iterator it = *this;
 		++(*this);
@@ -425,8 +487,98 @@ namespace FieaGameEngine
 	}
 
 
-	template<typename T>
-	const T& Vector<T>::ConstIterator::operator*() const
+	template <typename T, typename IncrementFunctor>
+	T* Vector<T, IncrementFunctor>::Iterator::operator->() const
+	{
+		return _item;
+	}
+
+	template <typename T, typename IncrementFunctor>
+	typename Vector<T, IncrementFunctor>::Iterator& Vector<T, IncrementFunctor>::Iterator::operator--()
+	{
+		if (_owner == nullptr)
+			throw std::runtime_error("Iterator does not belong to any container.");
+
+		if (_item <= _owner->_data)
+			throw std::runtime_error("Cannot decrement iterator as it has reached the start of the allocated memory.");
+
+		_item -= 1;
+		return *this;
+	}
+
+	template <typename T, typename IncrementFunctor>
+	typename Vector<T, IncrementFunctor>::Iterator Vector<T, IncrementFunctor>::Iterator::operator--(int)
+	{
+		Iterator it = *this;
+		--(*this);
+		return it;
+	}
+
+	template <typename T, typename IncrementFunctor>
+	inline typename Vector<T, IncrementFunctor>::Iterator& Vector<T, IncrementFunctor>::Iterator::operator+=(difference_type offset)
+	{
+		_item += offset;
+		return *this;
+	}
+
+	template <typename T, typename IncrementFunctor>
+	inline typename Vector<T, IncrementFunctor>::Iterator& Vector<T, IncrementFunctor>::Iterator::operator-=(difference_type offset)
+	{
+		_item -= offset;
+		return *this;
+	}
+
+	template <typename T, typename IncrementFunctor>
+	inline typename Vector<T, IncrementFunctor>::Iterator Vector<T, IncrementFunctor>::Iterator::operator+(difference_type offset) const
+	{
+		return Iterator{ *this } += offset;
+	}
+
+	template <typename T, typename IncrementFunctor>
+	inline typename Vector<T, IncrementFunctor>::Iterator Vector<T, IncrementFunctor>::Iterator::operator-(difference_type offset) const
+	{
+		return Iterator{ *this } -= offset;
+	}
+
+	template <typename T, typename IncrementFunctor>
+	inline typename Vector<T, IncrementFunctor>::Iterator::difference_type Vector<T, IncrementFunctor>::Iterator::operator-(const Iterator& rhs) const
+	{
+		assert(_owner == rhs._owner);
+		return _item - rhs._item;
+	}
+
+	template <typename T, typename IncrementFunctor>
+	inline T& Vector<T, IncrementFunctor>::Iterator::operator[](difference_type offset) const
+	{
+		return *(*this + offset);
+	}
+
+	template <typename T, typename IncrementFunctor>
+	inline bool Vector<T, IncrementFunctor>::Iterator::operator<(const Iterator& rhs) const
+	{
+		return _item < rhs._item;
+	}
+
+	template <typename T, typename IncrementFunctor>
+	inline bool Vector<T, IncrementFunctor>::Iterator::operator>(const Iterator& rhs) const
+	{
+		return rhs < *this;
+	}
+
+	template <typename T, typename IncrementFunctor>
+	inline bool Vector<T, IncrementFunctor>::Iterator::operator<=(const Iterator& rhs) const
+	{
+		return !(rhs < *this);
+	}
+
+	template <typename T, typename IncrementFunctor>
+	inline bool Vector<T, IncrementFunctor>::Iterator::operator>=(const Iterator& rhs) const
+	{
+		return !(*this < rhs);
+	}
+
+	template <typename T, typename IncrementFunctor>
+	const T& Vector<T, IncrementFunctor>::ConstIterator::operator*() const
 	{
 		if (_owner == nullptr)
 			throw std::runtime_error("Iterator does not belong to any container.");
@@ -437,20 +589,20 @@ namespace FieaGameEngine
 		return *_item;
 	}
 
-	template<typename T>
-	inline bool Vector<T>::ConstIterator::operator!=(const ConstIterator& rhs) const
+	template <typename T, typename IncrementFunctor>
+	inline bool Vector<T, IncrementFunctor>::ConstIterator::operator!=(const ConstIterator& rhs) const
 	{
 		return  _item != rhs._item || _owner != rhs._owner;
 	}
 
-	template<typename T>
-	inline bool Vector<T>::ConstIterator::operator==(const ConstIterator& rhs) const
+	template <typename T, typename IncrementFunctor>
+	inline bool Vector<T, IncrementFunctor>::ConstIterator::operator==(const ConstIterator& rhs) const
 	{
 		return !operator!=(rhs);
 	}
 
-	template<typename T>
-	typename Vector<T>::ConstIterator& Vector<T>::ConstIterator::operator++()
+	template <typename T, typename IncrementFunctor>
+	typename Vector<T, IncrementFunctor>::ConstIterator& Vector<T, IncrementFunctor>::ConstIterator::operator++()
 	{
 		if (_owner == nullptr)
 			throw std::runtime_error("Iterator does not belong to any container.");
@@ -462,23 +614,102 @@ namespace FieaGameEngine
 		return *this;
 	}
 
-	template<typename T>
-	typename Vector<T>::ConstIterator Vector<T>::ConstIterator::operator++(int)
+	template <typename T, typename IncrementFunctor>
+	typename Vector<T, IncrementFunctor>::ConstIterator Vector<T, IncrementFunctor>::ConstIterator::operator++(int)
 	{
 		ConstIterator it = *this;
 		++(*this);
 		return it;
 	}
 
-	template<typename T>
-	inline bool Vector<T>::ConstIterator::operator<(const ConstIterator& rhs) const
+
+	template <typename T, typename IncrementFunctor>
+	const T* Vector<T, IncrementFunctor>::ConstIterator::operator->() const
+	{
+		return _item;
+	}
+
+	template <typename T, typename IncrementFunctor>
+	typename Vector<T, IncrementFunctor>::ConstIterator& Vector<T, IncrementFunctor>::ConstIterator::operator--()
+	{
+		if (_owner == nullptr)
+			throw std::runtime_error("Iterator does not belong to any container.");
+
+		if (_item <= _owner->_data)
+			throw std::runtime_error("Cannot decrement iterator as it has reached the start of the allocated memory.");
+
+		_item -= 1;
+		return *this;
+	}
+
+	template <typename T, typename IncrementFunctor>
+	typename Vector<T, IncrementFunctor>::ConstIterator Vector<T, IncrementFunctor>::ConstIterator::operator--(int)
+	{
+		ConstIterator it = *this;
+		--(*this);
+		return it;
+	}
+
+	template <typename T, typename IncrementFunctor>
+	inline typename Vector<T, IncrementFunctor>::ConstIterator& Vector<T, IncrementFunctor>::ConstIterator::operator+=(difference_type offset)
+	{
+		_item += offset;
+		return *this;
+	}
+
+	template <typename T, typename IncrementFunctor>
+	inline typename Vector<T, IncrementFunctor>::ConstIterator& Vector<T, IncrementFunctor>::ConstIterator::operator-=(difference_type offset)
+	{
+		_item -= offset;
+		return *this;
+	}
+
+	template <typename T, typename IncrementFunctor>
+	inline typename Vector<T, IncrementFunctor>::ConstIterator Vector<T, IncrementFunctor>::ConstIterator::operator+(difference_type offset) const
+	{
+		return ConstIterator{ *this } += offset;
+	}
+
+	template <typename T, typename IncrementFunctor>
+	inline typename Vector<T, IncrementFunctor>::ConstIterator Vector<T, IncrementFunctor>::ConstIterator::operator-(difference_type offset) const
+	{
+		return ConstIterator{ *this } -= offset;
+	}
+
+	template <typename T, typename IncrementFunctor>
+	inline typename Vector<T, IncrementFunctor>::ConstIterator::difference_type Vector<T, IncrementFunctor>::ConstIterator::operator-(const ConstIterator& rhs) const
+	{
+		assert(_owner == rhs._owner);
+		return _item - rhs._item;
+	}
+
+	template <typename T, typename IncrementFunctor>
+	inline const T& Vector<T, IncrementFunctor>::ConstIterator::operator[](difference_type offset) const
+	{
+		return *(*this + offset);
+	}
+
+	template <typename T, typename IncrementFunctor>
+	inline bool Vector<T, IncrementFunctor>::ConstIterator::operator<(const ConstIterator& rhs) const
+	{
+		return _item < rhs._item;
+	}
+
+	template <typename T, typename IncrementFunctor>
+	inline bool Vector<T, IncrementFunctor>::ConstIterator::operator>(const ConstIterator& rhs) const
+	{
+		return rhs < *this;
+	}
+
+	template <typename T, typename IncrementFunctor>
+	inline bool Vector<T, IncrementFunctor>::ConstIterator::operator<=(const ConstIterator& rhs) const
 	{
-		return  rhs._item - _item > 0;
+		return !(rhs < *this);
 	}
 
-	template<typename T>
-	inline bool Vector<T>::ConstIterator::operator>(const ConstIterator& rhs) const
+	template <typename T, typename IncrementFunctor>
+	inline bool Vector<T, IncrementFunctor>::ConstIterator::operator>=(const ConstIterator& rhs) const
 	{
-		return  _item - rhs._item > 0;
+		return !(*this < rhs);
 	}
 }